@@ -12,6 +12,7 @@
 #include <Glacier/SExternalReferences.h>
 #include <Glacier/ZActor.h>
 
+#include <RepositoryIndex.h>
 #include <Util/ImGuiUtils.h>
 
 #undef min
@@ -389,7 +390,7 @@ void Assets::SpawnNonRepositoryProp(const ZRuntimeResourceID& s_PropRuntimeResou
         return;
     }
 
-    s_NewEntity.SetProperty("m_eRoomBehaviour", ZSpatialEntity::ERoomBehaviour::ROOM_DYNAMIC);
+    s_NewEntity.SetProperty(PropertyId<"m_eRoomBehaviour">, ZSpatialEntity::ERoomBehaviour::ROOM_DYNAMIC);
 
     auto s_LocalHitman = SDK()->GetLocalPlayer();
 
@@ -572,80 +573,22 @@ void Assets::EquipOutfit(
 void Assets::LoadRepositoryProps() {
     m_RepositoryProps.clear();
 
-    if (m_RepositoryResource.m_nResourceIndex.val == -1) {
-        const auto s_ID = ResId<"[assembly:/repository/pro.repo].pc_repo">;
+    const auto s_RepositoryIndex = SDK()->GetRepositoryIndex();
 
-        Globals::ResourceManager->GetResourcePtr(m_RepositoryResource, s_ID, 0);
+    if (!s_RepositoryIndex) {
+        return;
     }
 
-    if (m_RepositoryResource.GetResourceInfo().status == RESOURCE_STATUS_VALID) {
-        const auto s_RepositoryData = static_cast<THashMap<
-            ZRepositoryID, ZDynamicObject, TDefaultHashMapPolicy<ZRepositoryID>>*>(m_RepositoryResource.
-                GetResourceData());
-
-        for (const auto& [s_RepositoryID, s_DynamicObject] : *s_RepositoryData) {
-            TArray<SDynamicObjectKeyValuePair>* s_Entries = s_DynamicObject.As<TArray<
-                SDynamicObjectKeyValuePair>>();
-
-            ZString s_Id, s_Title, s_CommonName, s_Name;
-            std::string s_FinalName;
-            bool s_IsItem = false;
-
-            for (auto& s_Entry : *s_Entries) {
-                if (s_Entry.sKey == "ID_") {
-                    s_Id = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "Title") {
-                    s_Title = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "CommonName") {
-                    s_CommonName = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "Name") {
-                    s_Name = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "ItemType") {
-                    s_IsItem = true;
-                }
-            }
-
-            if (s_Id.IsEmpty() || !s_IsItem) {
-                continue;
-            }
+    // Items are already sorted by name.
+    const auto s_Items = s_RepositoryIndex->GetItems();
+    m_RepositoryProps.reserve(s_Items.size());
 
-            if (s_Title.IsEmpty() && s_CommonName.IsEmpty() && s_Name.IsEmpty()) {
-                s_FinalName = std::format("<unnamed> [{}]", s_Id.c_str());
-            }
-            else if (!s_Title.IsEmpty()) {
-                s_FinalName = std::format("{} [{}]", s_Title.c_str(), s_Id.c_str());
-            }
-            else if (!s_CommonName.IsEmpty()) {
-                s_FinalName = std::format("{} [{}]", s_CommonName.c_str(), s_Id.c_str());
-            }
-            else if (!s_Name.IsEmpty()) {
-                s_FinalName = std::format("{} [{}]", s_Name.c_str(), s_Id.c_str());
-            }
-
-            m_RepositoryProps.push_back(std::make_pair(s_Id, s_FinalName));
-        }
+    for (const uint32_t s_Index : s_Items) {
+        m_RepositoryProps.emplace_back(s_RepositoryIndex->GetId(s_Index), s_RepositoryIndex->GetDisplayName(s_Index));
     }
-
-    std::ranges::sort(
-        m_RepositoryProps,
-        [](const auto& a, const auto& b) {
-            auto [s_RepositoryIdA, s_NameA] = a;
-            auto [s_RepositoryIdB, s_NameB] = b;
-
-            std::ranges::transform(s_NameA, s_NameA.begin(), [](unsigned char c) { return std::tolower(c); });
-            std::ranges::transform(s_NameB, s_NameB.begin(), [](unsigned char c) { return std::tolower(c); });
-
-            return s_NameA < s_NameB;
-        }
-    );
 }
 
 DEFINE_PLUGIN_DETOUR(Assets, void, OnClearScene, ZEntitySceneContext* th, bool p_FullyUnloadScene) {
-    m_RepositoryResource = {};
     m_RepositoryProps.clear();
 
     return HookResult<void>(HookAction::Continue());
@@ -33,7 +33,6 @@ private:
 
     bool m_AssetsMenuActive = false;
 
-    TResourcePtr<ZTemplateEntityFactory> m_RepositoryResource;
     std::vector<std::pair<ZRepositoryID, std::string>> m_RepositoryProps;
 
     const std::vector<std::string> m_CharSetCharacterTypes = { "Actor", "Nude", "HeroA" };
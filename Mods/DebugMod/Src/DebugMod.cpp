@@ -5,6 +5,7 @@
 #include <winhttp.h>
 #include <numbers>
 #include <filesystem>
+#include <limits>
 
 #include <imgui_internal.h>
 
@@ -107,6 +108,8 @@ void DebugMod::DrawOptions(const bool p_HasFocus) {
             ImGui::Checkbox("Draw Obstacles", &m_DrawObstacles);
             ImGui::Checkbox("Draw Planner Connectivity", &m_DrawDrawPlannerConnectivity);
             ImGui::Checkbox("Draw Area Penalty Multipliers", &m_DrawAreaPenaltyMults);
+            ImGui::SliderFloat("Nav Mesh Detail Distance", &m_NavMeshDetailDistance, 10.f, 500.f, "%.0f");
+            ImGui::SliderFloat("Nav Mesh Draw Distance", &m_NavMeshDrawDistance, 50.f, 2000.f, "%.0f");
         }
     }
 
@@ -148,6 +151,8 @@ void DebugMod::CopyToClipboard(const std::string& p_String) {
 void DebugMod::OnDraw3D(IRenderer* p_Renderer) {}
 
 void DebugMod::OnDepthDraw3D(IRenderer* p_Renderer) {
+    DestroyRetiredStaticMeshes(p_Renderer);
+
     if (m_DrawReasoningGrid) {
         DrawReasoningGrid(p_Renderer);
     }
@@ -346,16 +351,14 @@ void DebugMod::DrawReasoningGrid(IRenderer* p_Renderer) {
     const SReasoningGrid* s_ReasoningGrid = *Globals::ActiveGrid;
     const size_t s_WaypointCount = s_ReasoningGrid->m_WaypointList.size();
 
-    for (size_t i = 0; i < s_WaypointCount * 2; ++i) {
-        p_Renderer->DrawTriangle3D(
-            m_Triangles[i].vertexPosition1, m_Triangles[i].vertexColor1,
-            m_Triangles[i].vertexPosition2, m_Triangles[i].vertexColor2,
-            m_Triangles[i].vertexPosition3, m_Triangles[i].vertexColor3
-        );
+    const ZGridNodeRef& s_HitmanNode = Globals::HM5GridManager->m_HitmanNode;
+    const size_t s_StartIndex = std::min(s_WaypointCount * 2, m_Triangles.size());
+
+    if (!m_ReasoningGridMeshesCreated) {
+        CreateReasoningGridMeshes(p_Renderer);
     }
 
-    const ZGridNodeRef& s_HitmanNode = Globals::HM5GridManager->m_HitmanNode;
-    const size_t s_StartIndex = s_WaypointCount * 2;
+    p_Renderer->DrawStaticMesh(m_ReasoningGridMesh);
 
     static const SVector4 s_SelectedNodeVertexColor = SVector4(0.f, 1.f, 1.f, 0.43922f);
     static const SVector4 s_LargeQuadVertexColor = SVector4(0.33333f, 0.f, 1.f, 0.43922f);
@@ -403,17 +406,11 @@ void DebugMod::DrawReasoningGrid(IRenderer* p_Renderer) {
                 m_Triangles[i].vertexColor3 = s_LargeQuadVertexColor;
             }
         }
-
-        p_Renderer->DrawTriangle3D(
-            m_Triangles[i].vertexPosition1, m_Triangles[i].vertexColor1,
-            m_Triangles[i].vertexPosition2, m_Triangles[i].vertexColor2,
-            m_Triangles[i].vertexPosition3, m_Triangles[i].vertexColor3
-        );
     }
 
-    for (size_t i = 0; i < m_Lines.size(); ++i) {
-        p_Renderer->DrawLine3D(m_Lines[i].start, m_Lines[i].end, m_Lines[i].startColor, m_Lines[i].endColor);
-    }
+    // The colors of the large quads change every frame, so those are still submitted as regular triangles.
+    p_Renderer->DrawTriangles3D(std::span<const Triangle>(m_Triangles).subspan(s_StartIndex));
+    p_Renderer->DrawStaticMesh(m_ReasoningGridLinesMesh);
 
     if (m_ShowIndices) {
         const auto s_CurrentCamera = Functions::GetCurrentCamera->Call();
@@ -446,45 +443,66 @@ void DebugMod::DrawReasoningGrid(IRenderer* p_Renderer) {
 }
 
 void DebugMod::DrawNavMesh(IRenderer* p_Renderer) {
-    static const SVector4 s_GreenTriangleColor = SVector4(0.19608f, 0.80392f, 0.19608f, 0.49804f);
-    static const SVector4 s_YellowTriangleColor = SVector4(1.f, 1.f, 0.f, 0.49804f);
+    const auto s_CurrentCamera = Functions::GetCurrentCamera->Call();
 
-    if (m_DrawPlannerAreasSolid) {
-        for (size_t i = 0; i < m_Areas.size(); ++i) {
-            if (m_ColorizeAreaUsageFlags && m_Areas[i]->m_area->m_usageFlags ==
-                NavPower::AreaUsageFlags::AREA_STEPS) {
-                p_Renderer->DrawMesh(m_Vertices[i], m_Indices[i], s_YellowTriangleColor);
-            }
-            else {
-                p_Renderer->DrawMesh(m_Vertices[i], m_Indices[i], s_GreenTriangleColor);
-            }
-        }
+    if (!s_CurrentCamera) {
+        return;
     }
 
-    if (m_DrawPlannerAreas) {
-        for (size_t i = 0; i < m_NavMeshLines.size(); ++i) {
-            p_Renderer->DrawLine3D(
-                m_NavMeshLines[i].start, m_NavMeshLines[i].end, m_NavMeshLines[i].startColor, m_NavMeshLines[i].endColor
-            );
-        }
+    if (!m_NavMeshMeshesCreated) {
+        CreateNavMeshMeshes(p_Renderer);
     }
 
-    if (m_DrawDrawPlannerConnectivity) {
-        for (size_t i = 0; i < m_NavMeshConnectivityLines.size(); ++i) {
-            p_Renderer->DrawLine3D(
-                m_NavMeshConnectivityLines[i].start, m_NavMeshConnectivityLines[i].end,
-                m_NavMeshConnectivityLines[i].startColor, m_NavMeshConnectivityLines[i].endColor
-            );
-        }
+    if (m_NavMeshMeshColorized != m_ColorizeAreaUsageFlags) {
+        UpdateNavMeshColors(p_Renderer);
     }
 
-    if (m_DrawAreaPenaltyMults) {
-        const auto s_CurrentCamera = Functions::GetCurrentCamera->Call();
+    const float4 s_CameraPosition = s_CurrentCamera->GetObjectToWorldMatrix().Trans;
+    const bool s_IsFrustumCullingEnabled = p_Renderer->IsFrustumCullingEnabled();
 
-        if (!s_CurrentCamera) {
-            return;
+    for (const NavMeshChunk& s_Chunk : m_NavMeshChunks) {
+        if (s_IsFrustumCullingEnabled &&
+            !p_Renderer->IsAABBInsideViewFrustum(s_Chunk.m_Min, s_Chunk.m_Max, SMatrix())) {
+            continue;
+        }
+
+        // Distance from the camera to the closest point of the chunk bounds.
+        const auto s_AxisDistance = [](const float p_Position, const float p_Min, const float p_Max) {
+            return std::max({p_Min - p_Position, 0.f, p_Position - p_Max});
+        };
+
+        const float s_DeltaX = s_AxisDistance(s_CameraPosition.x, s_Chunk.m_Min.x, s_Chunk.m_Max.x);
+        const float s_DeltaY = s_AxisDistance(s_CameraPosition.y, s_Chunk.m_Min.y, s_Chunk.m_Max.y);
+        const float s_DeltaZ = s_AxisDistance(s_CameraPosition.z, s_Chunk.m_Min.z, s_Chunk.m_Max.z);
+        const float s_Distance = std::sqrt(s_DeltaX * s_DeltaX + s_DeltaY * s_DeltaY + s_DeltaZ * s_DeltaZ);
+
+        if (s_Distance > m_NavMeshDrawDistance) {
+            continue;
+        }
+
+        // Far away chunks only get the boundary of the navmesh, which is enough to see its shape.
+        if (s_Distance > m_NavMeshDetailDistance) {
+            if (m_DrawPlannerAreas || m_DrawPlannerAreasSolid) {
+                p_Renderer->DrawStaticMesh(s_Chunk.m_BoundaryMesh);
+            }
+
+            continue;
         }
 
+        if (m_DrawPlannerAreasSolid) {
+            p_Renderer->DrawStaticMesh(s_Chunk.m_SurfaceMesh);
+        }
+
+        if (m_DrawPlannerAreas) {
+            p_Renderer->DrawStaticMesh(s_Chunk.m_OutlineMesh);
+        }
+
+        if (m_DrawDrawPlannerConnectivity) {
+            p_Renderer->DrawStaticMesh(s_Chunk.m_ConnectivityMesh);
+        }
+    }
+
+    if (m_DrawAreaPenaltyMults) {
         SMatrix s_WorldMatrix = s_CurrentCamera->GetObjectToWorldMatrix();
 
         static const SVector4 s_Color = SVector4(1.f, 1.f, 1.f, 1.f);
@@ -831,288 +849,328 @@ void DebugMod::GenerateVerticesForNeighborConnectionLines() {
     }
 }
 
-void DebugMod::BuildNavMeshRenderData() {
-    static const SVector4 s_LineColor = SVector4(0.f, 1.f, 0.f, 1.f);
-    static const SVector4 s_AdjacentLineColor = SVector4(1.f, 1.f, 1.f, 1.f);
+StaticMeshHandle DebugMod::CreateLineMesh(IRenderer* p_Renderer, std::span<const Line> p_Lines) {
+    std::vector<ColoredVertex> s_Vertices;
+    std::vector<uint32_t> s_Indices;
 
-    const uintptr_t s_NavpData = reinterpret_cast<uintptr_t>(Globals::Pathfinder->m_NavPowerResources[0]
-        .m_pNavpowerResource);
-    const uint32_t s_NavpDataSize = Globals::Pathfinder->m_NavPowerResources[0].m_nNavpowerResourceSize;
+    s_Vertices.reserve(p_Lines.size() * 2);
+    s_Indices.reserve(p_Lines.size() * 2);
 
-    m_NavpData.resize(s_NavpDataSize);
+    for (const Line& s_Line : p_Lines) {
+        s_Indices.push_back(static_cast<uint32_t>(s_Vertices.size()));
+        s_Vertices.push_back({s_Line.start, s_Line.startColor});
 
-    std::memcpy(m_NavpData.data(), reinterpret_cast<void*>(s_NavpData), s_NavpDataSize);
+        s_Indices.push_back(static_cast<uint32_t>(s_Vertices.size()));
+        s_Vertices.push_back({s_Line.end, s_Line.endColor});
+    }
 
-    m_NavMesh.read(reinterpret_cast<uintptr_t>(m_NavpData.data()), s_NavpDataSize);
+    return p_Renderer->CreateStaticMesh(s_Vertices, s_Indices, StaticMeshTopology::Lines);
+}
 
-    for (auto& section : m_NavMesh.m_aSections) {
-        for (auto& graph : section.m_aNavGraphs) {
-            for (auto& area : graph.m_areas) {
-                m_Areas.push_back(&area);
-            }
+void DebugMod::CreateReasoningGridMeshes(IRenderer* p_Renderer) {
+    const size_t s_WaypointCount = (*Globals::ActiveGrid)->m_WaypointList.size();
+    const size_t s_SmallQuadTriangleCount = std::min(s_WaypointCount * 2, m_Triangles.size());
+
+    std::vector<ColoredVertex> s_Vertices;
+    std::vector<uint32_t> s_Indices;
+
+    s_Vertices.reserve(s_SmallQuadTriangleCount * 3);
+    s_Indices.reserve(s_SmallQuadTriangleCount * 3);
+
+    for (size_t i = 0; i < s_SmallQuadTriangleCount; ++i) {
+        const Triangle& s_Triangle = m_Triangles[i];
+
+        for (uint32_t j = 0; j < 3; ++j) {
+            s_Indices.push_back(static_cast<uint32_t>(s_Vertices.size() + j));
         }
+
+        s_Vertices.push_back({s_Triangle.vertexPosition1, s_Triangle.vertexColor1});
+        s_Vertices.push_back({s_Triangle.vertexPosition2, s_Triangle.vertexColor2});
+        s_Vertices.push_back({s_Triangle.vertexPosition3, s_Triangle.vertexColor3});
     }
 
-    m_Vertices.resize(m_Areas.size());
-    m_Indices.resize(m_Areas.size());
-    m_NavMeshLines.reserve(m_Areas.size() * 3);
-    m_NavMeshConnectivityLines.reserve(m_Areas.size() * 3);
-    
-    std::map<NavPower::Binary::Area*, uint32_t> s_AreaPointerToIndexMap = GetAreaPointerToIndexMap();
+    m_ReasoningGridMesh = p_Renderer->CreateStaticMesh(s_Vertices, s_Indices);
+    m_ReasoningGridLinesMesh = CreateLineMesh(p_Renderer, m_Lines);
+    m_ReasoningGridMeshesCreated = true;
+}
+
+void DebugMod::BuildNavMeshChunks() {
+    std::unordered_map<uint64_t, size_t> s_CellToChunkIndex;
 
     for (size_t i = 0; i < m_Areas.size(); ++i) {
-        const size_t s_VertexCount = m_Areas[i]->m_edges.size();
+        const SVector3 s_Position = m_Areas[i]->m_area->m_pos;
 
-        m_Vertices[i].reserve(s_VertexCount);
+        const int32_t s_CellX = static_cast<int32_t>(std::floor(s_Position.x / c_NavMeshChunkSize));
+        const int32_t s_CellY = static_cast<int32_t>(std::floor(s_Position.y / c_NavMeshChunkSize));
+        const uint64_t s_CellKey = (static_cast<uint64_t>(static_cast<uint32_t>(s_CellX)) << 32) |
+            static_cast<uint32_t>(s_CellY);
 
-        const SVector3 s_Centroid = m_Areas[i]->CalculateCentroid();
+        const auto [s_Iterator, s_Inserted] = s_CellToChunkIndex.try_emplace(s_CellKey, m_NavMeshChunks.size());
 
-        for (size_t j = 0; j < s_VertexCount; ++j) {
-            m_Vertices[i].push_back(m_Areas[i]->m_edges[j]->m_pos);
+        if (s_Inserted) {
+            NavMeshChunk& s_Chunk = m_NavMeshChunks.emplace_back();
+            constexpr float s_Max = std::numeric_limits<float>::max();
 
-            const size_t s_NextIndex = (j + 1) % s_VertexCount;
-            Line& s_Line = m_NavMeshLines.emplace_back();
+            s_Chunk.m_Min = SVector3(s_Max, s_Max, s_Max);
+            s_Chunk.m_Max = SVector3(-s_Max, -s_Max, -s_Max);
+        }
 
-            s_Line.start = m_Areas[i]->m_edges[j]->m_pos;
-            s_Line.startColor = s_LineColor;
+        NavMeshChunk& s_Chunk = m_NavMeshChunks[s_Iterator->second];
+        s_Chunk.m_Areas.push_back(static_cast<uint32_t>(i));
 
-            s_Line.end = m_Areas[i]->m_edges[s_NextIndex]->m_pos;
-            s_Line.endColor = s_LineColor;
+        // Areas can stick out of their cell, so the bounds are based on the actual vertices.
+        for (const SVector3& s_Vertex : GetNavMeshAreaVertices(i)) {
+            s_Chunk.m_Min.x = std::min(s_Chunk.m_Min.x, s_Vertex.x);
+            s_Chunk.m_Min.y = std::min(s_Chunk.m_Min.y, s_Vertex.y);
+            s_Chunk.m_Min.z = std::min(s_Chunk.m_Min.z, s_Vertex.z);
 
-            NavPower::Binary::Area* s_AdjArea = m_Areas[i]->m_edges[j]->m_pAdjArea;
+            s_Chunk.m_Max.x = std::max(s_Chunk.m_Max.x, s_Vertex.x);
+            s_Chunk.m_Max.y = std::max(s_Chunk.m_Max.y, s_Vertex.y);
+            s_Chunk.m_Max.z = std::max(s_Chunk.m_Max.z, s_Vertex.z);
+        }
+    }
+}
+
+void DebugMod::CreateNavMeshMeshes(IRenderer* p_Renderer) {
+    static const SVector4 s_LineColor = SVector4(0.f, 1.f, 0.f, 1.f);
+
+    std::vector<ColoredVertex> s_Vertices;
+    std::vector<uint32_t> s_Indices;
+    std::vector<Line> s_OutlineLines;
+    std::vector<Line> s_BoundaryLines;
+
+    for (NavMeshChunk& s_Chunk : m_NavMeshChunks) {
+        s_Vertices.clear();
+        s_Indices.clear();
+        s_OutlineLines.clear();
+        s_BoundaryLines.clear();
 
-            if (s_AdjArea) {
-                const uint32_t s_AdjacentAreaIndex = s_AreaPointerToIndexMap[s_AdjArea];
-                NavPower::Area& s_AdjacentArea = *m_Areas[s_AdjacentAreaIndex - 1];
-                const SVector3 s_AdjacentCentroid = s_AdjacentArea.CalculateCentroid();
+        for (const uint32_t s_AreaIndex : s_Chunk.m_Areas) {
+            const uint32_t s_BaseVertex = static_cast<uint32_t>(s_Vertices.size());
+            const std::span<const SVector3> s_AreaVertices = GetNavMeshAreaVertices(s_AreaIndex);
 
-                Line& s_ConnLine = m_NavMeshConnectivityLines.emplace_back();
-                s_ConnLine.start = s_Centroid;
-                s_ConnLine.startColor = s_AdjacentLineColor;
-                s_ConnLine.end = s_AdjacentCentroid;
-                s_ConnLine.endColor = s_AdjacentLineColor;
+            for (const SVector3& s_Vertex : s_AreaVertices) {
+                s_Vertices.push_back({s_Vertex, SVector4()});
+            }
+
+            for (const unsigned short s_Index : GetNavMeshAreaIndices(s_AreaIndex)) {
+                s_Indices.push_back(s_BaseVertex + s_Index);
+            }
+
+            const auto& s_Edges = m_Areas[s_AreaIndex]->m_edges;
+
+            for (size_t j = 0; j < s_AreaVertices.size(); ++j) {
+                Line& s_Line = s_OutlineLines.emplace_back();
+                s_Line.start = s_AreaVertices[j];
+                s_Line.startColor = s_LineColor;
+                s_Line.end = s_AreaVertices[(j + 1) % s_AreaVertices.size()];
+                s_Line.endColor = s_LineColor;
+
+                // Edges shared with another area are inside the navmesh.
+                if (!s_Edges[j]->m_pAdjArea) {
+                    s_BoundaryLines.push_back(s_Line);
+                }
             }
         }
 
-        VertexTriangluation(m_Vertices[i], m_Indices[i]);
-    }
-}
+        s_Chunk.m_SurfaceMesh = p_Renderer->CreateStaticMesh(s_Vertices, s_Indices);
+        s_Chunk.m_OutlineMesh = CreateLineMesh(p_Renderer, s_OutlineLines);
+        s_Chunk.m_BoundaryMesh = CreateLineMesh(p_Renderer, s_BoundaryLines);
 
-std::map<NavPower::Binary::Area*, uint32_t> DebugMod::GetAreaPointerToIndexMap() {
-    std::map<NavPower::Binary::Area*, uint32_t> s_AreaPointerToIndexMap;
-    uint32_t s_AreaIndex = 1;
+        // Connectivity lines of an area are stored contiguously, so gather the ranges of the areas in this chunk.
+        std::vector<Line> s_ConnectivityLines;
 
-    for (NavPower::Area* area : m_Areas) {
-        s_AreaPointerToIndexMap.emplace(area->m_area, s_AreaIndex);
+        for (const uint32_t s_AreaIndex : s_Chunk.m_Areas) {
+            s_ConnectivityLines.insert(
+                s_ConnectivityLines.end(),
+                m_NavMeshConnectivityLines.begin() + m_NavMeshConnectivityLineOffsets[s_AreaIndex],
+                m_NavMeshConnectivityLines.begin() + m_NavMeshConnectivityLineOffsets[s_AreaIndex + 1]
+            );
+        }
 
-        s_AreaIndex++;
+        s_Chunk.m_ConnectivityMesh = CreateLineMesh(p_Renderer, s_ConnectivityLines);
     }
 
-    return s_AreaPointerToIndexMap;
-}
+    m_NavMeshMeshesCreated = true;
 
-float DebugMod::AngleBetween(const SVector3& a, const SVector3& b) {
-    float angle = SVector3::DotProduct(a, b);
-    angle /= (a.Length() * b.Length());
-    return angle = acosf(angle);
+    UpdateNavMeshColors(p_Renderer);
 }
 
-SVector3 DebugMod::ProjectionOnto(const SVector3& a, const SVector3& b) {
-    const SVector3 bn = b / b.Length();
-    return bn * SVector3::DotProduct(a, bn);
-}
+void DebugMod::UpdateNavMeshColors(IRenderer* p_Renderer) {
+    static const SVector4 s_GreenTriangleColor = SVector4(0.19608f, 0.80392f, 0.19608f, 0.49804f);
+    static const SVector4 s_YellowTriangleColor = SVector4(1.f, 1.f, 0.f, 0.49804f);
+
+    std::vector<SVector4> s_Colors;
+
+    for (const NavMeshChunk& s_Chunk : m_NavMeshChunks) {
+        s_Colors.clear();
 
-bool DebugMod::AreOnSameSide(const SVector3& p1, const SVector3& p2, const SVector3& a, const SVector3& b) {
-    const SVector3 cp1 = SVector3::CrossProduct(b - a, p1 - a);
-    const SVector3 cp2 = SVector3::CrossProduct(b - a, p2 - a);
+        for (const uint32_t s_AreaIndex : s_Chunk.m_Areas) {
+            const bool s_IsSteps = m_ColorizeAreaUsageFlags &&
+                m_Areas[s_AreaIndex]->m_area->m_usageFlags == NavPower::AreaUsageFlags::AREA_STEPS;
+
+            s_Colors.insert(
+                s_Colors.end(), GetNavMeshAreaVertices(s_AreaIndex).size(),
+                s_IsSteps ? s_YellowTriangleColor : s_GreenTriangleColor
+            );
+        }
 
-    if (SVector3::DotProduct(cp1, cp2) >= 0) {
-        return true;
+        p_Renderer->UpdateStaticMeshColors(s_Chunk.m_SurfaceMesh, 0, s_Colors);
     }
 
-    return false;
+    m_NavMeshMeshColorized = m_ColorizeAreaUsageFlags;
 }
 
-SVector3 DebugMod::ComputeTriangleNormal(const SVector3& t1, const SVector3& t2, const SVector3& t3) {
-    const SVector3 u = t2 - t1;
-    const SVector3 v = t3 - t1;
-    const SVector3 normal = SVector3::CrossProduct(u, v);
+void DebugMod::RetireStaticMeshes() {
+    std::scoped_lock s_Lock(m_RetiredStaticMeshesMutex);
 
-    return normal;
-}
+    m_RetiredStaticMeshes.push_back(m_ReasoningGridMesh);
+    m_RetiredStaticMeshes.push_back(m_ReasoningGridLinesMesh);
 
-bool DebugMod::IsInTriangle(
-    const SVector3& point, const SVector3& triangle1, const SVector3& triangle2, const SVector3& triangle3
-) {
-    // Test to see if it is within an infinite prism that the triangle outlines.
-    const bool within_tri_prisim = AreOnSameSide(point, triangle1, triangle2, triangle3) && AreOnSameSide(
-                point, triangle2, triangle1, triangle3
-            )
-            && AreOnSameSide(point, triangle3, triangle1, triangle2);
-
-    // If it isn't it will never be on the triangle
-    if (!within_tri_prisim) {
-        return false;
+    m_ReasoningGridMesh = StaticMeshHandle::Invalid;
+    m_ReasoningGridLinesMesh = StaticMeshHandle::Invalid;
+    m_ReasoningGridMeshesCreated = false;
+
+    for (const NavMeshChunk& s_Chunk : m_NavMeshChunks) {
+        m_RetiredStaticMeshes.push_back(s_Chunk.m_SurfaceMesh);
+        m_RetiredStaticMeshes.push_back(s_Chunk.m_OutlineMesh);
+        m_RetiredStaticMeshes.push_back(s_Chunk.m_BoundaryMesh);
+        m_RetiredStaticMeshes.push_back(s_Chunk.m_ConnectivityMesh);
     }
 
-    // Calulate Triangle's Normal
-    const SVector3 n = ComputeTriangleNormal(triangle1, triangle2, triangle3);
+    m_NavMeshChunks.clear();
+    m_NavMeshMeshesCreated = false;
+}
 
-    // Project the point onto this normal
-    const SVector3 proj = ProjectionOnto(point, n);
+void DebugMod::DestroyRetiredStaticMeshes(IRenderer* p_Renderer) {
+    std::scoped_lock s_Lock(m_RetiredStaticMeshesMutex);
 
-    // If the distance from the triangle to the point is 0
-    //	it lies on the triangle
-    if (proj.Length() == 0) {
-        return true;
+    for (const StaticMeshHandle s_Mesh : m_RetiredStaticMeshes) {
+        p_Renderer->DestroyStaticMesh(s_Mesh);
     }
 
-    return false;
+    m_RetiredStaticMeshes.clear();
 }
 
-void DebugMod::VertexTriangluation(const std::vector<SVector3>& vertices, std::vector<unsigned short>& indices) {
-    // If there are 2 or less verts,
-    // no triangle can be created,
-    // so exit
-    if (vertices.size() < 3) {
-        return;
+void DebugMod::BuildNavMeshRenderData() {
+    static const SVector4 s_AdjacentLineColor = SVector4(1.f, 1.f, 1.f, 1.f);
+
+    const uintptr_t s_NavpData = reinterpret_cast<uintptr_t>(Globals::Pathfinder->m_NavPowerResources[0]
+        .m_pNavpowerResource);
+    const uint32_t s_NavpDataSize = Globals::Pathfinder->m_NavPowerResources[0].m_nNavpowerResourceSize;
+
+    m_NavpData.resize(s_NavpDataSize);
+
+    std::memcpy(m_NavpData.data(), reinterpret_cast<void*>(s_NavpData), s_NavpDataSize);
+
+    m_NavMesh.read(reinterpret_cast<uintptr_t>(m_NavpData.data()), s_NavpDataSize);
+
+    for (auto& section : m_NavMesh.m_aSections) {
+        for (auto& graph : section.m_aNavGraphs) {
+            for (auto& area : graph.m_areas) {
+                m_Areas.push_back(&area);
+            }
+        }
     }
-    // If it is a triangle no need to calculate it
-    if (vertices.size() == 3) {
-        indices.push_back(0);
-        indices.push_back(1);
-        indices.push_back(2);
-        return;
+
+    // Every centroid is needed once for its own area and once for each edge leading into it,
+    // so they're calculated up front together with the lookup from binary areas to indices.
+    // All binary areas live in m_NavpData and are at least sizeof(Area) bytes apart, so their offset divided by that
+    // is a unique slot in a flat table.
+    constexpr size_t c_AreaSlotSize = sizeof(NavPower::Binary::Area);
+    constexpr uint32_t c_NoArea = std::numeric_limits<uint32_t>::max();
+
+    std::vector<SVector3> s_Centroids;
+    std::vector<uint32_t> s_AreaSlotToIndex(m_NavpData.size() / c_AreaSlotSize + 1, c_NoArea);
+    size_t s_TotalVertexCount = 0;
+
+    const auto s_GetAreaOffset = [&](const NavPower::Binary::Area* p_Area) {
+        return reinterpret_cast<uintptr_t>(p_Area) - reinterpret_cast<uintptr_t>(m_NavpData.data());
+    };
+
+    s_Centroids.reserve(m_Areas.size());
+
+    for (size_t i = 0; i < m_Areas.size(); ++i) {
+        s_Centroids.push_back(m_Areas[i]->CalculateCentroid());
+        s_AreaSlotToIndex[s_GetAreaOffset(m_Areas[i]->m_area) / c_AreaSlotSize] = static_cast<uint32_t>(i);
+        s_TotalVertexCount += m_Areas[i]->m_edges.size();
     }
 
-    // Create a list of vertices
-    std::vector<SVector3> tVerts = vertices;
+    // Edges of broken navmeshes can point anywhere, so the slot has to actually hold the area.
+    const auto s_GetAreaIndex = [&](const NavPower::Binary::Area* p_Area) {
+        const uintptr_t s_Offset = s_GetAreaOffset(p_Area);
 
-    while (true) {
-        // For every vertex
-        for (int i = 0; i < int(tVerts.size()); i++) {
-            // pPrev = the previous vertex in the list
-            SVector3 pPrev;
-            if (i == 0) {
-                pPrev = tVerts[tVerts.size() - 1];
-            }
-            else {
-                pPrev = tVerts[i - 1];
-            }
+        if (s_Offset >= m_NavpData.size()) {
+            return c_NoArea;
+        }
 
-            // pCur = the current vertex;
-            SVector3 pCur = tVerts[i];
+        const uint32_t s_AreaIndex = s_AreaSlotToIndex[s_Offset / c_AreaSlotSize];
 
-            // pNext = the next vertex in the list
-            SVector3 pNext;
-            if (i == tVerts.size() - 1) {
-                pNext = tVerts[0];
-            }
-            else {
-                pNext = tVerts[i + 1];
-            }
+        if (s_AreaIndex == c_NoArea || m_Areas[s_AreaIndex]->m_area != p_Area) {
+            return c_NoArea;
+        }
 
-            // Check to see if there are only 3 verts left
-            // if so this is the last triangle
-            if (tVerts.size() == 3) {
-                // Create a triangle from pCur, pPrev, pNext
-                for (int j = 0; j < int(tVerts.size()); j++) {
-                    if (vertices[j] == pCur)
-                        indices.push_back(j);
-                    if (vertices[j] == pPrev)
-                        indices.push_back(j);
-                    if (vertices[j] == pNext)
-                        indices.push_back(j);
-                }
+        return s_AreaIndex;
+    };
 
-                tVerts.clear();
-                break;
-            }
-            if (tVerts.size() == 4) {
-                // Create a triangle from pCur, pPrev, pNext
-                for (int j = 0; j < int(vertices.size()); j++) {
-                    if (vertices[j] == pCur)
-                        indices.push_back(j);
-                    if (vertices[j] == pPrev)
-                        indices.push_back(j);
-                    if (vertices[j] == pNext)
-                        indices.push_back(j);
-                }
+    m_NavMeshVertices.reserve(s_TotalVertexCount);
+    m_NavMeshVertexOffsets.reserve(m_Areas.size() + 1);
+    m_NavMeshIndices.reserve(s_TotalVertexCount * 3);
+    m_NavMeshIndexOffsets.reserve(m_Areas.size() + 1);
+    m_NavMeshConnectivityLines.reserve(m_Areas.size() * 3);
+    m_NavMeshConnectivityLineOffsets.reserve(m_Areas.size() + 1);
 
-                SVector3 tempVec;
-                for (int j = 0; j < int(tVerts.size()); j++) {
-                    if (tVerts[j] != pCur
-                        && tVerts[j] != pPrev
-                        && tVerts[j] != pNext) {
-                        tempVec = tVerts[j];
-                        break;
-                    }
-                }
+    for (size_t i = 0; i < m_Areas.size(); ++i) {
+        const size_t s_FirstVertex = m_NavMeshVertices.size();
 
-                // Create a triangle from pCur, pPrev, pNext
-                for (int j = 0; j < int(vertices.size()); j++) {
-                    if (vertices[j] == pPrev)
-                        indices.push_back(j);
-                    if (vertices[j] == pNext)
-                        indices.push_back(j);
-                    if (vertices[j] == tempVec)
-                        indices.push_back(j);
-                }
+        m_NavMeshVertexOffsets.push_back(static_cast<uint32_t>(s_FirstVertex));
+        m_NavMeshIndexOffsets.push_back(static_cast<uint32_t>(m_NavMeshIndices.size()));
+        m_NavMeshConnectivityLineOffsets.push_back(static_cast<uint32_t>(m_NavMeshConnectivityLines.size()));
 
-                tVerts.clear();
-                break;
-            }
+        for (const NavPower::Binary::Edge* s_Edge : m_Areas[i]->m_edges) {
+            m_NavMeshVertices.push_back(s_Edge->m_pos);
 
-            // If Vertex is not an interior vertex
-            float angle = AngleBetween(pPrev - pCur, pNext - pCur) * (180 / 3.14159265359);
-            if (angle <= 0 && angle >= 180)
+            if (!s_Edge->m_pAdjArea) {
                 continue;
-
-            // If any vertices are within this triangle
-            bool inTri = false;
-            for (int j = 0; j < int(vertices.size()); j++) {
-                if (IsInTriangle(vertices[j], pPrev, pCur, pNext)
-                    && vertices[j] != pPrev
-                    && vertices[j] != pCur
-                    && vertices[j] != pNext) {
-                    inTri = true;
-                    break;
-                }
             }
-            if (inTri)
-                continue;
 
-            // Create a triangle from pCur, pPrev, pNext
-            for (int j = 0; j < int(vertices.size()); j++) {
-                if (vertices[j] == pCur)
-                    indices.push_back(j);
-                if (vertices[j] == pPrev)
-                    indices.push_back(j);
-                if (vertices[j] == pNext)
-                    indices.push_back(j);
-            }
+            const uint32_t s_AdjacentAreaIndex = s_GetAreaIndex(s_Edge->m_pAdjArea);
 
-            // Delete pCur from the list
-            for (int j = 0; j < int(tVerts.size()); j++) {
-                if (tVerts[j] == pCur) {
-                    tVerts.erase(tVerts.begin() + j);
-                    break;
-                }
+            if (s_AdjacentAreaIndex == c_NoArea) {
+                continue;
             }
 
-            // reset i to the start
-            // -1 since loop will add 1 to it
-            i = -1;
+            Line& s_ConnLine = m_NavMeshConnectivityLines.emplace_back();
+            s_ConnLine.start = s_Centroids[i];
+            s_ConnLine.startColor = s_AdjacentLineColor;
+            s_ConnLine.end = s_Centroids[s_AdjacentAreaIndex];
+            s_ConnLine.endColor = s_AdjacentLineColor;
         }
 
-        // if no triangles were created
-        if (indices.size() == 0)
-            break;
-
-        // if no more vertices
-        if (tVerts.size() == 0)
-            break;
+        NavMeshTriangulation::TriangulatePolygon(
+            std::span<const SVector3>(m_NavMeshVertices).subspan(s_FirstVertex), m_NavMeshIndices
+        );
     }
+
+    m_NavMeshVertexOffsets.push_back(static_cast<uint32_t>(m_NavMeshVertices.size()));
+    m_NavMeshIndexOffsets.push_back(static_cast<uint32_t>(m_NavMeshIndices.size()));
+    m_NavMeshConnectivityLineOffsets.push_back(static_cast<uint32_t>(m_NavMeshConnectivityLines.size()));
+
+    BuildNavMeshChunks();
+}
+
+std::span<const SVector3> DebugMod::GetNavMeshAreaVertices(const size_t p_AreaIndex) const {
+    return std::span<const SVector3>(m_NavMeshVertices).subspan(
+        m_NavMeshVertexOffsets[p_AreaIndex],
+        m_NavMeshVertexOffsets[p_AreaIndex + 1] - m_NavMeshVertexOffsets[p_AreaIndex]
+    );
+}
+
+std::span<const unsigned short> DebugMod::GetNavMeshAreaIndices(const size_t p_AreaIndex) const {
+    return std::span<const unsigned short>(m_NavMeshIndices).subspan(
+        m_NavMeshIndexOffsets[p_AreaIndex],
+        m_NavMeshIndexOffsets[p_AreaIndex + 1] - m_NavMeshIndexOffsets[p_AreaIndex]
+    );
 }
 
 const char* DebugMod::CompiledBehaviorTypeToString(ECompiledBehaviorType p_Type) {
@@ -1344,11 +1402,14 @@ DEFINE_PLUGIN_DETOUR(DebugMod, void, OnClearScene, ZEntitySceneContext* th, bool
     m_NavMesh = {};
     m_NavpData.clear();
     m_Areas.clear();
-    m_Vertices.clear();
-    m_Indices.clear();
-    m_NavMeshLines.clear();
+    m_NavMeshVertices.clear();
+    m_NavMeshVertexOffsets.clear();
+    m_NavMeshIndices.clear();
+    m_NavMeshIndexOffsets.clear();
     m_NavMeshConnectivityLines.clear();
+    m_NavMeshConnectivityLineOffsets.clear();
     m_ObstaclesToEntityIDs.clear();
+    RetireStaticMeshes();
 
     return HookResult<void>(HookAction::Continue());
 }
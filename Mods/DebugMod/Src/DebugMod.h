@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mutex>
 #include <shared_mutex>
 #include <random>
 #include <unordered_map>
@@ -16,6 +17,7 @@
 #include <Glacier/ZPathfinder.h>
 
 #include "NavPower.h"
+#include "NavMeshTriangulation.h"
 
 class DebugMod : public IPluginInterface {
 public:
@@ -48,15 +50,16 @@ private:
 
     void BuildNavMeshRenderData();
 
-    std::map<NavPower::Binary::Area*, uint32_t> GetAreaPointerToIndexMap();
+    void BuildNavMeshChunks();
+    void CreateReasoningGridMeshes(IRenderer* p_Renderer);
+    void CreateNavMeshMeshes(IRenderer* p_Renderer);
+    void UpdateNavMeshColors(IRenderer* p_Renderer);
+    void RetireStaticMeshes();
+    void DestroyRetiredStaticMeshes(IRenderer* p_Renderer);
+    static StaticMeshHandle CreateLineMesh(IRenderer* p_Renderer, std::span<const Line> p_Lines);
 
-    // Functions are adapted from OBJ Loader plugin: https://github.com/Bly7/OBJ-Loader/blob/master/Source/OBJ_Loader.h
-    static void VertexTriangluation(const std::vector<SVector3>& vertices, std::vector<unsigned short>& indices);
-    static float AngleBetween(const SVector3& a, const SVector3& b);
-    static SVector3 ProjectionOnto(const SVector3& a, const SVector3& b);
-    static bool AreOnSameSide(const SVector3& p1, const SVector3& p2, const SVector3& a, const SVector3& b);
-    static SVector3 ComputeTriangleNormal(const SVector3& t1, const SVector3& t2, const SVector3& t3);
-    static bool IsInTriangle(const SVector3& point, const SVector3& triangle1, const SVector3& triangle2, const SVector3& triangle3);
+    std::span<const SVector3> GetNavMeshAreaVertices(size_t p_AreaIndex) const;
+    std::span<const unsigned short> GetNavMeshAreaIndices(size_t p_AreaIndex) const;
 
     static const char* CompiledBehaviorTypeToString(ECompiledBehaviorType p_Type);
     
@@ -97,10 +100,53 @@ private:
     NavPower::NavMesh m_NavMesh;
     std::vector<uint8_t> m_NavpData;
     std::vector<NavPower::Area*> m_Areas;
-    std::vector<std::vector<SVector3>> m_Vertices;
-    std::vector<std::vector<unsigned short>> m_Indices;
-    std::vector<Line> m_NavMeshLines;
+
+    // Vertices and triangle indices of all areas are stored in shared buffers. The offsets hold the start of
+    // each area plus one past the end of the last one, and the indices are relative to the first vertex of their area.
+    std::vector<SVector3> m_NavMeshVertices;
+    std::vector<uint32_t> m_NavMeshVertexOffsets;
+    std::vector<unsigned short> m_NavMeshIndices;
+    std::vector<uint32_t> m_NavMeshIndexOffsets;
+
     std::vector<Line> m_NavMeshConnectivityLines;
+
+    // Index of the first connectivity line of each area, plus one past the last line.
+    std::vector<uint32_t> m_NavMeshConnectivityLineOffsets;
+
+    // The navmesh is split into a uniform grid of chunks so far away or off-screen parts can be skipped as a whole.
+    struct NavMeshChunk {
+        SVector3 m_Min;
+        SVector3 m_Max;
+        std::vector<uint32_t> m_Areas;
+        StaticMeshHandle m_SurfaceMesh = StaticMeshHandle::Invalid;
+        StaticMeshHandle m_OutlineMesh = StaticMeshHandle::Invalid;
+
+        // Only the edges without an adjacent area, drawn instead of the outlines when the chunk is far away.
+        StaticMeshHandle m_BoundaryMesh = StaticMeshHandle::Invalid;
+        StaticMeshHandle m_ConnectivityMesh = StaticMeshHandle::Invalid;
+    };
+
+    static constexpr float c_NavMeshChunkSize = 32.f;
+
+    std::vector<NavMeshChunk> m_NavMeshChunks;
+    bool m_NavMeshMeshesCreated = false;
+    bool m_NavMeshMeshColorized = false;
+
+    // Chunks further away than this are only drawn as the boundary of the navmesh.
+    float m_NavMeshDetailDistance = 75.f;
+    float m_NavMeshDrawDistance = 400.f;
+
+    // Static geometry is uploaded once and then drawn with a single call per frame.
+    // Meshes can only be created and destroyed with a renderer, so clearing the scene
+    // retires them and they're destroyed on the next draw.
+    StaticMeshHandle m_ReasoningGridMesh = StaticMeshHandle::Invalid;
+    StaticMeshHandle m_ReasoningGridLinesMesh = StaticMeshHandle::Invalid;
+
+    // Either mesh is Invalid when there's no geometry for it, so this tracks whether they've been created instead.
+    bool m_ReasoningGridMeshesCreated = false;
+
+    std::mutex m_RetiredStaticMeshesMutex;
+    std::vector<StaticMeshHandle> m_RetiredStaticMeshes;
     std::unordered_map<IPFObstacleInternal*, uint64_t> m_ObstaclesToEntityIDs;
 };
 
@@ -0,0 +1,138 @@
+#include "NavMeshTriangulation.h"
+
+#include <algorithm>
+
+void NavMeshTriangulation::TriangulatePolygon(
+    std::span<const SVector3> p_Vertices, std::vector<unsigned short>& p_Indices
+) {
+    const size_t s_VertexCount = p_Vertices.size();
+
+    if (s_VertexCount < 3) {
+        return;
+    }
+
+    // Triangle indices are always written in ascending order, which is what the previous triangulation produced.
+    const auto s_AddTriangle = [&](unsigned short a, unsigned short b, unsigned short c) {
+        if (a > b) std::swap(a, b);
+        if (b > c) std::swap(b, c);
+        if (a > b) std::swap(a, b);
+
+        p_Indices.push_back(a);
+        p_Indices.push_back(b);
+        p_Indices.push_back(c);
+    };
+
+    // Polygon normal using Newell's method, which also works for polygons with collinear or reflex vertices.
+    SVector3 s_Normal(0.f, 0.f, 0.f);
+
+    for (size_t i = 0; i < s_VertexCount; ++i) {
+        const SVector3& s_Current = p_Vertices[i];
+        const SVector3& s_Next = p_Vertices[(i + 1) % s_VertexCount];
+
+        s_Normal.x += (s_Current.y - s_Next.y) * (s_Current.z + s_Next.z);
+        s_Normal.y += (s_Current.z - s_Next.z) * (s_Current.x + s_Next.x);
+        s_Normal.z += (s_Current.x - s_Next.x) * (s_Current.y + s_Next.y);
+    }
+
+    const float s_NormalLength = s_Normal.Length();
+
+    if (s_NormalLength > 0.f) {
+        s_Normal = s_Normal / s_NormalLength;
+    }
+
+    // Signed area of the corner (or triangle) a, b, c when looking down the polygon normal.
+    const auto s_Turn = [&](const SVector3& a, const SVector3& b, const SVector3& c) {
+        return SVector3::DotProduct(SVector3::CrossProduct(b - a, c - b), s_Normal);
+    };
+
+    // Navmesh areas are convex, which makes every vertex an ear. Clipping them in order from the first vertex gives
+    // a fan around the last vertex and doesn't need any containment tests.
+    // Nearly collinear or coincident vertices can turn slightly the wrong way due to rounding, so a small tolerance
+    // is allowed, both relative to the edge lengths and as an absolute area.
+    constexpr float s_ConvexityTolerance = 1e-4f;
+    constexpr float s_MinimumCornerArea = 1e-6f;
+    bool s_IsConvex = true;
+
+    for (size_t i = 0; i < s_VertexCount && s_IsConvex; ++i) {
+        const SVector3& a = p_Vertices[(i + s_VertexCount - 1) % s_VertexCount];
+        const SVector3& b = p_Vertices[i];
+        const SVector3& c = p_Vertices[(i + 1) % s_VertexCount];
+
+        s_IsConvex = s_Turn(a, b, c) >=
+            -s_ConvexityTolerance * (b - a).Length() * (c - b).Length() - s_MinimumCornerArea;
+    }
+
+    if (s_IsConvex) {
+        const auto s_Last = static_cast<unsigned short>(s_VertexCount - 1);
+
+        for (unsigned short i = 0; i + 2 < s_VertexCount; ++i) {
+            s_AddTriangle(i, i + 1, s_Last);
+        }
+
+        return;
+    }
+
+    // Concave polygons are ear clipped using a linked list of the remaining vertices. After clipping an ear the search
+    // continues at the following vertex instead of starting over.
+    std::vector<unsigned short> s_Previous(s_VertexCount);
+    std::vector<unsigned short> s_Next(s_VertexCount);
+
+    for (size_t i = 0; i < s_VertexCount; ++i) {
+        s_Previous[i] = static_cast<unsigned short>((i + s_VertexCount - 1) % s_VertexCount);
+        s_Next[i] = static_cast<unsigned short>((i + 1) % s_VertexCount);
+    }
+
+    const auto s_IsEar = [&](
+        const unsigned short p_Previous, const unsigned short p_Current, const unsigned short p_Next
+    ) {
+        const SVector3& a = p_Vertices[p_Previous];
+        const SVector3& b = p_Vertices[p_Current];
+        const SVector3& c = p_Vertices[p_Next];
+
+        if (s_Turn(a, b, c) <= 0.f) {
+            return false;
+        }
+
+        for (unsigned short i = s_Next[p_Next]; i != p_Previous; i = s_Next[i]) {
+            const SVector3& p = p_Vertices[i];
+
+            if (p == a || p == b || p == c) {
+                continue;
+            }
+
+            if (s_Turn(a, b, p) >= 0.f && s_Turn(b, c, p) >= 0.f && s_Turn(c, a, p) >= 0.f) {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    unsigned short s_Current = 0;
+    size_t s_RemainingCount = s_VertexCount;
+    size_t s_VerticesSinceLastEar = 0;
+
+    while (s_RemainingCount > 3) {
+        const unsigned short s_PreviousVertex = s_Previous[s_Current];
+        const unsigned short s_NextVertex = s_Next[s_Current];
+
+        // Self-intersecting or degenerate polygons can run out of ears, in which case the current vertex is clipped
+        // anyway so the loop always finishes.
+        if (s_IsEar(s_PreviousVertex, s_Current, s_NextVertex) || s_VerticesSinceLastEar >= s_RemainingCount) {
+            s_AddTriangle(s_PreviousVertex, s_Current, s_NextVertex);
+
+            s_Next[s_PreviousVertex] = s_NextVertex;
+            s_Previous[s_NextVertex] = s_PreviousVertex;
+
+            --s_RemainingCount;
+            s_VerticesSinceLastEar = 0;
+        }
+        else {
+            ++s_VerticesSinceLastEar;
+        }
+
+        s_Current = s_NextVertex;
+    }
+
+    s_AddTriangle(s_Previous[s_Current], s_Current, s_Next[s_Current]);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <Glacier/ZMath.h>
+
+namespace NavMeshTriangulation {
+    /**
+     * Triangulate the polygon of a navmesh area.
+     *
+     * Convex polygons, which is what navmesh areas should be, are split into a fan around their last vertex.
+     * Anything else is ear clipped. The indices of every triangle are written in ascending order.
+     * @param p_Vertices The vertices of the polygon, in order.
+     * @param p_Indices Receives the indices of p_Vertices.size() - 2 triangles, appended to the existing contents.
+     */
+    void TriangulatePolygon(std::span<const SVector3> p_Vertices, std::vector<unsigned short>& p_Indices);
+}
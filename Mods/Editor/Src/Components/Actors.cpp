@@ -14,6 +14,7 @@
 
 #include "imgui_internal.h"
 
+#include <RepositoryIndex.h>
 #include <Util/ImGuiUtils.h>
 
 #undef min
@@ -800,82 +801,19 @@ void Editor::ItemCreatedHandler(uint32 p_Ticket, TEntityRef<IItemBase> p_NewItem
 void Editor::LoadRepositoryWeapons() {
     m_RepositoryWeapons.clear();
 
-    static TResourcePtr<ZTemplateEntityFactory> m_RepositoryResource;
+    const auto s_RepositoryIndex = SDK()->GetRepositoryIndex();
 
-    if (m_RepositoryResource.m_nResourceIndex.val == -1) {
-        const auto s_ID = ResId<"[assembly:/repository/pro.repo].pc_repo">;
-
-        Globals::ResourceManager->GetResourcePtr(m_RepositoryResource, s_ID, 0);
+    if (!s_RepositoryIndex) {
+        return;
     }
 
-    if (m_RepositoryResource.GetResourceInfo().status == RESOURCE_STATUS_VALID) {
-        const auto s_RepositoryData = static_cast<THashMap<
-            ZRepositoryID, ZDynamicObject, TDefaultHashMapPolicy<ZRepositoryID>>*>(m_RepositoryResource.
-                GetResourceData());
-
-        for (const auto& [s_RepositoryID, s_DynamicObject] : *s_RepositoryData) {
-            TArray<SDynamicObjectKeyValuePair>* s_Entries = s_DynamicObject.As<TArray<
-                SDynamicObjectKeyValuePair>>();
-
-            ZString s_Id, s_Title, s_CommonName, s_Name;
-            std::string s_FinalName;
-            bool s_HasItemType = false;
-            bool s_HasPrimaryConfiguration = false;
-
-            for (auto& s_Entry : *s_Entries) {
-                if (s_Entry.sKey == "ID_") {
-                    s_Id = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "Title") {
-                    s_Title = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "CommonName") {
-                    s_CommonName = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "Name") {
-                    s_Name = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "ItemType") {
-                    s_HasItemType = true;
-                }
-                else if (s_Entry.sKey == "PrimaryConfiguration") {
-                    s_HasPrimaryConfiguration = true;
-                }
-            }
-
-            if (s_Id.IsEmpty() || !s_HasItemType || !s_HasPrimaryConfiguration) {
-                continue;
-            }
-
-            if (s_Title.IsEmpty() && s_CommonName.IsEmpty() && s_Name.IsEmpty()) {
-                s_FinalName = std::format("<unnamed> [{}]", s_Id.c_str());
-            }
-            else if (!s_Title.IsEmpty()) {
-                s_FinalName = std::format("{} [{}]", s_Title.c_str(), s_Id.c_str());
-            }
-            else if (!s_CommonName.IsEmpty()) {
-                s_FinalName = std::format("{} [{}]", s_CommonName.c_str(), s_Id.c_str());
-            }
-            else if (!s_Name.IsEmpty()) {
-                s_FinalName = std::format("{} [{}]", s_Name.c_str(), s_Id.c_str());
-            }
+    // Weapons are already sorted by name.
+    const auto s_Weapons = s_RepositoryIndex->GetWeapons();
+    m_RepositoryWeapons.reserve(s_Weapons.size());
 
-            m_RepositoryWeapons.push_back(std::make_pair(s_Id, s_FinalName));
-        }
+    for (const uint32_t s_Index : s_Weapons) {
+        m_RepositoryWeapons.emplace_back(s_RepositoryIndex->GetId(s_Index), s_RepositoryIndex->GetDisplayName(s_Index));
     }
-
-    std::ranges::sort(
-        m_RepositoryWeapons,
-        [](const auto& a, const auto& b) {
-            auto [s_RepositoryIdA, s_NameA] = a;
-            auto [s_RepositoryIdB, s_NameB] = b;
-
-            std::ranges::transform(s_NameA, s_NameA.begin(), [](unsigned char c) { return std::tolower(c); });
-            std::ranges::transform(s_NameB, s_NameB.begin(), [](unsigned char c) { return std::tolower(c); });
-
-            return s_NameA < s_NameB;
-        }
-    );
 }
 
 void Editor::EnableTrackCam() {
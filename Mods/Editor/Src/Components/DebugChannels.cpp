@@ -448,7 +448,7 @@ void Editor::DrawGizmo(GizmoEntity& p_GizmoEntity, IRenderer* p_Renderer) {
 
     if (p_GizmoEntity.m_DebugChannel == EDebugChannel::DEBUGCHANNEL_PARTITIONING &&
         p_GizmoEntity.m_TypeName == "ZGateEntity") {
-        const bool s_IsOpen = p_GizmoEntity.m_EntityRef.GetProperty<bool>("m_bIsOpen").Get();
+        const bool s_IsOpen = p_GizmoEntity.m_EntityRef.GetProperty<bool>(PropertyId<"m_bIsOpen">).Get();
 
         if (s_IsOpen && p_GizmoEntity.m_RuntimeResourceID.GetID() !=
             ResId<"[assembly:/geometry/g2/gizmos.wl2?/gizmo_gate_01.prim].pc_prim">
@@ -467,7 +467,7 @@ void Editor::DrawGizmo(GizmoEntity& p_GizmoEntity, IRenderer* p_Renderer) {
         p_GizmoEntity.m_RuntimeResourceID.GetID() ==
         ResId<"[assembly:/geometry/g2/gizmos.wl2?/unit_circle.prim].pc_prim">
     ) {
-        const float s_Radius = p_GizmoEntity.m_EntityRef.GetProperty<float>("m_fRadius").Get();
+        const float s_Radius = p_GizmoEntity.m_EntityRef.GetProperty<float>(PropertyId<"m_fRadius">).Get();
 
         if (p_GizmoEntity.m_Transform.XAxis.x != s_Radius) {
             const float4 s_RadiusGizmoScale(s_Radius, s_Radius, s_Radius, 0.f);
@@ -619,7 +619,8 @@ void Editor::GetDebugEntities(const std::shared_ptr<EntityTreeNode>& p_EntityTre
         m_DebugEntityTypeIds[DebugEntityTypeName::DebugGizmoEntity]
     )) {
         if (EntityIDMatches(s_DebugGizmoEntity, p_EntityTreeNode->EntityId)) {
-            const ZDebugGizmoEntity_EDrawLayer s_DrawLayer = p_EntityTreeNode->Entity.GetProperty<ZDebugGizmoEntity_EDrawLayer>("m_eDrawLayer").Get();
+            const ZDebugGizmoEntity_EDrawLayer s_DrawLayer =
+                p_EntityTreeNode->Entity.GetProperty<ZDebugGizmoEntity_EDrawLayer>(PropertyId<"m_eDrawLayer">).Get();
             const EDebugChannel s_DebugChannel = ConvertDrawLayerToDebugChannel(s_DrawLayer);
 
             AddGizmoEntity(p_EntityTreeNode->Entity, "ZDebugGizmoEntity", s_DebugChannel, "m_GizmoGeomRID");
@@ -633,7 +634,7 @@ void Editor::GetDebugEntities(const std::shared_ptr<EntityTreeNode>& p_EntityTre
             const float4 s_DirectionGizmoTranslate(0.f, 0.f, 0.f, 0.f);
             const SMatrix s_DirectionGizmoTransform = SMatrix::ScaleTranslate(s_DirectionGizmoScale, s_DirectionGizmoTranslate);
 
-            const float s_Radius = p_EntityTreeNode->Entity.GetProperty<float>("m_fRadius").Get();
+            const float s_Radius = p_EntityTreeNode->Entity.GetProperty<float>(PropertyId<"m_fRadius">).Get();
             const float4 s_RadiusGizmoScale(s_Radius, s_Radius, s_Radius, 0.f);
             const float4 s_RadiusGizmoTranslate(0.f, 0.f, 0.f, 0.f);
             const SMatrix s_RadiusGizmoTransform = SMatrix::ScaleTranslate(s_RadiusGizmoScale, s_RadiusGizmoTranslate);
@@ -670,7 +671,8 @@ void Editor::GetDebugEntities(const std::shared_ptr<EntityTreeNode>& p_EntityTre
                 s_TypeName = "ZDarkLightEntity";
             }
 
-            const ILightEntity_ELightType s_LightType = p_EntityTreeNode->Entity.GetProperty<ILightEntity_ELightType>("m_eLightType").Get();
+            const ILightEntity_ELightType s_LightType =
+                p_EntityTreeNode->Entity.GetProperty<ILightEntity_ELightType>(PropertyId<"m_eLightType">).Get();
 
             switch (s_LightType) {
                 case ILightEntity_ELightType::LT_DIRECTIONAL:
@@ -1056,10 +1058,11 @@ void Editor::GetDebugEntities(const std::shared_ptr<EntityTreeNode>& p_EntityTre
                 }
 
                 const ZActBehaviorEntity_ERotationAlignment s_AlignRotation =
-                    p_EntityTreeNode->Entity.GetProperty<ZActBehaviorEntity_ERotationAlignment>("m_AlignRotation").Get();
+                    p_EntityTreeNode->Entity.GetProperty<ZActBehaviorEntity_ERotationAlignment>(PropertyId<"m_AlignRotation">).Get();
 
                 if (s_AlignRotation != ZActBehaviorEntity_ERotationAlignment::RA_NONE) {
-                    const SColorRGB s_Color = p_EntityTreeNode->Entity.GetProperty<SColorRGB>("m_Color").Get();
+                    const SColorRGB s_Color =
+                        p_EntityTreeNode->Entity.GetProperty<SColorRGB>(PropertyId<"m_Color">).Get();
                     const SVector4 s_Color2 = SVector4(s_Color.r, s_Color.g, s_Color.b, 1.f);
 
                     AddGizmoEntity(
@@ -1071,7 +1074,8 @@ void Editor::GetDebugEntities(const std::shared_ptr<EntityTreeNode>& p_EntityTre
                     );
                 }
 
-                const bool s_AlignPosition = p_EntityTreeNode->Entity.GetProperty<bool>("m_bAlignPosition").Get();
+                const bool s_AlignPosition =
+                    p_EntityTreeNode->Entity.GetProperty<bool>(PropertyId<"m_bAlignPosition">).Get();
 
                 if (s_AlignPosition) {
                     AddGizmoEntity(
@@ -1130,7 +1134,7 @@ void Editor::GetDebugEntities(const std::shared_ptr<EntityTreeNode>& p_EntityTre
             }
 
             const EWaypointRotationAlignment s_AlignRotation =
-                p_EntityTreeNode->Entity.GetProperty<EWaypointRotationAlignment>("m_AlignRotation").Get();
+                p_EntityTreeNode->Entity.GetProperty<EWaypointRotationAlignment>(PropertyId<"m_AlignRotation">).Get();
 
             if (s_AlignRotation != EWaypointRotationAlignment::RA_NONE) {
                 AddGizmoEntity(
@@ -1141,7 +1145,8 @@ void Editor::GetDebugEntities(const std::shared_ptr<EntityTreeNode>& p_EntityTre
                 );
             }
 
-            const bool s_AlignPosition = p_EntityTreeNode->Entity.GetProperty<bool>("m_bAlignPosition").Get();
+            const bool s_AlignPosition =
+                p_EntityTreeNode->Entity.GetProperty<bool>(PropertyId<"m_bAlignPosition">).Get();
 
             if (s_AlignPosition) {
                 AddGizmoEntity(
@@ -12,14 +12,101 @@
 #include <Glacier/SExternalReferences.h>
 
 #include <ResourceLib_HM3.h>
+#include <Util/JsonUtils.h>
 
+#include <charconv>
+#include <cstring>
 #include <queue>
 #include <utility>
+#include <vector>
 
 #include "Glacier/ZRoom.h"
 
 class ZEntity;
 
+namespace {
+    // Properties are set for every step of a dragged gizmo or slider, so the parser and the buffer holding
+    // the padded JSON are reused instead of being allocated for every value.
+    thread_local simdjson::ondemand::parser t_PropertyParser;
+    thread_local std::vector<char> t_PropertyJson;
+
+    std::string_view TrimJson(std::string_view p_Json) {
+        constexpr std::string_view c_Whitespace = " \t\r\n";
+
+        const auto s_Begin = p_Json.find_first_not_of(c_Whitespace);
+
+        if (s_Begin == std::string_view::npos) {
+            return {};
+        }
+
+        p_Json.remove_prefix(s_Begin);
+        p_Json.remove_suffix(p_Json.size() - p_Json.find_last_not_of(c_Whitespace) - 1);
+
+        return p_Json;
+    }
+
+    bool ReadFloat32(const std::string_view p_Json, float32& p_Value) {
+        const std::string_view s_Json = TrimJson(p_Json);
+
+        // from_chars also accepts inf and nan, which aren't valid JSON.
+        if (s_Json.empty() || (s_Json[0] != '-' && (s_Json[0] < '0' || s_Json[0] > '9'))) {
+            return false;
+        }
+
+        double s_Value;
+        const char* s_End = s_Json.data() + s_Json.size();
+        const auto [s_Ptr, s_Error] = std::from_chars(s_Json.data(), s_End, s_Value);
+
+        if (s_Error != std::errc() || s_Ptr != s_End) {
+            return false;
+        }
+
+        p_Value = static_cast<float32>(s_Value);
+
+        return true;
+    }
+
+    bool ReadBool(const std::string_view p_Json, bool& p_Value) {
+        const std::string_view s_Json = TrimJson(p_Json);
+
+        if (s_Json == "true") {
+            p_Value = true;
+            return true;
+        }
+
+        if (s_Json == "false") {
+            p_Value = false;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool ReadVector3(simdjson::ondemand::object p_Object, SVector3& p_Value) {
+        double x, y, z;
+
+        if (p_Object["x"].get_double().get(x) ||
+            p_Object["y"].get_double().get(y) ||
+            p_Object["z"].get_double().get(z)) {
+            return false;
+        }
+
+        p_Value = SVector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+
+        return true;
+    }
+
+    bool ReadVector3(simdjson::ondemand::object p_Object, const std::string_view p_Key, SVector3& p_Value) {
+        simdjson::ondemand::object s_Vector;
+
+        if (p_Object[p_Key].get_object().get(s_Vector)) {
+            return false;
+        }
+
+        return ReadVector3(s_Vector, p_Value);
+    }
+}
+
 ZEntityRef Editor::FindEntity(EntitySelector p_Selector) {
     std::shared_lock s_Lock(m_CachedEntityTreeMutex);
 
@@ -700,9 +787,9 @@ void Editor::SetEntityProperty(
             }
             else {
                 // Parse EntitySelector
-                simdjson::ondemand::parser s_Parser;
-                const auto s_EntitySelectorJson = simdjson::padded_string(p_JsonValue);
-                simdjson::ondemand::document s_EntitySelectorMsg = s_Parser.iterate(s_EntitySelectorJson);
+                simdjson::ondemand::document s_EntitySelectorMsg = t_PropertyParser.iterate(
+                    Util::JsonUtils::PadJson(p_JsonValue, t_PropertyJson)
+                );
 
                 const auto s_EntitySelector = EditorServer::ReadEntitySelector(s_EntitySelectorMsg);
 
@@ -721,6 +808,12 @@ void Editor::SetEntityProperty(
                 }
             }
         }
+        else if (ZObjectRef s_Value;
+            TryReadPropertyValue(s_PropertyInfo->m_propertyInfo.m_Type, p_JsonValue, s_Value)) {
+            OnSetPropertyValue(
+                s_Entity, p_PropertyId, s_Value, std::move(p_ClientId)
+            );
+        }
         else {
             const uint16_t s_TypeSize = s_PropertyInfo->m_propertyInfo.m_Type->GetTypeInfo()->m_nTypeSize;
             const uint16_t s_TypeAlignment = s_PropertyInfo->m_propertyInfo.m_Type->GetTypeInfo()->m_nTypeAlignment;
@@ -757,6 +850,106 @@ void Editor::SetEntityProperty(
     }
 }
 
+bool Editor::TryReadPropertyValue(STypeID* p_Type, const std::string_view p_JsonValue, ZObjectRef& p_Value) {
+    const std::string_view s_TypeName = p_Type->GetTypeInfo()->pszTypeName;
+
+    if (s_TypeName == ZHMTypeName<float32>) {
+        float32 s_Float;
+
+        if (!ReadFloat32(p_JsonValue, s_Float)) {
+            return false;
+        }
+
+        p_Value.Assign(p_Type, &s_Float);
+        return true;
+    }
+
+    if (s_TypeName == ZHMTypeName<bool>) {
+        bool s_Bool;
+
+        if (!ReadBool(p_JsonValue, s_Bool)) {
+            return false;
+        }
+
+        p_Value.Assign(p_Type, &s_Bool);
+        return true;
+    }
+
+    if (s_TypeName != ZHMTypeName<ZString> &&
+        s_TypeName != ZHMTypeName<SVector3> &&
+        s_TypeName != ZHMTypeName<SMatrix43>) {
+        return false;
+    }
+
+    simdjson::ondemand::document s_Document;
+
+    if (t_PropertyParser.iterate(Util::JsonUtils::PadJson(p_JsonValue, t_PropertyJson)).get(s_Document)) {
+        return false;
+    }
+
+    if (s_TypeName == ZHMTypeName<ZString>) {
+        std::string_view s_String;
+
+        if (s_Document.get_string().get(s_String)) {
+            return false;
+        }
+
+        // The string view points into the parser, so the value needs its own copy.
+        ZString s_Value = ZString::AllocateFromCStr(s_String.data(), static_cast<uint32_t>(s_String.size()));
+
+        p_Value.Assign(p_Type, &s_Value);
+        return true;
+    }
+
+    simdjson::ondemand::object s_Object;
+
+    if (s_Document.get_object().get(s_Object)) {
+        return false;
+    }
+
+    if (s_TypeName == ZHMTypeName<SVector3>) {
+        SVector3 s_Vector;
+
+        if (!ReadVector3(s_Object, s_Vector)) {
+            return false;
+        }
+
+        p_Value.Assign(p_Type, &s_Vector);
+        return true;
+    }
+
+    // ResourceLib represents matrices as a position, a rotation in degrees and an optional scale, like QN does.
+    QneTransform s_Transform {
+        .Scale = {1.f, 1.f, 1.f},
+    };
+
+    if (!ReadVector3(s_Object, "rotation", s_Transform.Rotation) ||
+        !ReadVector3(s_Object, "position", s_Transform.Position)) {
+        return false;
+    }
+
+    simdjson::ondemand::value s_Scale;
+
+    if (const auto s_Error = s_Object["scale"].get(s_Scale); s_Error != simdjson::NO_SUCH_FIELD) {
+        simdjson::ondemand::object s_ScaleObject;
+
+        if (s_Error || s_Scale.get_object().get(s_ScaleObject) || !ReadVector3(s_ScaleObject, s_Transform.Scale)) {
+            return false;
+        }
+    }
+
+    const SMatrix s_Matrix = QneTransformToMatrix(s_Transform);
+
+    SMatrix43 s_Matrix43;
+    s_Matrix43.XAxis = SVector3(s_Matrix.XAxis);
+    s_Matrix43.YAxis = SVector3(s_Matrix.YAxis);
+    s_Matrix43.ZAxis = SVector3(s_Matrix.ZAxis);
+    s_Matrix43.Trans = SVector3(s_Matrix.Trans);
+
+    p_Value.Assign(p_Type, &s_Matrix43);
+    return true;
+}
+
 void Editor::SignalEntityPin(EntitySelector p_Selector, uint32_t p_PinId, bool p_Output) {
     if (const auto s_Entity = FindEntity(p_Selector)) {
         OnSignalEntityPin(s_Entity, p_PinId, p_Output);
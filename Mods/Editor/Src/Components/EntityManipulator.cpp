@@ -102,7 +102,8 @@ void Editor::DrawEntityManipulator(bool p_HasFocus) {
                     const auto s_GeomEntity = s_SelectedEntity.QueryInterface<ZGeomEntity>();
 
                     if (s_GeomEntity) {
-                        ZVariant<SVector3> s_Scale = m_SelectedEntity.GetProperty<SVector3>("m_PrimitiveScale");
+                        ZVariant<SVector3> s_Scale =
+                            m_SelectedEntity.GetProperty<SVector3>(PropertyId<"m_PrimitiveScale">);
 
                         s_ModelMatrix.ScaleTransform(s_Scale.Get());
 
@@ -111,13 +112,16 @@ void Editor::DrawEntityManipulator(bool p_HasFocus) {
                             &s_ViewMatrix.XAxis.x, &s_ProjectionMatrix.XAxis.x, m_GizmoMode, m_GizmoSpace,
                             &s_ModelMatrix.XAxis.x, NULL, m_UseScaleSnap ? &s_ScaleSnapValue : NULL
                         )) {
-                            m_SelectedEntity.SetProperty<SVector3>("m_PrimitiveScale", s_ModelMatrix.GetScale());
+                            m_SelectedEntity.SetProperty<SVector3>(
+                                PropertyId<"m_PrimitiveScale">, s_ModelMatrix.GetScale()
+                            );
 
-                            const bool s_bRemovePhysics = m_SelectedEntity.GetProperty<bool>("m_bRemovePhysics").Get();
+                            const bool s_bRemovePhysics =
+                                m_SelectedEntity.GetProperty<bool>(PropertyId<"m_bRemovePhysics">).Get();
 
                             if (!s_bRemovePhysics) {
-                                m_SelectedEntity.SetProperty<bool>("m_bRemovePhysics", true);
-                                m_SelectedEntity.SetProperty<bool>("m_bRemovePhysics", false);
+                                m_SelectedEntity.SetProperty<bool>(PropertyId<"m_bRemovePhysics">, true);
+                                m_SelectedEntity.SetProperty<bool>(PropertyId<"m_bRemovePhysics">, false);
                             }
                         }
                     }
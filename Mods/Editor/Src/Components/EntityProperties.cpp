@@ -1,4 +1,5 @@
 #include <Editor.h>
+#include <algorithm>
 #include <numbers>
 
 #include "Functions.h"
@@ -461,7 +462,7 @@ void Editor::DrawEntityProperties() {
             }
         }
 
-        auto s_InputPins = GetPins(s_SelectedEntity, false);
+        const auto& s_InputPins = GetPins(s_SelectedEntity, false);
 
         ImGui::SameLine(0, 5);
 
@@ -596,7 +597,7 @@ void Editor::DrawEntityProperties() {
             }
         }
 
-        auto s_OutputPins = GetPins(s_SelectedEntity, true);
+        const auto& s_OutputPins = GetPins(s_SelectedEntity, true);
 
         ImGui::SameLine(0, 5);
 
@@ -802,6 +803,17 @@ void Editor::DrawEntityProperties() {
         const auto s_EntityType = s_SelectedEntity->GetType();
 
         if (s_EntityType && s_EntityType->m_pPropertyData) {
+            // Heights are measured whenever a row is drawn. Rows with a known height that are outside the window
+            // are replaced with empty space, which skips reading and formatting their values.
+            if (m_PropertyRowHeightsEntity != s_SelectedEntity.m_pObj) {
+                m_PropertyRowHeights.clear();
+                m_PropertyRowHeightsEntity = s_SelectedEntity.m_pObj;
+            }
+
+            m_PropertyRowHeights.resize(s_EntityType->m_pPropertyData->size(), 0.f);
+
+            const float s_ItemSpacing = ImGui::GetStyle().ItemSpacing.y;
+
             for (uint32_t i = 0; i < s_EntityType->m_pPropertyData->size(); ++i) {
                 SPropertyData* s_Property = &(*s_EntityType->m_pPropertyData)[i];
                 const auto* s_PropertyInfo = s_Property->GetPropertyInfo();
@@ -809,6 +821,19 @@ void Editor::DrawEntityProperties() {
                 if (!s_PropertyInfo || !s_PropertyInfo->m_propertyInfo.m_Type)
                     continue;
 
+                const float s_RowStart = ImGui::GetCursorPosY();
+                const float s_RowHeight = m_PropertyRowHeights[i];
+
+                if (s_RowHeight > 0.f) {
+                    const ImVec2 s_RowMin = ImGui::GetCursorScreenPos();
+                    const ImVec2 s_RowMax(s_RowMin.x + ImGui::GetContentRegionAvail().x, s_RowMin.y + s_RowHeight);
+
+                    if (!ImGui::IsRectVisible(s_RowMin, s_RowMax)) {
+                        ImGui::Dummy(ImVec2(0.f, std::max(s_RowHeight - s_ItemSpacing, 0.f)));
+                        continue;
+                    }
+                }
+
                 const auto s_PropertyAddress = reinterpret_cast<uintptr_t>(s_SelectedEntity.m_pObj) + s_Property->
                     m_nPropertyOffset;
                 const uint16_t s_TypeSize = s_PropertyInfo->m_propertyInfo.m_Type->GetTypeInfo()->m_nTypeSize;
@@ -920,6 +945,8 @@ void Editor::DrawEntityProperties() {
 
                 ImGui::Separator();
 
+                m_PropertyRowHeights[i] = ImGui::GetCursorPosY() - s_RowStart;
+
                 // Free the property data.
                 (*Globals::MemoryManager)->m_pNormalAllocator->Free(s_Data);
             }
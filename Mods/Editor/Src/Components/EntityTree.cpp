@@ -432,31 +432,101 @@ void Editor::ReparentDynamicOutfitEntities(
     }
 }
 
-void Editor::RenderEntity(std::shared_ptr<EntityTreeNode> p_Node) {
-    if (!p_Node) return;
-
-    if (
-        (!m_EntityIdSearchInput.empty() ||
+bool Editor::IsEntityTreeFiltered() const {
+    return !m_EntityIdSearchInput.empty() ||
             !m_EntityTypeSearchInput.empty() ||
             !m_EntityNameSearchInput.empty() ||
-            m_EntityViewMode != EntityViewMode::All) &&
-        !m_FilteredEntityTreeNodes.contains(p_Node.get())
-    ) {
+            m_EntityViewMode != EntityViewMode::All;
+}
+
+void Editor::AddEntityTreeRows(EntityTreeNode* p_Node, const uint32_t p_Depth) {
+    if (IsEntityTreeFiltered() && !m_FilteredEntityTreeNodes.contains(p_Node)) {
+        return;
+    }
+
+    m_EntityTreeRows.push_back({p_Node, p_Depth});
+
+    // Nodes that are being deleted are always shown collapsed.
+    if (p_Node->IsPendingDeletion || !m_ExpandedEntityTreeNodes.contains(p_Node->Entity)) {
         return;
     }
 
-    ImGui::PushID(p_Node.get());
+    for (const auto& [_, s_Child] : p_Node->Children) {
+        AddEntityTreeRows(s_Child.get(), p_Depth + 1);
+    }
+}
+
+bool Editor::ExpandEntityTreePath(EntityTreeNode* p_Node, const ZEntityRef& p_Entity) {
+    if (IsEntityTreeFiltered() && !m_FilteredEntityTreeNodes.contains(p_Node)) {
+        return false;
+    }
+
+    if (p_Node->Entity == p_Entity) {
+        return true;
+    }
+
+    for (const auto& [_, s_Child] : p_Node->Children) {
+        if (ExpandEntityTreePath(s_Child.get(), p_Entity)) {
+            m_ExpandedEntityTreeNodes.insert(p_Node->Entity);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Editor::RenderEntityTree() {
+    if (m_ScrollToEntity && m_SelectedEntity) {
+        ExpandEntityTreePath(m_CachedEntityTree.get(), m_SelectedEntity);
+    }
+
+    // Flattening only visits expanded nodes, so it's cheap compared to submitting widgets for every row. It's
+    // redone every frame because the tree is changed in place when entities are spawned or destroyed.
+    m_EntityTreeRows.clear();
+    AddEntityTreeRows(m_CachedEntityTree.get(), 0);
+
+    int s_SelectedRow = -1;
+
+    if (m_ScrollToEntity && m_SelectedEntity) {
+        for (size_t i = 0; i < m_EntityTreeRows.size(); ++i) {
+            if (m_EntityTreeRows[i].m_Node->Entity == m_SelectedEntity) {
+                s_SelectedRow = static_cast<int>(i);
+                break;
+            }
+        }
+    }
+
+    // Only the rows inside the scroll window are submitted.
+    ImGuiListClipper s_Clipper;
+    s_Clipper.Begin(static_cast<int>(m_EntityTreeRows.size()));
+
+    if (s_SelectedRow != -1) {
+        s_Clipper.IncludeItemByIndex(s_SelectedRow);
+    }
+
+    while (s_Clipper.Step()) {
+        for (int i = s_Clipper.DisplayStart; i < s_Clipper.DisplayEnd; ++i) {
+            RenderEntityTreeRow(m_EntityTreeRows[i]);
+        }
+    }
 
-    const auto s_Entity = p_Node->Entity;
-    const auto s_EntityType = p_Node->EntityType;
-    const auto s_EntityName = p_Node->Name;
+    s_Clipper.End();
+}
+
+void Editor::RenderEntityTreeRow(const EntityTreeRow& p_Row) {
+    EntityTreeNode* s_Node = p_Row.m_Node;
+
+    ImGui::PushID(s_Node);
+
+    const auto s_Entity = s_Node->Entity;
     const auto s_IsSelected = s_Entity == m_SelectedEntity;
+    const bool s_IsPendingDeletion = s_Node->IsPendingDeletion;
 
     ImGuiTreeNodeFlags s_Flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick |
-            ImGuiTreeNodeFlags_SpanAvailWidth;
+            ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_NoTreePushOnOpen;
 
-    if (p_Node->Children.empty()) {
-        s_Flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    if (s_Node->Children.empty()) {
+        s_Flags |= ImGuiTreeNodeFlags_Leaf;
     }
 
     if (s_IsSelected) {
@@ -467,45 +537,38 @@ void Editor::RenderEntity(std::shared_ptr<EntityTreeNode> p_Node) {
             m_ScrollToEntity = false;
         }
     }
-    else if (m_ScrollToEntity && m_SelectedEntity) {
-        bool s_ShouldExpandNode = false;
 
-        if (s_Entity && m_SelectedEntity.IsAnyParent(s_Entity)) {
-            s_ShouldExpandNode = true;
-        }
-        else if (s_Entity == m_DynamicEntitiesNodeEntityRef ||
-            s_Entity == m_UnparentedEntitiesNodeEntityRef
-        ) {
-            for (const auto& [_, s_Child] : p_Node->Children) {
-                if (s_Child->Entity == m_SelectedEntity ||
-                    (s_Child->Entity && m_SelectedEntity.IsAnyParent(s_Child->Entity))) {
-                    s_ShouldExpandNode = true;
-                    break;
-                }
-            }
-        }
+    // Rows are submitted flat, so indent them ourselves instead of through TreePush.
+    ImGui::SetCursorPosX(ImGui::GetCursorPosX() + static_cast<float>(p_Row.m_Depth) * ImGui::GetStyle().IndentSpacing);
 
-        if (s_ShouldExpandNode) {
-            ImGui::SetNextItemOpen(true);
-        }
-    }
+    const bool s_IsExpanded = !s_IsPendingDeletion && m_ExpandedEntityTreeNodes.contains(s_Entity);
+
+    ImGui::SetNextItemOpen(s_IsExpanded);
 
-    if (p_Node->IsPendingDeletion) {
-        ImGui::SetNextItemOpen(false);
+    if (s_IsPendingDeletion) {
         ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.6f, 0.6f, 0.6f, 1.0f));
         ImGui::BeginDisabled();
     }
 
-    auto s_Open = ImGui::TreeNodeEx(
-        s_EntityName.c_str(),
+    const bool s_Open = ImGui::TreeNodeEx(
+        s_Node->Name.c_str(),
         s_Flags
     );
 
     if (ImGui::IsItemHovered()) {
-        ImGui::SetTooltip("%s", s_EntityType.c_str());
+        ImGui::SetTooltip("%s", s_Node->EntityType.c_str());
     }
 
-    if (!p_Node->IsPendingDeletion) {
+    if (!s_IsPendingDeletion) {
+        if (s_Open != s_IsExpanded) {
+            if (s_Open) {
+                m_ExpandedEntityTreeNodes.insert(s_Entity);
+            }
+            else {
+                m_ExpandedEntityTreeNodes.erase(s_Entity);
+            }
+        }
+
         if (ImGui::IsItemFocused() && !s_IsSelected) {
             if (ImGui::IsKeyPressed(ImGuiKey_Enter) || ImGui::IsKeyPressed(ImGuiKey_Space))
                 OnSelectEntity(s_Entity, false, std::nullopt);
@@ -516,17 +579,7 @@ void Editor::RenderEntity(std::shared_ptr<EntityTreeNode> p_Node) {
         }
     }
 
-    if (s_Open) {
-        for (const auto& s_Child : p_Node->Children) {
-            RenderEntity(s_Child.second);
-        }
-
-        if (!(s_Flags & ImGuiTreeNodeFlags_NoTreePushOnOpen)) {
-            ImGui::TreePop();
-        }
-    }
-
-    if (p_Node->IsPendingDeletion) {
+    if (s_IsPendingDeletion) {
         ImGui::EndDisabled();
         ImGui::PopStyleColor();
     }
@@ -748,9 +801,12 @@ void Editor::DrawEntityTree() {
             std::shared_lock lock(m_CachedEntityTreeMutex);
 
             if (m_CachedEntityTree) {
-                RenderEntity(m_CachedEntityTree);
+                RenderEntityTree();
             }
             else {
+                // The scene was unloaded, so none of the expanded entities exist anymore.
+                m_ExpandedEntityTreeNodes.clear();
+
                 ImGui::Text("No entities loaded. You may want to press the 'Rebuild entity tree' button.");
             }
         }
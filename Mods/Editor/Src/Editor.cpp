@@ -372,8 +372,8 @@ void Editor::OnDrawUI(bool p_HasFocus) {
         const auto s_RT = reinterpret_cast<ZRenderDestination*>(m_EditorCameraRT.m_pInterfaceRef->
             GetRenderDestination());
 
-        m_EditorCameraRT.m_entityRef.SetProperty("m_bVisible", true);
-        m_EditorCamera.m_entityRef.SetProperty("m_bVisible", true);
+        m_EditorCameraRT.m_entityRef.SetProperty(PropertyId<"m_bVisible">, true);
+        m_EditorCamera.m_entityRef.SetProperty(PropertyId<"m_bVisible">, true);
 
         if (s_RT)
             SDK()->ImGuiGameRenderTarget(s_RT);
@@ -423,7 +423,6 @@ void Editor::DrawSettings(const bool p_HasFocus) {
 }
 
 void Editor::OnFrameUpdate(const SGameUpdateEvent& p_UpdateEvent) {
-    ProcessTasks();
     if (m_TrackCamActive) {
         if (!*Globals::ApplicationEngineWin32)
             return;
@@ -523,184 +522,138 @@ void Editor::OnFrameUpdate(const SGameUpdateEvent& p_UpdateEvent) {
         m_RemoveItemFromInventory = false;
     }
 
-    static std::future<std::map<std::string, PinLists>> s_DownloadFuture;
-    static bool s_DownloadStarted = false;
-    static bool s_DownloadCompleted = false;
+    static std::future<std::shared_ptr<const PinDatabase>> s_PinDatabaseFuture;
+    static bool s_PinDatabaseRequested = false;
 
-    if (m_ClassToInputAndOutputPins.empty() && !s_DownloadStarted) {
-        const std::string s_PinsUrl =
-            "https://raw.githubusercontent.com/glacier-modding/glaciermodding.org"
-            "/refs/heads/main/docs/modding/hitman/guides/pins.json";
-
-        s_DownloadFuture = std::async(
-            std::launch::async, [this, s_PinsUrl]() {
-                std::string jsonContent = Util::HttpUtils::DownloadFromUrl(s_PinsUrl);
-
-                if (!jsonContent.empty()) {
-                    return ParsePinsJson(jsonContent);
-                }
-
-                return std::map<std::string, PinLists>();
-            }
-        );
-
-        s_DownloadStarted = true;
-    }
-
-    if (s_DownloadStarted && !s_DownloadCompleted) {
-        if (s_DownloadFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
-            m_ClassToInputAndOutputPins = s_DownloadFuture.get();
-            s_DownloadCompleted = true;
-            Logger::Debug("Pin list download complete! Loaded {} classes.", m_ClassToInputAndOutputPins.size());
-        }
-    }
-}
-
-void Editor::ProcessTasks() {
-    std::vector<std::function<void()>> tasksToRun;
-
-    {
-        std::lock_guard lock(m_TaskMutex);
-        if (m_TaskQueue.empty()) {
-            return;
-        }
-        tasksToRun.swap(m_TaskQueue);
+    if (!s_PinDatabaseRequested) {
+        s_PinDatabaseFuture = std::async(std::launch::async, &Editor::LoadPinDatabase);
+        s_PinDatabaseRequested = true;
     }
 
-    for (const auto& task : tasksToRun) {
-        task();
+    if (s_PinDatabaseFuture.valid() &&
+        s_PinDatabaseFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        m_PinDatabase.store(s_PinDatabaseFuture.get());
+        Logger::Debug("Pin list loaded! Loaded {} classes.", m_PinDatabase.load()->GetClassCount());
     }
 }
 
 void Editor::QueueTask(std::function<void()> p_Task) {
-    std::lock_guard lock(m_TaskMutex);
-    m_TaskQueue.push_back(std::move(p_Task));
+    QueueMainThreadTask(std::move(p_Task));
 }
 
-std::vector<Editor::PinInfo> Editor::GetPins(ZEntityRef p_EntityRef, bool outputPins) {
-    std::vector<PinInfo> s_Result;
+const std::vector<Editor::PinInfo>& Editor::GetPins(ZEntityRef p_EntityRef, bool outputPins) {
+    PinListCache& s_Cache = outputPins ? m_OutputPinCache : m_InputPinCache;
+    std::shared_ptr<const PinDatabase> s_Database = m_PinDatabase.load();
 
-    if (!p_EntityRef || !p_EntityRef->GetType()->m_pInterfaceData) {
-        return s_Result;
+    if (!p_EntityRef || !p_EntityRef->GetType()->m_pInterfaceData || !s_Database) {
+        s_Cache = {};
+        return s_Cache.m_Pins;
     }
 
-    TArray<SInterfaceData>* s_Interfaces = p_EntityRef->GetType()->m_pInterfaceData;
+    const ZEntityType* s_EntityType = p_EntityRef->GetType();
+    const TArray<SInterfaceData>* s_Interfaces = s_EntityType->m_pInterfaceData;
 
-    std::unordered_set<std::string> s_PinNames;
+    // This is called every frame for the selected entity, so only merge the pins when the entity type changes.
+    // The database is kept alive by the cache, so a new one can't end up at the same address.
+    if (s_Cache.m_Database == s_Database &&
+        s_Cache.m_EntityType == s_EntityType &&
+        s_Cache.m_Interfaces == s_Interfaces &&
+        s_Cache.m_InterfaceCount == s_Interfaces->size()) {
+        return s_Cache.m_Pins;
+    }
 
-    for (const SInterfaceData& s_InterfaceData : *s_Interfaces)
-    {
+    std::vector<const PinInfo*> s_Pins;
+
+    for (const SInterfaceData& s_InterfaceData : *s_Interfaces) {
         const IType* s_TypeInfo = s_InterfaceData.m_Type->GetTypeInfo();
 
         if (!s_TypeInfo) {
             continue;
         }
 
-        const std::string s_ClassName = Util::StringUtils::ToLowerCase(s_TypeInfo->pszTypeName);
-
-        auto s_Iterator = m_ClassToInputAndOutputPins.find(s_ClassName);
-
-        if (s_Iterator == m_ClassToInputAndOutputPins.end()) {
-            continue;
+        for (const PinInfo& s_Pin : s_Database->GetPins(s_TypeInfo->pszTypeName, outputPins)) {
+            s_Pins.push_back(&s_Pin);
         }
+    }
 
-        const auto& s_Pins = outputPins ? s_Iterator->second.outputPins : s_Iterator->second.inputPins;
-
-        for (const auto& s_Pin : s_Pins) {
-            if (s_PinNames.insert(s_Pin.name).second) {
-                s_Result.push_back(s_Pin);
-            }
+    // Interfaces can share pins. Like before, the first interface that has a pin wins.
+    std::ranges::stable_sort(
+        s_Pins, [](const PinInfo* p_A, const PinInfo* p_B) {
+            return p_A->name < p_B->name;
         }
-    }
+    );
 
-    std::sort(
-        s_Result.begin(),
-        s_Result.end(),
-        [](const PinInfo& p_A, const PinInfo& p_B) {
-            return p_A.name < p_B.name;
+    const auto s_Duplicates = std::ranges::unique(
+        s_Pins, [](const PinInfo* p_A, const PinInfo* p_B) {
+            return p_A->name == p_B->name;
         }
     );
 
-    return s_Result;
-}
+    s_Pins.erase(s_Duplicates.begin(), s_Duplicates.end());
 
-std::map<std::string, Editor::PinLists> Editor::ParsePinsJson(const std::string& p_PinsJson) {
-    std::map<std::string, PinLists> result;
+    s_Cache.m_Database = std::move(s_Database);
+    s_Cache.m_EntityType = s_EntityType;
+    s_Cache.m_Interfaces = s_Interfaces;
+    s_Cache.m_InterfaceCount = s_Interfaces->size();
+    s_Cache.m_Pins.clear();
+    s_Cache.m_Pins.reserve(s_Pins.size());
 
-    simdjson::ondemand::parser parser;
-    simdjson::padded_string json = simdjson::padded_string(p_PinsJson);
+    for (const PinInfo* s_Pin : s_Pins) {
+        s_Cache.m_Pins.push_back(*s_Pin);
+    }
 
-    simdjson::ondemand::document doc = parser.iterate(json);
-    simdjson::ondemand::array entries = doc.get_array();
+    return s_Cache.m_Pins;
+}
 
-    for (auto entry : entries)
-    {
-        std::string_view path = entry["path"].get_string();
+std::filesystem::path Editor::GetPinDatabaseCachePath() {
+    char s_ExePathStr[MAX_PATH] {};
 
-        // extract class name
-        std::string className;
-        {
-            size_t start = path.find('/');
-            size_t end = path.find(".class");
+    GetModuleFileNameA(nullptr, s_ExePathStr, MAX_PATH);
 
-            if (start != std::string_view::npos && end != std::string_view::npos && end > start)
-                className = std::string(path.substr(start + 1, end - start - 1));
-        }
+    std::filesystem::path s_ExePath(s_ExePathStr);
 
-        if (className.empty())
-            continue;
+    return s_ExePath.parent_path() / "editor_pins_cache.bin";
+}
 
-        auto& pins = result[className];
+std::shared_ptr<const PinDatabase> Editor::LoadPinDatabase() {
+    // pins.json rarely changes, so the cache is only refreshed once in a while.
+    constexpr auto c_MaxCacheAge = std::chrono::days(7);
 
-        // INPUT PINS
-        simdjson::ondemand::array inputPins = entry["in"].get_array();
+    const std::filesystem::path s_CachePath = GetPinDatabaseCachePath();
 
-        for (auto pinEntry : inputPins)
-        {
-            std::string_view pinName = pinEntry["pin"].get_string();
-            std::string_view description = pinEntry["description"].get_string();
+    auto s_CachedDatabase = std::make_shared<PinDatabase>();
+    const bool s_HasCache = s_CachedDatabase->Load(s_CachePath);
 
-            pins.inputPins.push_back({
-                std::string(pinName),
-                std::string(description)
-                });
+    if (s_HasCache) {
+        std::error_code s_ErrorCode;
+        const auto s_LastWriteTime = std::filesystem::last_write_time(s_CachePath, s_ErrorCode);
+
+        if (!s_ErrorCode && std::filesystem::file_time_type::clock::now() - s_LastWriteTime < c_MaxCacheAge) {
+            return s_CachedDatabase;
         }
+    }
 
-        // OUTPUT PINS
-        simdjson::ondemand::array outputPins = entry["out"].get_array();
+    const std::string s_PinsUrl =
+        "https://raw.githubusercontent.com/glacier-modding/glaciermodding.org"
+        "/refs/heads/main/docs/modding/hitman/guides/pins.json";
 
-        for (auto pinEntry : outputPins)
-        {
-            std::string_view pinName = pinEntry["pin"].get_string();
-            std::string_view description = pinEntry["description"].get_string();
+    const std::string s_PinsJson = Util::HttpUtils::DownloadFromUrl(s_PinsUrl);
 
-            pins.outputPins.push_back({
-                std::string(pinName),
-                std::string(description)
-                });
+    auto s_Database = std::make_shared<PinDatabase>();
+
+    if (s_PinsJson.empty() || !s_Database->Parse(s_PinsJson)) {
+        if (s_HasCache) {
+            Logger::Warn("Could not download the pin list. Using the cached one instead.");
         }
-    }
 
-    for (auto& [className, pins] : result)
-    {
-        std::sort(
-            pins.inputPins.begin(),
-            pins.inputPins.end(),
-            [](const PinInfo& a, const PinInfo& b) {
-                return a.name < b.name;
-            }
-        );
+        return s_CachedDatabase;
+    }
 
-        std::sort(
-            pins.outputPins.begin(),
-            pins.outputPins.end(),
-            [](const PinInfo& a, const PinInfo& b) {
-                return a.name < b.name;
-            }
-        );
+    if (!s_Database->Save(s_CachePath)) {
+        Logger::Warn("Could not save the pin list to '{}'.", s_CachePath.string());
     }
 
-    return result;
+    return s_Database;
 }
 
 void Editor::OnMouseDown(SVector2 p_Pos, bool p_FirstClick) {
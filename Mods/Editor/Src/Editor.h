@@ -2,6 +2,9 @@
 
 #include <WinSock2.h>
 
+#include <atomic>
+#include <filesystem>
+#include <memory>
 #include <random>
 #include <unordered_map>
 #include <map>
@@ -18,6 +21,7 @@
 #include "EditorServer.h"
 #include "EntityTreeNode.h"
 #include "NavKit.h"
+#include "PinDatabase.h"
 
 struct QneTransform {
     SVector3 Position;
@@ -97,14 +101,15 @@ private:
         SMatrix m_Transform;
     };
 
-    struct PinInfo {
-        std::string name;
-        std::string description;
-    };
+    using PinInfo = PinDatabase::PinInfo;
 
-    struct PinLists {
-        std::vector<PinInfo> inputPins;
-        std::vector<PinInfo> outputPins;
+    // The merged pins of the interfaces of the last entity type they were requested for.
+    struct PinListCache {
+        std::shared_ptr<const PinDatabase> m_Database;
+        const ZEntityType* m_EntityType = nullptr;
+        const TArray<SInterfaceData>* m_Interfaces = nullptr;
+        size_t m_InterfaceCount = 0;
+        std::vector<PinInfo> m_Pins;
     };
 
     void SpawnCameras();
@@ -141,7 +146,17 @@ private:
 
     void DrawSettings(bool p_HasFocus);
 
-    void RenderEntity(std::shared_ptr<EntityTreeNode> p_Node);
+    // A visible row of the entity tree.
+    struct EntityTreeRow {
+        EntityTreeNode* m_Node;
+        uint32_t m_Depth;
+    };
+
+    bool IsEntityTreeFiltered() const;
+    void AddEntityTreeRows(EntityTreeNode* p_Node, uint32_t p_Depth);
+    bool ExpandEntityTreePath(EntityTreeNode* p_Node, const ZEntityRef& p_Entity);
+    void RenderEntityTree();
+    void RenderEntityTreeRow(const EntityTreeRow& p_Row);
     void DrawEntityTree();
     void FilterEntityTree();
     bool FilterEntityTree(EntityTreeNode* p_Node);
@@ -268,6 +283,17 @@ private:
 
     static SMatrix QneTransformToMatrix(const QneTransform& p_Transform);
 
+    /**
+     * Convert the JSON value of a property of a common type (float32, bool, ZString, SVector3 and SMatrix43)
+     * without going through ResourceLib.
+     * @param p_Type The type of the property.
+     * @param p_JsonValue The value, in the format ResourceLib uses for the type.
+     * @param p_Value Receives the converted value.
+     * @return False if the type isn't one of the above or the value couldn't be read, in which case it should be
+     *         converted by ResourceLib instead.
+     */
+    static bool TryReadPropertyValue(STypeID* p_Type, std::string_view p_JsonValue, ZObjectRef& p_Value);
+
     static std::string FormatFloat(float p_Value, bool p_Round, uint32_t p_Decimals);
 
     void DrawItems(bool p_HasFocus);
@@ -325,11 +351,19 @@ private:
 
     static bool IsActorTarget(ZActor* p_Actor);
 
-    void ProcessTasks();
+    /**
+     * Get the pins of all interfaces of an entity, sorted by name.
+     * The result is cached until pins are requested for an entity of another type.
+     */
+    const std::vector<PinInfo>& GetPins(ZEntityRef p_EntityRef, bool outputPins);
 
-    std::vector<PinInfo> GetPins(ZEntityRef p_EntityRef, bool outputPins);
+    static std::filesystem::path GetPinDatabaseCachePath();
 
-    std::map<std::string, PinLists> ParsePinsJson(const std::string& p_PinsJson);
+    /**
+     * Load the pin database from the local cache. If there's no cache or it's outdated, download pins.json
+     * and update the cache. Falls back to an outdated cache if the download fails.
+     */
+    static std::shared_ptr<const PinDatabase> LoadPinDatabase();
 
 private:
     DECLARE_PLUGIN_DETOUR(Editor, bool, OnLoadScene, ZEntitySceneContext*, SSceneInitParameters&);
@@ -494,6 +528,15 @@ private:
     std::unordered_set<EntityTreeNode*> m_FilteredEntityTreeNodes;
     std::vector<EntityTreeNode*> m_DirectEntityTreeNodeMatches;
 
+    // Which nodes of the entity tree are expanded, instead of relying on ImGui's state, so the tree can be
+    // flattened into rows and only the visible ones drawn. Keyed by entity so it survives tree rebuilds.
+    std::unordered_set<ZEntityRef> m_ExpandedEntityTreeNodes;
+    std::vector<EntityTreeRow> m_EntityTreeRows;
+
+    // The height of every property row of the selected entity, so rows outside the window can be skipped.
+    std::vector<float> m_PropertyRowHeights;
+    const void* m_PropertyRowHeightsEntity = nullptr;
+
     ImGuizmo::OPERATION m_GizmoMode = ImGuizmo::OPERATION::TRANSLATE;
     ImGuizmo::MODE m_GizmoSpace = ImGuizmo::MODE::WORLD;
 
@@ -611,10 +654,10 @@ private:
     static constexpr float m_CopyWidgetSpacing = 10.f;
     static constexpr float m_CopyWidgetWidth = m_CopyWidgetButtonSize + m_CopyWidgetSpacing;
 
-    std::mutex m_TaskMutex;
-    std::vector<std::function<void()>> m_TaskQueue;
-
-    std::map<std::string, PinLists> m_ClassToInputAndOutputPins;
+    // Set by the main thread once the pin database has been loaded, and read when drawing the UI.
+    std::atomic<std::shared_ptr<const PinDatabase>> m_PinDatabase;
+    PinListCache m_InputPinCache;
+    PinListCache m_OutputPinCache;
     std::vector<std::pair<std::string, STypeID*>> m_PinDataTypes;
     STypeID* m_InputPinTypeID = nullptr;
     void* m_InputPinData = nullptr;
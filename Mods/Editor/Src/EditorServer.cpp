@@ -2,8 +2,10 @@
 
 #include <Logging.h>
 #include <simdjson.h>
+#include <Util/JsonUtils.h>
 #include <queue>
 #include <numbers>
+#include <unordered_set>
 
 #include "Editor.h"
 #include "JsonHelpers.h"
@@ -116,9 +118,13 @@ EditorServer::~EditorServer() {
 std::atomic<bool> EditorServer::m_Enabled = true;
 
 void EditorServer::OnMessage(WebSocket* p_Socket, std::string_view p_Message, uWS::Loop* p_Loop) noexcept(false) {
-    simdjson::ondemand::parser s_Parser;
-    const auto s_Json = simdjson::padded_string(p_Message);
-    simdjson::ondemand::document s_JsonMsg = s_Parser.iterate(s_Json);
+    auto* s_UserData = p_Socket->getUserData();
+
+    // The message has to be copied anyway, since simdjson needs padding after it that uWS doesn't guarantee.
+    const auto s_Json = Util::JsonUtils::PadJson(p_Message, s_UserData->MessageBuffer);
+
+    simdjson::ondemand::document s_JsonDocument = s_UserData->Parser.iterate(s_Json);
+    simdjson::ondemand::object s_JsonMsg = s_JsonDocument.get_object();
 
     const std::string_view s_Type = s_JsonMsg["type"];
     Logger::Trace("Editor message type: {}", s_Type);
@@ -135,76 +141,41 @@ void EditorServer::OnMessage(WebSocket* p_Socket, std::string_view p_Message, uW
         p_Socket->getUserData()->Identifier = std::string_view(s_JsonMsg["identifier"]);
         SendWelcome(p_Socket);
     }
-    else if (s_Type == "selectEntity") {
-        Plugin()->SelectEntity(ReadEntitySelector(s_JsonMsg["entity"]), p_Socket->getUserData()->ClientId);
-    }
-    else if (s_Type == "setEntityTransform") {
-        Plugin()->SetEntityTransform(
-            ReadEntitySelector(s_JsonMsg["entity"]),
-            ReadTransform(s_JsonMsg["transform"]),
-            s_JsonMsg["relative"],
-            p_Socket->getUserData()->ClientId
-        );
-    }
-    else if (s_Type == "spawnQnEntity") {
-        Plugin()->SpawnQnEntity(
-            std::string(std::string_view(s_JsonMsg["qnJson"])),
-            ReadEntityId(s_JsonMsg["entityId"]),
-            std::string(std::string_view(s_JsonMsg["name"])),
-            p_Socket->getUserData()->ClientId
-        );
-    }
-    else if (s_Type == "createEntityResources") {
-        Plugin()->CreateEntityResources(
-            std::string(std::string_view(s_JsonMsg["qnJson"])),
-            p_Socket->getUserData()->ClientId
-        );
-    }
-    else if (s_Type == "destroyEntity") {
-        Plugin()->DestroyEntity(ReadEntitySelector(s_JsonMsg["entity"]), p_Socket->getUserData()->ClientId);
-    }
-    else if (s_Type == "setEntityName") {
-        Plugin()->SetEntityName(
-            ReadEntitySelector(s_JsonMsg["entity"]),
-            std::string(std::string_view(s_JsonMsg["name"])),
-            p_Socket->getUserData()->ClientId
-        );
-    }
-    else if (s_Type == "setEntityProperty") {
-        int32_t s_PropertyId;
+    else if (s_Type == "batch") {
+        // Read all commands up front, so a malformed batch doesn't change anything.
+        std::vector<Command> s_Commands;
 
-        if (s_JsonMsg["property"].type() == simdjson::ondemand::json_type::number) {
-            s_PropertyId = s_JsonMsg["property"];
-        }
-        else {
-            std::string_view s_PropertyName = s_JsonMsg["property"];
-            s_PropertyId = Hash::Crc32(s_PropertyName.data(), s_PropertyName.size());
-        }
+        try {
+            for (auto s_CommandElement : s_JsonMsg["commands"].get_array()) {
+                simdjson::ondemand::object s_CommandJson = s_CommandElement.get_object();
+                const std::string_view s_CommandType = s_CommandJson["type"];
 
-        Plugin()->SetEntityProperty(
-            ReadEntitySelector(s_JsonMsg["entity"]),
-            s_PropertyId,
-            simdjson::to_json_string(s_JsonMsg["value"]),
-            p_Socket->getUserData()->ClientId
-        );
-    }
-    else if (s_Type == "signalEntityPin") {
-        int32_t s_PinId;
+                auto s_Command = ReadCommand(s_CommandType, s_CommandJson, p_Socket->getUserData()->ClientId);
+
+                if (!s_Command) {
+                    throw std::runtime_error(std::format("Message type '{}' can't be batched.", s_CommandType));
+                }
 
-        if (s_JsonMsg["pin"].type() == simdjson::ondemand::json_type::number) {
-            s_PinId = s_JsonMsg["pin"];
+                s_Commands.push_back(std::move(*s_Command));
+            }
         }
-        else {
-            std::string_view s_PinName = s_JsonMsg["pin"];
-            s_PinId = Hash::Crc32(s_PinName.data(), s_PinName.size());
+        catch (const std::exception& e) {
+            SendError(
+                p_Socket, std::format("Failed to read command {} of batch: {}", s_Commands.size(), e.what()),
+                s_MessageId
+            );
+            return;
         }
 
-        Plugin()->SignalEntityPin(
-            ReadEntitySelector(s_JsonMsg["entity"]),
-            s_PinId,
-            s_JsonMsg["output"]
+        Plugin()->QueueTask(
+            [p_Socket, p_Loop, s_Commands = std::move(s_Commands), s_MessageId]() {
+                ApplyBatch(p_Socket, p_Loop, s_Commands, s_MessageId);
+            }
         );
     }
+    else if (auto s_Command = ReadCommand(s_Type, s_JsonMsg, p_Socket->getUserData()->ClientId)) {
+        s_Command->Apply();
+    }
     else if (s_Type == "listEntities") {
         SendEntityList(p_Socket, Plugin()->GetEntityTree(), s_MessageId);
     }
@@ -234,6 +205,182 @@ void EditorServer::OnMessage(WebSocket* p_Socket, std::string_view p_Message, uW
     }
 }
 
+std::optional<EditorServer::Command> EditorServer::ReadCommand(
+    std::string_view p_Type, simdjson::ondemand::object p_Json, const std::string& p_ClientId
+) {
+    Command s_Command;
+
+    if (p_Type == "selectEntity") {
+        s_Command.Entity = ReadEntitySelector(p_Json["entity"]);
+        s_Command.Apply = [s_Selector = *s_Command.Entity, p_ClientId]() {
+            Plugin()->SelectEntity(s_Selector, p_ClientId);
+        };
+    }
+    else if (p_Type == "setEntityTransform") {
+        s_Command.Entity = ReadEntitySelector(p_Json["entity"]);
+
+        const SMatrix s_Transform = ReadTransform(p_Json["transform"]);
+        const bool s_Relative = p_Json["relative"];
+
+        s_Command.Apply = [s_Selector = *s_Command.Entity, s_Transform, s_Relative, p_ClientId]() {
+            Plugin()->SetEntityTransform(s_Selector, s_Transform, s_Relative, p_ClientId);
+        };
+    }
+    else if (p_Type == "spawnQnEntity") {
+        std::string s_QnJson(std::string_view(p_Json["qnJson"]));
+        const uint64_t s_EntityId = ReadEntityId(p_Json["entityId"]);
+        std::string s_Name(std::string_view(p_Json["name"]));
+
+        s_Command.SpawnedEntityId = s_EntityId;
+        s_Command.Apply = [s_QnJson = std::move(s_QnJson), s_EntityId, s_Name = std::move(s_Name), p_ClientId]() {
+            Plugin()->SpawnQnEntity(s_QnJson, s_EntityId, s_Name, p_ClientId);
+        };
+    }
+    else if (p_Type == "createEntityResources") {
+        std::string s_QnJson(std::string_view(p_Json["qnJson"]));
+
+        s_Command.Apply = [s_QnJson = std::move(s_QnJson), p_ClientId]() {
+            Plugin()->CreateEntityResources(s_QnJson, p_ClientId);
+        };
+    }
+    else if (p_Type == "destroyEntity") {
+        s_Command.Entity = ReadEntitySelector(p_Json["entity"]);
+        s_Command.Apply = [s_Selector = *s_Command.Entity, p_ClientId]() {
+            Plugin()->DestroyEntity(s_Selector, p_ClientId);
+        };
+    }
+    else if (p_Type == "setEntityName") {
+        s_Command.Entity = ReadEntitySelector(p_Json["entity"]);
+
+        std::string s_Name(std::string_view(p_Json["name"]));
+
+        s_Command.Apply = [s_Selector = *s_Command.Entity, s_Name = std::move(s_Name), p_ClientId]() {
+            Plugin()->SetEntityName(s_Selector, s_Name, p_ClientId);
+        };
+    }
+    else if (p_Type == "setEntityProperty") {
+        int32_t s_PropertyId;
+
+        if (p_Json["property"].type() == simdjson::ondemand::json_type::number) {
+            s_PropertyId = p_Json["property"];
+        }
+        else {
+            std::string_view s_PropertyName = p_Json["property"];
+            s_PropertyId = Hash::Crc32(s_PropertyName.data(), s_PropertyName.size());
+        }
+
+        s_Command.Entity = ReadEntitySelector(p_Json["entity"]);
+
+        // The value points into the message, which is gone by the time a batch is applied.
+        std::string s_Value(simdjson::to_json_string(p_Json["value"]).value());
+
+        s_Command.Apply = [s_Selector = *s_Command.Entity, s_PropertyId, s_Value = std::move(s_Value), p_ClientId]() {
+            Plugin()->SetEntityProperty(s_Selector, s_PropertyId, s_Value, p_ClientId);
+        };
+    }
+    else if (p_Type == "signalEntityPin") {
+        int32_t s_PinId;
+
+        if (p_Json["pin"].type() == simdjson::ondemand::json_type::number) {
+            s_PinId = p_Json["pin"];
+        }
+        else {
+            std::string_view s_PinName = p_Json["pin"];
+            s_PinId = Hash::Crc32(s_PinName.data(), s_PinName.size());
+        }
+
+        s_Command.Entity = ReadEntitySelector(p_Json["entity"]);
+
+        const bool s_Output = p_Json["output"];
+
+        s_Command.Apply = [s_Selector = *s_Command.Entity, s_PinId, s_Output]() {
+            Plugin()->SignalEntityPin(s_Selector, s_PinId, s_Output);
+        };
+    }
+    else {
+        return std::nullopt;
+    }
+
+    return s_Command;
+}
+
+void EditorServer::ApplyBatch(
+    WebSocket* p_Socket, uWS::Loop* p_Loop, const std::vector<Command>& p_Commands,
+    std::optional<int64_t> p_MessageId
+) {
+    std::optional<std::pair<size_t, std::string>> s_Error;
+    size_t s_AppliedCount = 0;
+
+    // Check that every targeted entity exists before changing anything. Entities spawned by earlier commands
+    // of the batch don't exist yet, but are selected by their ID alone.
+    std::unordered_set<uint64_t> s_SpawnedEntityIds;
+
+    for (size_t i = 0; i < p_Commands.size() && !s_Error; ++i) {
+        const auto& s_Command = p_Commands[i];
+
+        if (s_Command.Entity) {
+            const bool s_IsSpawnedInBatch = !s_Command.Entity->TbluHash && !s_Command.Entity->PrimHash &&
+                    s_SpawnedEntityIds.contains(s_Command.Entity->EntityId);
+
+            if (!s_IsSpawnedInBatch && !Plugin()->FindEntity(*s_Command.Entity)) {
+                s_Error = {i, "Could not find entity for the given selector."};
+            }
+        }
+
+        if (s_Command.SpawnedEntityId) {
+            s_SpawnedEntityIds.insert(*s_Command.SpawnedEntityId);
+        }
+    }
+
+    if (!s_Error) {
+        for (const auto& s_Command : p_Commands) {
+            try {
+                s_Command.Apply();
+                ++s_AppliedCount;
+            }
+            catch (const std::exception& e) {
+                Logger::Error("Failed to apply command {} of editor batch: {}", s_AppliedCount, e.what());
+                s_Error = {s_AppliedCount, e.what()};
+                break;
+            }
+        }
+    }
+
+    p_Loop->defer(
+        [p_Socket, s_AppliedCount, s_CommandCount = p_Commands.size(), s_Error = std::move(s_Error), p_MessageId]() {
+            SendBatchResult(p_Socket, s_AppliedCount, s_CommandCount, s_Error, p_MessageId);
+        }
+    );
+}
+
+void EditorServer::SendBatchResult(
+    WebSocket* p_Socket, size_t p_AppliedCount, size_t p_CommandCount,
+    std::optional<std::pair<size_t, std::string>> p_Error, std::optional<int64_t> p_MessageId
+) {
+    std::ostringstream s_Event;
+
+    s_Event << "{";
+
+    if (p_MessageId) {
+        s_Event << write_json("msgId") << ":" << write_json(*p_MessageId) << ",";
+    }
+
+    s_Event << write_json("type") << ":" << write_json("batchResult") << ",";
+    s_Event << write_json("applied") << ":" << write_json(p_AppliedCount) << ",";
+    s_Event << write_json("total") << ":" << write_json(p_CommandCount);
+
+    if (p_Error) {
+        s_Event << "," << write_json("error") << ":{";
+        s_Event << write_json("index") << ":" << write_json(p_Error->first) << ",";
+        s_Event << write_json("message") << ":" << write_json(p_Error->second);
+        s_Event << "}";
+    }
+
+    s_Event << "}";
+
+    p_Socket->send(s_Event.str(), uWS::OpCode::TEXT);
+}
+
 void EditorServer::SendWelcome(EditorServer::WebSocket* p_Socket) {
     Logger::Info(
         "Client with identifier '{}' connected to the editor server. Sending welcome message.",
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <expected>
+#include <functional>
+#include <optional>
 #include <string>
+#include <vector>
 #include <cstdint>
 
 #include "EntityTreeNode.h"
@@ -24,6 +27,11 @@ public:
     struct SocketUserData {
         std::string ClientId;
         std::string Identifier;
+
+        // Reused for every message of the connection, so once they've grown to fit the messages,
+        // parsing doesn't allocate anymore.
+        simdjson::ondemand::parser Parser;
+        std::vector<char> MessageBuffer;
     };
 
     using WebSocket = uWS::WebSocket<false, true, SocketUserData>;
@@ -44,8 +52,44 @@ public:
     static bool GetEnabled();
 
 private:
+    /**
+     * A command that changes the scene, read from a message but not applied yet.
+     */
+    struct Command {
+        // The entity the command targets, if any. Batches check that it exists before applying anything.
+        std::optional<EntitySelector> Entity;
+
+        // The ID of the entity the command spawns, so later commands of a batch can target it.
+        std::optional<uint64_t> SpawnedEntityId;
+
+        std::function<void()> Apply;
+    };
+
     static void OnMessage(WebSocket* p_Socket, std::string_view p_Message, uWS::Loop* p_Loop) noexcept(false);
 
+    /**
+     * Read a command from a message.
+     * @return The command, or std::nullopt if the message type isn't a command.
+     */
+    static std::optional<Command> ReadCommand(
+        std::string_view p_Type, simdjson::ondemand::object p_Json, const std::string& p_ClientId
+    );
+
+    /**
+     * Apply the commands of a batch in order. Must be called on the main thread.
+     * Nothing is applied if any of the targeted entities can't be found. If a command fails, the commands after
+     * it are skipped. Either way, a single batchResult message is sent back.
+     */
+    static void ApplyBatch(
+        WebSocket* p_Socket, uWS::Loop* p_Loop, const std::vector<Command>& p_Commands,
+        std::optional<int64_t> p_MessageId
+    );
+
+    static void SendBatchResult(
+        WebSocket* p_Socket, size_t p_AppliedCount, size_t p_CommandCount,
+        std::optional<std::pair<size_t, std::string>> p_Error, std::optional<int64_t> p_MessageId
+    );
+
     static void SendWelcome(WebSocket* p_Socket);
     static void SendHitmanEntity(WebSocket* p_Socket, std::optional<int64_t> p_MessageId);
     static void SendCameraEntity(WebSocket* p_Socket, std::optional<int64_t> p_MessageId);
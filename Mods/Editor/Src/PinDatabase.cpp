@@ -0,0 +1,338 @@
+#include "PinDatabase.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <map>
+
+#include <Logging.h>
+#include <simdjson.h>
+
+namespace {
+    constexpr uint32_t c_PinIndexMagic = 0x4e495045; // "EPIN"
+    constexpr uint32_t c_PinIndexVersion = 1;
+
+    // Far more than pins.json will ever contain, so a corrupt index can't make us allocate huge amounts of memory.
+    constexpr uint32_t c_MaxPinIndexEntries = 1 << 20;
+    constexpr uint32_t c_MaxPinIndexStringDataSize = 64 << 20;
+
+    struct PinIndexHeader {
+        uint32_t m_Magic;
+        uint32_t m_Version;
+        uint32_t m_ClassCount;
+        uint32_t m_PinCount;
+        uint32_t m_StringDataSize;
+        uint32_t m_Reserved;
+    };
+
+    struct PinIndexClass {
+        uint32_t m_NameOffset;
+        uint32_t m_NameSize;
+        uint32_t m_FirstInputPin;
+        uint32_t m_InputPinCount;
+        uint32_t m_FirstOutputPin;
+        uint32_t m_OutputPinCount;
+    };
+
+    struct PinIndexPin {
+        uint32_t m_NameOffset;
+        uint32_t m_NameSize;
+        uint32_t m_DescriptionOffset;
+        uint32_t m_DescriptionSize;
+    };
+
+    int ToLower(const char p_Char) {
+        return std::tolower(static_cast<unsigned char>(p_Char));
+    }
+
+    bool IsLessCaseInsensitive(const std::string_view p_A, const std::string_view p_B) {
+        return std::ranges::lexicographical_compare(p_A, p_B, {}, ToLower, ToLower);
+    }
+
+    bool IsInRange(const uint64_t p_Offset, const uint64_t p_Size, const uint64_t p_Total) {
+        return p_Offset <= p_Total && p_Size <= p_Total - p_Offset;
+    }
+
+    PinDatabase::PinInfo ReadPin(simdjson::ondemand::value p_Pin) {
+        const std::string_view s_Name = p_Pin["pin"].get_string();
+        const std::string_view s_Description = p_Pin["description"].get_string();
+
+        return {std::string(s_Name), std::string(s_Description)};
+    }
+}
+
+bool PinDatabase::Parse(const std::string_view p_PinsJson) {
+    Clear();
+
+    struct ClassPins {
+        std::vector<PinInfo> m_InputPins;
+        std::vector<PinInfo> m_OutputPins;
+    };
+
+    // Ordered by the lowercase class name, which is the order the classes are looked up in.
+    std::map<std::string, ClassPins> s_Classes;
+
+    try {
+        simdjson::ondemand::parser s_Parser;
+        const simdjson::padded_string s_Json(p_PinsJson);
+        simdjson::ondemand::document s_Document = s_Parser.iterate(s_Json);
+
+        for (auto s_Entry : s_Document.get_array()) {
+            const std::string_view s_Path = s_Entry["path"].get_string();
+
+            // Paths look like "<module>/<class>.class".
+            const size_t s_Start = s_Path.find('/');
+            const size_t s_End = s_Path.find(".class");
+
+            if (s_Start == std::string_view::npos || s_End == std::string_view::npos || s_End <= s_Start + 1) {
+                continue;
+            }
+
+            std::string s_ClassName(s_Path.substr(s_Start + 1, s_End - s_Start - 1));
+            std::ranges::transform(s_ClassName, s_ClassName.begin(), ToLower);
+
+            auto& s_Pins = s_Classes[s_ClassName];
+
+            for (simdjson::ondemand::value s_Pin : s_Entry["in"].get_array()) {
+                s_Pins.m_InputPins.push_back(ReadPin(s_Pin));
+            }
+
+            for (simdjson::ondemand::value s_Pin : s_Entry["out"].get_array()) {
+                s_Pins.m_OutputPins.push_back(ReadPin(s_Pin));
+            }
+        }
+    }
+    catch (const simdjson::simdjson_error& e) {
+        Logger::Error("Failed to parse pins.json: {}", e.what());
+        return false;
+    }
+
+    const auto s_SortByName = [](std::vector<PinInfo>& p_Pins) {
+        std::ranges::sort(
+            p_Pins, [](const PinInfo& p_A, const PinInfo& p_B) {
+                return p_A.name < p_B.name;
+            }
+        );
+    };
+
+    m_Classes.reserve(s_Classes.size());
+
+    for (auto& [s_ClassName, s_Pins] : s_Classes) {
+        s_SortByName(s_Pins.m_InputPins);
+        s_SortByName(s_Pins.m_OutputPins);
+
+        m_Classes.push_back(
+            {
+                .m_Name = s_ClassName,
+                .m_FirstInputPin = static_cast<uint32_t>(m_Pins.size()),
+                .m_InputPinCount = static_cast<uint32_t>(s_Pins.m_InputPins.size()),
+                .m_FirstOutputPin = static_cast<uint32_t>(m_Pins.size() + s_Pins.m_InputPins.size()),
+                .m_OutputPinCount = static_cast<uint32_t>(s_Pins.m_OutputPins.size()),
+            }
+        );
+
+        std::ranges::move(s_Pins.m_InputPins, std::back_inserter(m_Pins));
+        std::ranges::move(s_Pins.m_OutputPins, std::back_inserter(m_Pins));
+    }
+
+    return true;
+}
+
+bool PinDatabase::Load(const std::filesystem::path& p_Path) {
+    Clear();
+
+    std::ifstream s_Stream(p_Path, std::ios::binary);
+
+    if (!s_Stream) {
+        return false;
+    }
+
+    PinIndexHeader s_Header {};
+
+    s_Stream.read(reinterpret_cast<char*>(&s_Header), sizeof(s_Header));
+
+    if (!s_Stream ||
+        s_Header.m_Magic != c_PinIndexMagic ||
+        s_Header.m_Version != c_PinIndexVersion ||
+        s_Header.m_ClassCount > c_MaxPinIndexEntries ||
+        s_Header.m_PinCount > c_MaxPinIndexEntries ||
+        s_Header.m_StringDataSize > c_MaxPinIndexStringDataSize) {
+        return false;
+    }
+
+    std::vector<PinIndexClass> s_Classes(s_Header.m_ClassCount);
+    std::vector<PinIndexPin> s_Pins(s_Header.m_PinCount);
+    std::string s_StringData(s_Header.m_StringDataSize, '\0');
+
+    s_Stream.read(
+        reinterpret_cast<char*>(s_Classes.data()),
+        static_cast<std::streamsize>(s_Classes.size() * sizeof(PinIndexClass))
+    );
+    s_Stream.read(
+        reinterpret_cast<char*>(s_Pins.data()),
+        static_cast<std::streamsize>(s_Pins.size() * sizeof(PinIndexPin))
+    );
+    s_Stream.read(s_StringData.data(), static_cast<std::streamsize>(s_StringData.size()));
+
+    if (!s_Stream) {
+        Logger::Warn("Pin index '{}' is truncated.", p_Path.string());
+        return false;
+    }
+
+    const std::string_view s_Strings = s_StringData;
+
+    m_Pins.reserve(s_Pins.size());
+
+    for (const auto& s_Pin : s_Pins) {
+        if (!IsInRange(s_Pin.m_NameOffset, s_Pin.m_NameSize, s_Strings.size()) ||
+            !IsInRange(s_Pin.m_DescriptionOffset, s_Pin.m_DescriptionSize, s_Strings.size())) {
+            Clear();
+            return false;
+        }
+
+        m_Pins.push_back(
+            {
+                std::string(s_Strings.substr(s_Pin.m_NameOffset, s_Pin.m_NameSize)),
+                std::string(s_Strings.substr(s_Pin.m_DescriptionOffset, s_Pin.m_DescriptionSize)),
+            }
+        );
+    }
+
+    m_Classes.reserve(s_Classes.size());
+
+    for (const auto& s_Class : s_Classes) {
+        if (!IsInRange(s_Class.m_NameOffset, s_Class.m_NameSize, s_Strings.size()) ||
+            !IsInRange(s_Class.m_FirstInputPin, s_Class.m_InputPinCount, m_Pins.size()) ||
+            !IsInRange(s_Class.m_FirstOutputPin, s_Class.m_OutputPinCount, m_Pins.size())) {
+            Clear();
+            return false;
+        }
+
+        m_Classes.push_back(
+            {
+                .m_Name = std::string(s_Strings.substr(s_Class.m_NameOffset, s_Class.m_NameSize)),
+                .m_FirstInputPin = s_Class.m_FirstInputPin,
+                .m_InputPinCount = s_Class.m_InputPinCount,
+                .m_FirstOutputPin = s_Class.m_FirstOutputPin,
+                .m_OutputPinCount = s_Class.m_OutputPinCount,
+            }
+        );
+    }
+
+    // Lookups rely on the classes being sorted.
+    if (!std::ranges::is_sorted(m_Classes, {}, &ClassInfo::m_Name)) {
+        Clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool PinDatabase::Save(const std::filesystem::path& p_Path) const {
+    std::string s_StringData;
+    std::vector<PinIndexClass> s_Classes;
+    std::vector<PinIndexPin> s_Pins;
+
+    const auto s_AddString = [&](const std::string& p_String) {
+        const auto s_Offset = static_cast<uint32_t>(s_StringData.size());
+        s_StringData += p_String;
+        return s_Offset;
+    };
+
+    s_Classes.reserve(m_Classes.size());
+    s_Pins.reserve(m_Pins.size());
+
+    for (const auto& s_Class : m_Classes) {
+        s_Classes.push_back(
+            {
+                .m_NameOffset = s_AddString(s_Class.m_Name),
+                .m_NameSize = static_cast<uint32_t>(s_Class.m_Name.size()),
+                .m_FirstInputPin = s_Class.m_FirstInputPin,
+                .m_InputPinCount = s_Class.m_InputPinCount,
+                .m_FirstOutputPin = s_Class.m_FirstOutputPin,
+                .m_OutputPinCount = s_Class.m_OutputPinCount,
+            }
+        );
+    }
+
+    for (const auto& s_Pin : m_Pins) {
+        s_Pins.push_back(
+            {
+                .m_NameOffset = s_AddString(s_Pin.name),
+                .m_NameSize = static_cast<uint32_t>(s_Pin.name.size()),
+                .m_DescriptionOffset = s_AddString(s_Pin.description),
+                .m_DescriptionSize = static_cast<uint32_t>(s_Pin.description.size()),
+            }
+        );
+    }
+
+    if (s_StringData.size() > c_MaxPinIndexStringDataSize) {
+        return false;
+    }
+
+    std::filesystem::path s_TemporaryPath = p_Path;
+    s_TemporaryPath += ".tmp";
+
+    {
+        std::ofstream s_Stream(s_TemporaryPath, std::ios::binary | std::ios::trunc);
+
+        if (!s_Stream) {
+            return false;
+        }
+
+        const PinIndexHeader s_Header {
+            .m_Magic = c_PinIndexMagic,
+            .m_Version = c_PinIndexVersion,
+            .m_ClassCount = static_cast<uint32_t>(s_Classes.size()),
+            .m_PinCount = static_cast<uint32_t>(s_Pins.size()),
+            .m_StringDataSize = static_cast<uint32_t>(s_StringData.size()),
+            .m_Reserved = 0,
+        };
+
+        s_Stream.write(reinterpret_cast<const char*>(&s_Header), sizeof(s_Header));
+        s_Stream.write(
+            reinterpret_cast<const char*>(s_Classes.data()),
+            static_cast<std::streamsize>(s_Classes.size() * sizeof(PinIndexClass))
+        );
+        s_Stream.write(
+            reinterpret_cast<const char*>(s_Pins.data()),
+            static_cast<std::streamsize>(s_Pins.size() * sizeof(PinIndexPin))
+        );
+        s_Stream.write(s_StringData.data(), static_cast<std::streamsize>(s_StringData.size()));
+
+        if (!s_Stream) {
+            return false;
+        }
+    }
+
+    std::error_code s_ErrorCode;
+    std::filesystem::rename(s_TemporaryPath, p_Path, s_ErrorCode);
+
+    if (s_ErrorCode) {
+        std::filesystem::remove(s_TemporaryPath, s_ErrorCode);
+        return false;
+    }
+
+    return true;
+}
+
+std::span<const PinDatabase::PinInfo> PinDatabase::GetPins(
+    const std::string_view p_ClassName, const bool p_Output
+) const {
+    const auto s_It = std::ranges::lower_bound(m_Classes, p_ClassName, IsLessCaseInsensitive, &ClassInfo::m_Name);
+
+    if (s_It == m_Classes.end() || IsLessCaseInsensitive(p_ClassName, s_It->m_Name)) {
+        return {};
+    }
+
+    if (p_Output) {
+        return std::span(m_Pins).subspan(s_It->m_FirstOutputPin, s_It->m_OutputPinCount);
+    }
+
+    return std::span(m_Pins).subspan(s_It->m_FirstInputPin, s_It->m_InputPinCount);
+}
+
+void PinDatabase::Clear() {
+    m_Classes.clear();
+    m_Pins.clear();
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * The input and output pins of entity classes, as listed in the pins.json of the glacier modding docs.
+ *
+ * Once parsed, the database can be saved as a binary index, so later launches (including offline ones) can load it
+ * without downloading or parsing any JSON. Class names are stored in lowercase and sorted, and the pins of every
+ * class are a contiguous slice of a single array, sorted by name.
+ */
+class PinDatabase {
+public:
+    struct PinInfo {
+        std::string name;
+        std::string description;
+    };
+
+    /**
+     * Build the database from the contents of pins.json.
+     * @return False if the JSON couldn't be parsed, in which case the database is left empty.
+     */
+    bool Parse(std::string_view p_PinsJson);
+
+    /**
+     * Load a binary index that was previously written with Save.
+     * @return False if the file doesn't exist or isn't a valid index, in which case the database is left empty.
+     */
+    bool Load(const std::filesystem::path& p_Path);
+
+    bool Save(const std::filesystem::path& p_Path) const;
+
+    bool IsEmpty() const {
+        return m_Classes.empty();
+    }
+
+    size_t GetClassCount() const {
+        return m_Classes.size();
+    }
+
+    /**
+     * Get the pins of a class, sorted by name.
+     * @param p_ClassName The name of the class, in any case (e.g. the type name of an entity interface).
+     * @param p_Output True to get the output pins, false to get the input pins.
+     * @return The pins, or an empty span if the class isn't known.
+     */
+    std::span<const PinInfo> GetPins(std::string_view p_ClassName, bool p_Output) const;
+
+private:
+    struct ClassInfo {
+        std::string m_Name;
+        uint32_t m_FirstInputPin;
+        uint32_t m_InputPinCount;
+        uint32_t m_FirstOutputPin;
+        uint32_t m_OutputPinCount;
+    };
+
+    void Clear();
+
+private:
+    std::vector<ClassInfo> m_Classes;
+    std::vector<PinInfo> m_Pins;
+};
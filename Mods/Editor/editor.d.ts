@@ -246,6 +246,30 @@ declare namespace EditorRequests {
     interface RebuildEntityTree {
         type: 'rebuildEntityTree';
     }
+
+    // A command that can be part of a batch.
+    type BatchCommand =
+        SelectEntity
+        | SetEntityTransform
+        | SpawnQnEntity
+        | CreateEntityResources
+        | DestroyEntity
+        | SetEntityName
+        | SetEntityProperty
+        | SignalEntityPin;
+
+    // Apply many commands at once, in order and within a single frame. Nothing is applied if a command
+    // can't be read or targets an entity that doesn't exist. If a command fails, the ones after it are skipped.
+    // The editor responds with a single `batchResult` event.
+    interface Batch {
+        type: 'batch';
+
+        // The commands to apply.
+        commands: BatchCommand[];
+
+        // A message id to include in the response in order to match it to the request.
+        msgId?: number;
+    }
 }
 
 type EditorRequest =
@@ -263,7 +287,8 @@ type EditorRequest =
     | EditorRequests.GetEntityDetails
     | EditorRequests.GetHitmanEntity
     | EditorRequests.GetCameraEntity
-    | EditorRequests.RebuildEntityTree;
+    | EditorRequests.RebuildEntityTree
+    | EditorRequests.Batch;
 
 // Events from the editor to a third party program.
 declare namespace EditorEvents {
@@ -396,6 +421,29 @@ declare namespace EditorEvents {
     interface EntityTreeRebuilt {
         type: 'entityTreeRebuilt';
     }
+
+    // Sent in response to a batch once it has been applied.
+    interface BatchResult {
+        type: 'batchResult';
+
+        // The number of commands that were applied.
+        applied: number;
+
+        // The number of commands in the batch.
+        total: number;
+
+        // Why the batch stopped, if it did.
+        error?: {
+            // The index of the command that failed.
+            index: number;
+
+            // The error message.
+            message: string;
+        };
+
+        // The message id of the request, if any.
+        msgId?: number;
+    }
 }
 
 type EditorEvent =
@@ -414,4 +462,5 @@ type EditorEvent =
     | EditorEvents.EntityDetailsResponse
     | EditorEvents.HitmanEntityResponse
     | EditorEvents.CameraEntityResponse
-    | EditorEvents.EntityTreeRebuilt;
\ No newline at end of file
+    | EditorEvents.EntityTreeRebuilt
+    | EditorEvents.BatchResult;
\ No newline at end of file
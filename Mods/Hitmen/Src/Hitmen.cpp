@@ -302,7 +302,7 @@ void Hitmen::OnInputsAndPosition(BinaryStreamReader& p_Reader)
 
     if (m_OtherHitman)
     {
-        m_OtherHitman.SetProperty("m_eRoomBehaviour", ZSpatialEntity::ERoomBehaviour::ROOM_DYNAMIC);
+        m_OtherHitman.SetProperty(PropertyId<"m_eRoomBehaviour">, ZSpatialEntity::ERoomBehaviour::ROOM_DYNAMIC);
 
         const auto s_SpatialHitman = m_OtherHitman.QueryInterface<ZSpatialEntity>();
 
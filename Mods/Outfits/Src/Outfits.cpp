@@ -1,6 +1,10 @@
 #include "Outfits.h"
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <fstream>
+#include <thread>
 
 #include <imgui_internal.h>
 
@@ -11,7 +15,7 @@
 #include <Glacier/ZModule.h>
 #include <Glacier/SExternalReferences.h>
 
-#include <Util/ResourceUtils.h>
+#include <Util/JsonUtils.h>
 #include "Logging.h"
 #include "Functions.h"
 
@@ -32,62 +36,53 @@ void Outfits::OnDrawUI(const bool p_HasFocus) {
         return;
     }
 
-    ZContentKitManager* s_ContentKitManager = Globals::ContentKitManager;
-
-    auto s_LocalHitman = SDK()->GetLocalPlayer();
-
     ImGui::PushFont(SDK()->GetImGuiBlackFont());
     const auto s_Showing = ImGui::Begin("OUTFITS", &m_OutfitsMenuActive);
     ImGui::PushFont(SDK()->GetImGuiRegularFont());
 
     if (s_Showing) {
+        // Only the UI writes m_Scenes, so it's built and read here without holding the lock.
         if (m_Scenes.empty()) {
             BuildSceneNamesToRuntimeResourceIds();
         }
 
-        ImGui::BeginDisabled(m_IsGlobalDataSeason2BrickLoaded);
-
-        if (ImGui::Checkbox("Season 2 Global Outfits", &m_IsGlobalDataSeason2BrickLoaded)) {
-            if (m_IsGlobalDataSeason2BrickLoaded) {
-                m_LoadedGlobalOutfitBricks.erase(
-                    ResId<"[assembly:/_pro/scenes/bricks/globaldata_s2.brick].pc_entitytype">
-                );
-            }
-            else {
-                m_IsGlobalDataSeason2BrickLoaded = LoadGlobalDataBrick(
-                    ResId<"[assembly:/_pro/scenes/bricks/globaldata_s2.brick].pc_entitytype">
-                );
-            }
-        }
+        // Copy what the UI shows, so the main thread doesn't have to wait for the whole window to be drawn.
+        std::unordered_set<std::string> s_LoadedScenes;
+        std::unordered_set<std::string> s_SelectedScenes;
+        std::vector<ZRuntimeResourceID> s_AdditionalLoadedOutfitBricks;
+        std::unordered_set<ZRuntimeResourceID> s_SelectedOutfitBricks;
+        bool s_ShowResourcePackageLimitPopup;
+        size_t s_PendingChunkCount;
+        size_t s_PendingResourcePackageCount;
 
-        ImGui::EndDisabled();
+        {
+            std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
 
-        if (m_IsGlobalDataSeason2BrickLoaded) {
-            ImGui::SameLine();
-            ImGui::TextDisabled("(loaded)");
-        }
+            s_LoadedScenes = m_LoadedScenes;
+            s_SelectedScenes = m_SelectedScenes;
+            s_SelectedOutfitBricks = m_SelectedOutfitBricks;
+            s_ShowResourcePackageLimitPopup = m_ShowResourcePackageLimitPopup;
+            s_PendingChunkCount = m_PendingChunkCount;
+            s_PendingResourcePackageCount = m_PendingResourcePackageCount;
 
-        ImGui::BeginDisabled(m_IsGlobalDataSeason3BrickLoaded);
+            s_AdditionalLoadedOutfitBricks.reserve(m_AdditionalLoadedOutfitBricks.size());
 
-        if (ImGui::Checkbox("Season 3 Global Outfits", &m_IsGlobalDataSeason3BrickLoaded)) {
-            if (m_IsGlobalDataSeason3BrickLoaded) {
-                m_LoadedGlobalOutfitBricks.erase(
-                    ResId<"[assembly:/_pro/scenes/bricks/globaldata_s3.brick].pc_entitytype">
-                );
-            }
-            else {
-                m_IsGlobalDataSeason3BrickLoaded = LoadGlobalDataBrick(
-                    ResId<"[assembly:/_pro/scenes/bricks/globaldata_s3.brick].pc_entitytype">
-                );
+            for (const auto& [s_OutfitBrickRuntimeResourceId, _] : m_AdditionalLoadedOutfitBricks) {
+                s_AdditionalLoadedOutfitBricks.push_back(s_OutfitBrickRuntimeResourceId);
             }
         }
 
-        ImGui::EndDisabled();
+        DrawGlobalDataBrickCheckbox(
+            "Season 2 Global Outfits",
+            ResId<"[assembly:/_pro/scenes/bricks/globaldata_s2.brick].pc_entitytype">,
+            m_IsGlobalDataSeason2BrickLoaded
+        );
 
-        if (m_IsGlobalDataSeason3BrickLoaded) {
-            ImGui::SameLine();
-            ImGui::TextDisabled("(loaded)");
-        }
+        DrawGlobalDataBrickCheckbox(
+            "Season 3 Global Outfits",
+            ResId<"[assembly:/_pro/scenes/bricks/globaldata_s3.brick].pc_entitytype">,
+            m_IsGlobalDataSeason3BrickLoaded
+        );
 
         ImGui::TextUnformatted("Scenes:");
         ImGui::BeginChild("SceneList", ImVec2(0, 250), true, ImGuiWindowFlags_HorizontalScrollbar);
@@ -97,12 +92,14 @@ void Outfits::OnDrawUI(const bool p_HasFocus) {
 
         for (const auto& [s_SceneName, s_SceneRuntimeResourceIds] : m_Scenes) {
             const bool s_IsMainScene = s_SceneRuntimeResourceIds.contains(s_CurrentSceneRuntimeResourceId);
-            const bool s_IsLoaded = s_IsMainScene || m_LoadedScenes.contains(s_SceneName);
-            bool s_IsSelected = s_IsMainScene || m_SelectedScenes.contains(s_SceneName);
+            const bool s_IsLoaded = s_IsMainScene || s_LoadedScenes.contains(s_SceneName);
+            bool s_IsSelected = s_IsMainScene || s_SelectedScenes.contains(s_SceneName);
 
             ImGui::BeginDisabled(s_IsMainScene);
 
             if (ImGui::Checkbox(s_SceneName.c_str(), &s_IsSelected)) {
+                std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
                 if (s_IsSelected) {
                     m_SelectedScenes.insert(s_SceneName);
                 }
@@ -138,12 +135,13 @@ void Outfits::OnDrawUI(const bool p_HasFocus) {
         ImGui::TextUnformatted("Outfit Bricks:");
         ImGui::BeginChild("OutfitBrickList", ImVec2(0, 250), true, ImGuiWindowFlags_HorizontalScrollbar);
 
-        for (const auto& [s_OutfitBrickRuntimeResourceId, _] : m_AdditionalLoadedOutfitBricks) {
-            const bool s_IsLoaded = m_AdditionalLoadedOutfitBricks.contains(s_OutfitBrickRuntimeResourceId);
-            bool s_IsSelected = m_SelectedOutfitBricks.contains(s_OutfitBrickRuntimeResourceId);
+        for (const auto& s_OutfitBrickRuntimeResourceId : s_AdditionalLoadedOutfitBricks) {
+            bool s_IsSelected = s_SelectedOutfitBricks.contains(s_OutfitBrickRuntimeResourceId);
             const std::string s_OutfitBrickLabel = fmt::format("{:016X}", s_OutfitBrickRuntimeResourceId.GetID());
 
             if (ImGui::Checkbox(s_OutfitBrickLabel.c_str(), &s_IsSelected)) {
+                std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
                 if (s_IsSelected) {
                     m_SelectedOutfitBricks.insert(s_OutfitBrickRuntimeResourceId);
                 }
@@ -152,10 +150,8 @@ void Outfits::OnDrawUI(const bool p_HasFocus) {
                 }
             }
 
-            if (s_IsLoaded) {
-                ImGui::SameLine();
-                ImGui::TextDisabled("(loaded)");
-            }
+            ImGui::SameLine();
+            ImGui::TextDisabled("(loaded)");
         }
 
         ImGui::EndChild();
@@ -163,102 +159,18 @@ void Outfits::OnDrawUI(const bool p_HasFocus) {
         ImGui::Spacing();
 
         if (ImGui::Button("Load/Unload Outfits")) {
-            if (m_ChunkIndexToResourcePackageCount.empty()) {
-                BuildChunkIndexToResourcePackageCount();
-            }
-
-            std::vector<std::string> s_ScenesToLoad;
-            std::unordered_set<std::string> s_ScenesToUnload;
-            std::vector<ZRuntimeResourceID> s_OutfitBricksToUnload;
-
-            for (const auto& s_SceneName : m_SelectedScenes) {
-                if (!m_LoadedScenes.contains(s_SceneName)) {
-                    s_ScenesToLoad.push_back(s_SceneName);
-                }
-            }
-
-            for (const auto& s_SceneName : m_LoadedScenes) {
-                if (!m_SelectedScenes.contains(s_SceneName)) {
-                    s_ScenesToUnload.insert(s_SceneName);
+            // Mounting chunks and spawning bricks has to happen on the main thread anyway, so the selection is
+            // copied into a task rather than applied while the UI is being drawn.
+            QueueMainThreadTask(
+                [this, s_SelectedScenes, s_SelectedOutfitBricks, s_BrickResourceId = std::string(s_BrickResourceId)]() {
+                    ApplyOutfitSelection(s_SelectedScenes, s_SelectedOutfitBricks, s_BrickResourceId);
                 }
-            }
-
-            for (const auto& [s_OutfitBrickRuntimeResourceId, _] : m_AdditionalLoadedOutfitBricks) {
-                if (!m_SelectedOutfitBricks.contains(s_OutfitBrickRuntimeResourceId)) {
-                    s_OutfitBricksToUnload.push_back(s_OutfitBrickRuntimeResourceId);
-                }
-            }
-
-            if (!s_ScenesToUnload.empty()) {
-                UnloadOutfits(s_ScenesToUnload);
-            }
-
-            if (!s_OutfitBricksToUnload.empty()) {
-                UnloadOutfits(s_OutfitBricksToUnload);
-            }
-
-            m_PendingChunks.clear();
-
-            for (auto& s_PartitionInfo : (*Globals::PackageManager)->m_aPartitionInfos) {
-                if (SDK()->IsChunkMounted(s_PartitionInfo->m_nIndex)) {
-                    m_PendingChunks.insert(s_PartitionInfo->m_nIndex);
-                }
-            }
-
-            ZRuntimeResourceID s_BrickRuntimeResourceID;
-
-            if (s_BrickResourceId[0] == '\0') {
-                for (const auto& s_SelectedScene : s_ScenesToLoad) {
-                    for (const auto& s_SceneRuntimeResourceId : m_Scenes[s_SelectedScene]) {
-                        const auto& s_ChunkIndices = SDK()->GetChunkIndicesForRuntimeResourceId(s_SceneRuntimeResourceId);
-
-                        for (uint32_t s_ChunkIndex : s_ChunkIndices) {
-                            m_PendingChunks.insert(s_ChunkIndex);
-                        }
-                    }
-                }
-
-            }
-            else {
-                s_BrickRuntimeResourceID = ZRuntimeResourceID::FromString(s_BrickResourceId);
-                const auto& s_ChunkIndices = SDK()->GetChunkIndicesForRuntimeResourceId(s_BrickRuntimeResourceID);
-
-                for (uint32_t s_ChunkIndex : s_ChunkIndices) {
-                    m_PendingChunks.insert(s_ChunkIndex);
-                }
-            }
-
-            m_PendingChunkCount = m_PendingChunks.size();
-            m_PendingResourcePackageCount = 0;
-
-            for (uint32_t s_ChunkIndex : m_PendingChunks) {
-                auto s_Iterator = m_ChunkIndexToResourcePackageCount.find(s_ChunkIndex);
-
-                if (s_Iterator != m_ChunkIndexToResourcePackageCount.end()) {
-                    m_PendingResourcePackageCount += s_Iterator->second;
-                }
-            }
-
-            if (m_PendingResourcePackageCount > MAX_RESOURCE_PACKAGES) {
-                m_ShowResourcePackageLimitPopup = true;
-            }
-            else {
-                if (s_BrickRuntimeResourceID.GetID() == -1) {
-                    LoadOutfits(s_ScenesToLoad);
-
-                    for (const auto& s_SceneName : s_ScenesToLoad) {
-                        m_LoadedScenes.insert(s_SceneName);
-                    }
-                }
-                else {
-                    LoadOutfits(s_BrickRuntimeResourceID);
+            );
 
-                    s_BrickResourceId[0] = '\0';
-                }
-            }
+            s_BrickResourceId[0] = '\0';
         }
 
-        if (m_ShowResourcePackageLimitPopup && !m_ResourcePackageLimitPopupOpened) {
+        if (s_ShowResourcePackageLimitPopup && !m_ResourcePackageLimitPopupOpened) {
             ImGui::OpenPopup("Resource Package Limit Exceeded");
 
             m_ResourcePackageLimitPopupOpened = true;
@@ -277,15 +189,20 @@ void Outfits::OnDrawUI(const bool p_HasFocus) {
             ImGui::Text(
                 "The selected scenes require %zu chunks and %zu resource packages.\n"
                 "The engine supports a maximum of %d resource packages.",
-                m_PendingChunkCount,
-                m_PendingResourcePackageCount,
+                s_PendingChunkCount,
+                s_PendingResourcePackageCount,
                 MAX_RESOURCE_PACKAGES
             );
 
             ImGui::Dummy(ImVec2(0.f, 14.f));
 
             if (ImGui::Button("Cancel")) {
-                m_ShowResourcePackageLimitPopup = false;
+                {
+                    std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
+                    m_ShowResourcePackageLimitPopup = false;
+                }
+
                 m_ResourcePackageLimitPopupOpened = false;
 
                 ImGui::CloseCurrentPopup();
@@ -302,7 +219,186 @@ void Outfits::OnDrawUI(const bool p_HasFocus) {
     ImGui::PopFont();
 }
 
+void Outfits::DrawGlobalDataBrickCheckbox(
+    const char* p_Label,
+    const ZRuntimeResourceID& p_BrickRuntimeResourceId,
+    bool& p_IsBrickLoaded
+) {
+    bool s_IsBrickLoaded;
+
+    {
+        std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
+        s_IsBrickLoaded = p_IsBrickLoaded;
+    }
+
+    ImGui::BeginDisabled(s_IsBrickLoaded);
+
+    if (ImGui::Checkbox(p_Label, &s_IsBrickLoaded) && s_IsBrickLoaded) {
+        // Marked as loaded right away, so the checkbox can't queue the brick twice. The task clears it again if
+        // the brick couldn't be spawned.
+        {
+            std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
+            p_IsBrickLoaded = true;
+        }
+
+        QueueMainThreadTask(
+            [this, p_BrickRuntimeResourceId, &p_IsBrickLoaded]() {
+                if (LoadGlobalDataBrick(p_BrickRuntimeResourceId)) {
+                    return;
+                }
+
+                std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
+                p_IsBrickLoaded = false;
+            }
+        );
+    }
+
+    ImGui::EndDisabled();
+
+    if (s_IsBrickLoaded) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(loaded)");
+    }
+}
+
+void Outfits::ApplyOutfitSelection(
+    const std::unordered_set<std::string>& p_SelectedScenes,
+    const std::unordered_set<ZRuntimeResourceID>& p_SelectedOutfitBricks,
+    const std::string& p_BrickResourceId
+) {
+    std::vector<std::string> s_ScenesToLoad;
+    std::unordered_set<std::string> s_ScenesToUnload;
+    std::vector<ZRuntimeResourceID> s_OutfitBricksToUnload;
+
+    for (const auto& s_SceneName : p_SelectedScenes) {
+        if (!m_LoadedScenes.contains(s_SceneName)) {
+            s_ScenesToLoad.push_back(s_SceneName);
+        }
+    }
+
+    for (const auto& s_SceneName : m_LoadedScenes) {
+        if (!p_SelectedScenes.contains(s_SceneName)) {
+            s_ScenesToUnload.insert(s_SceneName);
+        }
+    }
+
+    for (const auto& [s_OutfitBrickRuntimeResourceId, _] : m_AdditionalLoadedOutfitBricks) {
+        if (!p_SelectedOutfitBricks.contains(s_OutfitBrickRuntimeResourceId)) {
+            s_OutfitBricksToUnload.push_back(s_OutfitBrickRuntimeResourceId);
+        }
+    }
+
+    if (!s_ScenesToUnload.empty()) {
+        UnloadOutfits(s_ScenesToUnload);
+    }
+
+    if (!s_OutfitBricksToUnload.empty()) {
+        UnloadOutfits(s_OutfitBricksToUnload);
+    }
+
+    m_PendingChunks.clear();
+
+    for (auto& s_PartitionInfo : (*Globals::PackageManager)->m_aPartitionInfos) {
+        if (SDK()->IsChunkMounted(s_PartitionInfo->m_nIndex)) {
+            m_PendingChunks.insert(s_PartitionInfo->m_nIndex);
+        }
+    }
+
+    ZRuntimeResourceID s_BrickRuntimeResourceID;
+
+    if (p_BrickResourceId.empty()) {
+        for (const auto& s_SelectedScene : s_ScenesToLoad) {
+            for (const auto& s_SceneRuntimeResourceId : GetSceneRuntimeResourceIds(s_SelectedScene)) {
+                const auto& s_ChunkIndices = SDK()->GetChunkIndicesForRuntimeResourceId(s_SceneRuntimeResourceId);
+
+                for (uint32_t s_ChunkIndex : s_ChunkIndices) {
+                    m_PendingChunks.insert(s_ChunkIndex);
+                }
+            }
+        }
+    }
+    else {
+        s_BrickRuntimeResourceID = ZRuntimeResourceID::FromString(p_BrickResourceId);
+        const auto& s_ChunkIndices = SDK()->GetChunkIndicesForRuntimeResourceId(s_BrickRuntimeResourceID);
+
+        for (uint32_t s_ChunkIndex : s_ChunkIndices) {
+            m_PendingChunks.insert(s_ChunkIndex);
+        }
+    }
+
+    size_t s_PendingResourcePackageCount = 0;
+
+    for (uint32_t s_ChunkIndex : m_PendingChunks) {
+        s_PendingResourcePackageCount += GetResourcePackageCount(s_ChunkIndex);
+    }
+
+    if (s_PendingResourcePackageCount > MAX_RESOURCE_PACKAGES) {
+        std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
+        m_PendingChunkCount = m_PendingChunks.size();
+        m_PendingResourcePackageCount = s_PendingResourcePackageCount;
+        m_ShowResourcePackageLimitPopup = true;
+
+        return;
+    }
+
+    if (s_BrickRuntimeResourceID.GetID() == -1) {
+        LoadOutfits(s_ScenesToLoad);
+
+        std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
+        for (const auto& s_SceneName : s_ScenesToLoad) {
+            m_LoadedScenes.insert(s_SceneName);
+        }
+    }
+    else {
+        LoadOutfits(s_BrickRuntimeResourceID);
+    }
+}
+
 void Outfits::BuildSceneNamesToRuntimeResourceIds() {
+    if (!LoadSceneCache()) {
+        m_ContractScenes = ScanContracts();
+        m_SceneRuntimeResourceIdToOutfitBrickIds.clear();
+
+        SaveSceneCache();
+    }
+
+    for (const auto& s_ContractScene : m_ContractScenes) {
+        ZString s_SceneName;
+        int s_OutMarkupResult;
+
+        const bool s_TextFound = Hooks::ZUIText_TryGetTextFromNameHash->Call(
+            Globals::UIText,
+            s_ContractScene.m_LocationHash,
+            s_SceneName,
+            s_OutMarkupResult
+        );
+
+        if (!s_TextFound) {
+            Logger::Error(
+                "Missing UI text for location hash: {:08x} (Scene Runtime Resource ID: {})!",
+                s_ContractScene.m_LocationHash,
+                s_ContractScene.m_SceneRuntimeResourceId
+            );
+
+            continue;
+        }
+
+        m_Scenes[s_SceneName.c_str()].insert(s_ContractScene.m_SceneRuntimeResourceId);
+    }
+}
+
+std::vector<Outfits::ContractScene> Outfits::ScanContracts() {
+    struct ContractJson {
+        ZRuntimeResourceID m_RuntimeResourceId;
+        const char* m_Data;
+        size_t m_Size;
+    };
+
     const ZRuntimeResourceID s_ConfigRuntimeResourceID = ResId<"[assembly:/_pro/online/default/offlineconfig/config.contracts].pc_contracts">;
     ZResourcePtr s_ConfigResourcePtr;
 
@@ -310,6 +406,14 @@ void Outfits::BuildSceneNamesToRuntimeResourceIds() {
 
     const ZResourceContainer::SResourceInfo& s_ConfigResourceInfo = s_ConfigResourcePtr.GetResourceInfo();
 
+    // Loading resources has to happen on this thread, but the JSON data stays valid for as long as we hold on to
+    // the resources, so only parsing is spread over worker threads.
+    std::vector<ZResourcePtr> s_JsonResourcePtrs;
+    std::vector<ContractJson> s_ContractJsons;
+
+    s_JsonResourcePtrs.reserve(s_ConfigResourceInfo.numReferences);
+    s_ContractJsons.reserve(s_ConfigResourceInfo.numReferences);
+
     for (size_t i = 0; i < s_ConfigResourceInfo.numReferences; ++i) {
         const uint32_t s_JsonReferenceIndex = (*Globals::ResourceContainer)->m_references[s_ConfigResourceInfo.firstReferenceIndex + i].index;
         const ZResourceContainer::SResourceInfo& s_JsonReferenceInfo = (*Globals::ResourceContainer)->m_resources[s_JsonReferenceIndex];
@@ -323,7 +427,7 @@ void Outfits::BuildSceneNamesToRuntimeResourceIds() {
             continue;
         }
 
-        ZResourcePtr s_JsonResourcePtr;
+        ZResourcePtr& s_JsonResourcePtr = s_JsonResourcePtrs.emplace_back();
 
         Globals::ResourceManager->LoadResource(s_JsonResourcePtr, s_JsonReferenceInfo.rid);
 
@@ -336,120 +440,205 @@ void Outfits::BuildSceneNamesToRuntimeResourceIds() {
             continue;
         }
 
-        const char* s_JsonData = static_cast<const char*>(s_DataBuffer->m_pData);
-        size_t s_JsonSize = s_DataBuffer->m_nSize;
+        s_ContractJsons.push_back(
+            ContractJson {
+                .m_RuntimeResourceId = s_JsonReferenceInfo.rid,
+                .m_Data = static_cast<const char*>(s_DataBuffer->m_pData),
+                .m_Size = s_DataBuffer->m_nSize,
+            }
+        );
+    }
+
+    if (s_ContractJsons.empty()) {
+        return {};
+    }
 
-        simdjson::padded_string s_PaddedJson(s_JsonData, s_JsonSize);
+    const size_t s_WorkerCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, s_ContractJsons.size());
+    std::vector<std::vector<ContractScene>> s_WorkerResults(s_WorkerCount);
+    std::atomic<size_t> s_NextContractJson = 0;
 
+    const auto s_ParseContracts = [&](const size_t p_WorkerIndex) {
+        // Every worker reuses its parser and padded buffer, so they're only reallocated for larger documents.
         simdjson::ondemand::parser s_Parser;
-        auto s_Document = s_Parser.iterate(s_PaddedJson);
+        std::vector<char> s_PaddedJson;
 
-        auto s_ParseErrorCode = s_Document.error();
+        while (true) {
+            const size_t s_Index = s_NextContractJson.fetch_add(1, std::memory_order_relaxed);
 
-        if (s_ParseErrorCode) {
-            Logger::Error("Failed to parse JSON: {}!", simdjson::error_message(s_ParseErrorCode));
+            if (s_Index >= s_ContractJsons.size()) {
+                break;
+            }
 
-            continue;
-        }
+            const ContractJson& s_ContractJson = s_ContractJsons[s_Index];
 
-        simdjson::ondemand::object s_Metadata = s_Document["Metadata"];
-        const std::string_view s_CodeNameHint = s_Metadata["CodeName_Hint"];
-        const std::string_view s_ScenePath = s_Metadata["ScenePath"];
-        const std::string_view s_LocationKey = s_Metadata["Location"];
+            auto s_Document = s_Parser.iterate(
+                Util::JsonUtils::PadJson(
+                    std::string_view(s_ContractJson.m_Data, s_ContractJson.m_Size), s_PaddedJson
+                )
+            );
 
-        std::string s_LocationKey2 = std::format("UI_{}_CITY", s_LocationKey);
-        const uint32_t s_LocationHash = Hash::Crc32(s_LocationKey2.data(), s_LocationKey2.size());
+            simdjson::ondemand::object s_Metadata;
+            std::string_view s_ScenePath;
+            std::string_view s_LocationKey;
 
-        ZString s_SceneName;
-        int s_OutMarkupResult;
+            auto s_ParseErrorCode = s_Document.error();
 
-        const bool s_TextFound = Hooks::ZUIText_TryGetTextFromNameHash->Call(
-            Globals::UIText,
-            s_LocationHash,
-            s_SceneName,
-            s_OutMarkupResult
-        );
+            if (!s_ParseErrorCode) {
+                s_ParseErrorCode = s_Document["Metadata"].get_object().get(s_Metadata);
+            }
 
-        if (!s_TextFound) {
-            Logger::Error(
-                "Missing UI text for location key: {} (Runtime Resource ID: {:016x})!",
-                s_LocationKey2,
-                s_JsonReferenceInfo.rid.GetID()
-            );
+            if (!s_ParseErrorCode) {
+                s_ParseErrorCode = s_Metadata["ScenePath"].get_string().get(s_ScenePath);
+            }
 
-            continue;
-        }
+            if (!s_ParseErrorCode) {
+                s_ParseErrorCode = s_Metadata["Location"].get_string().get(s_LocationKey);
+            }
+
+            if (s_ParseErrorCode) {
+                Logger::Error(
+                    "Failed to parse JSON {:016x}: {}!",
+                    s_ContractJson.m_RuntimeResourceId.GetID(),
+                    simdjson::error_message(s_ParseErrorCode)
+                );
+
+                continue;
+            }
+
+            if (s_ScenePath.empty()) {
+                continue;
+            }
 
-        if (!s_ScenePath.empty()) {
+            const std::string s_LocationKey2 = std::format("UI_{}_CITY", s_LocationKey);
             const std::string s_EntityTemplatePath = ToEntityTemplatePath(s_ScenePath);
-            const ZRuntimeResourceID s_SceneRuntimeResourceId = ZRuntimeResourceID::FromString(s_EntityTemplatePath);
 
-            m_Scenes[s_SceneName.c_str()].insert(s_SceneRuntimeResourceId);
+            s_WorkerResults[p_WorkerIndex].push_back(
+                ContractScene {
+                    .m_LocationHash = Hash::Crc32(s_LocationKey2.data(), s_LocationKey2.size()),
+                    .m_Reserved = 0,
+                    .m_SceneRuntimeResourceId = ZRuntimeResourceID::FromString(s_EntityTemplatePath),
+                }
+            );
         }
+    };
+
+    std::vector<std::thread> s_Workers;
+
+    s_Workers.reserve(s_WorkerCount - 1);
+
+    for (size_t i = 1; i < s_WorkerCount; ++i) {
+        s_Workers.emplace_back(s_ParseContracts, i);
     }
-}
 
-void Outfits::BuildSceneToOutfitBrickRuntimeResourceIds(const std::string& p_SceneName, const ZRuntimeResourceID& p_SceneRuntimeResourceId) {
-    std::unordered_set<uint64_t> s_Visited;
-    std::unordered_set<ZRuntimeResourceID> s_FoundOutfits;
+    s_ParseContracts(0);
 
-    bool s_HasOutfit = FindOutfitReferencesRecursive(p_SceneRuntimeResourceId, s_Visited, s_FoundOutfits);
+    for (auto& s_Worker : s_Workers) {
+        s_Worker.join();
+    }
 
-    if (s_HasOutfit && !s_FoundOutfits.empty()) {
-        for (const auto& s_OutfitBrickRuntimeResourceId : s_FoundOutfits) {
-            if (s_OutfitBrickRuntimeResourceId == ResId<
-                "[assembly:/_pro/scenes/missions/bangkok/outfits_zika.brick].pc_entitytype"> &&
-                p_SceneName != "Bangkok") {
-                continue;
-            }
-            else if (s_OutfitBrickRuntimeResourceId == ResId<
-                "[assembly:/_pro/scenes/missions/colorado_2/colorado_outfits.brick].pc_entitytype"> &&
-                p_SceneName != "Colorado") {
-                continue;
+    std::vector<ContractScene> s_ContractScenes;
+
+    for (auto& s_WorkerResult : s_WorkerResults) {
+        s_ContractScenes.insert(s_ContractScenes.end(), s_WorkerResult.begin(), s_WorkerResult.end());
+    }
+
+    // Most locations have many contracts for the same scene, so only look each of them up once.
+    std::ranges::sort(
+        s_ContractScenes, [](const ContractScene& a, const ContractScene& b) {
+            if (a.m_LocationHash != b.m_LocationHash) {
+                return a.m_LocationHash < b.m_LocationHash;
             }
 
-            m_SceneToOutfitBrickIds[p_SceneName].insert(s_OutfitBrickRuntimeResourceId);
+            return a.m_SceneRuntimeResourceId < b.m_SceneRuntimeResourceId;
         }
-    }
-    else {
-        Logger::Warn("No outfit reference found in dependency tree for scene: {}", p_SceneRuntimeResourceId);
-    }
+    );
+
+    const auto s_Duplicates = std::ranges::unique(s_ContractScenes);
+    s_ContractScenes.erase(s_Duplicates.begin(), s_Duplicates.end());
+
+    return s_ContractScenes;
 }
 
-void Outfits::BuildChunkIndexToResourcePackageCount() {
-    m_ChunkIndexToResourcePackageCount.clear();
+void Outfits::BuildSceneToOutfitBrickRuntimeResourceIds(const std::string& p_SceneName, const ZRuntimeResourceID& p_SceneRuntimeResourceId) {
+    auto s_Iterator = m_SceneRuntimeResourceIdToOutfitBrickIds.find(p_SceneRuntimeResourceId);
 
-    const std::filesystem::path s_RuntimeDirectory = GetRuntimeDirectory();
+    if (s_Iterator == m_SceneRuntimeResourceIdToOutfitBrickIds.end()) {
+        // Only the root needs to be looked up by its runtime resource ID. The rest of the tree is walked through
+        // the reference indices, so the resource manager is only locked once per scene instead of once per node.
+        ZMutex& s_ResourceManagerMutex = Globals::ResourceManager->GetMutex();
 
-    if (!std::filesystem::exists(s_RuntimeDirectory)) {
-        Logger::Error("Runtime directory not found: {}", s_RuntimeDirectory.string());
-        return;
-    }
+        s_ResourceManagerMutex.Lock();
 
-    for (const auto& s_DirectoryEntry : std::filesystem::directory_iterator(s_RuntimeDirectory)) {
-        if (!s_DirectoryEntry.is_regular_file()) {
-            continue;
-        }
+        ZResourceIndex s_ResourceIndex;
+        bool s_StartLoading;
 
-        const auto& s_Path = s_DirectoryEntry.path();
+        Functions::ZResourceManager_GetResourceIndex->Call(
+            Globals::ResourceManager,
+            s_ResourceIndex,
+            p_SceneRuntimeResourceId,
+            0,
+            s_StartLoading
+        );
 
-        if (s_Path.extension() != ".rpkg") {
-            continue;
+        ZResourcePtr s_ResourcePtr(s_ResourceIndex);
+
+        s_ResourceManagerMutex.Unlock();
+
+        std::unordered_set<uint32_t> s_Visited;
+        std::unordered_set<ZRuntimeResourceID> s_FoundOutfits;
+
+        const bool s_HasOutfit = s_ResourceIndex.val >= 0 &&
+            FindOutfitReferencesRecursive(s_ResourceIndex.val, s_Visited, s_FoundOutfits);
+
+        if (!s_HasOutfit || s_FoundOutfits.empty()) {
+            Logger::Warn("No outfit reference found in dependency tree for scene: {}", p_SceneRuntimeResourceId);
+            return;
         }
 
-        auto s_ChunkIndex = Util::ResourceUtils::TryParseChunkIndexFromResourcePackagePath(s_Path.string());
+        s_Iterator = m_SceneRuntimeResourceIdToOutfitBrickIds.emplace(
+            p_SceneRuntimeResourceId,
+            std::vector<ZRuntimeResourceID>(s_FoundOutfits.begin(), s_FoundOutfits.end())
+        ).first;
+
+        m_SceneCacheDirty = true;
+    }
 
-        if (!s_ChunkIndex) {
+    for (const auto& s_OutfitBrickRuntimeResourceId : s_Iterator->second) {
+        if (s_OutfitBrickRuntimeResourceId == ResId<
+            "[assembly:/_pro/scenes/missions/bangkok/outfits_zika.brick].pc_entitytype"> &&
+            p_SceneName != "Bangkok") {
+            continue;
+        }
+        else if (s_OutfitBrickRuntimeResourceId == ResId<
+            "[assembly:/_pro/scenes/missions/colorado_2/colorado_outfits.brick].pc_entitytype"> &&
+            p_SceneName != "Colorado") {
             continue;
         }
 
-        m_ChunkIndexToResourcePackageCount[*s_ChunkIndex]++;
+        m_SceneToOutfitBrickIds[p_SceneName].insert(s_OutfitBrickRuntimeResourceId);
     }
 }
 
+size_t Outfits::GetResourcePackageCount(const uint32_t p_ChunkIndex) {
+    // A chunk is mounted as its base package plus one package for every patch level.
+    const int32_t s_MountedPatchLevel = SDK()->GetMountedChunkPatchLevel(p_ChunkIndex);
+
+    if (s_MountedPatchLevel >= 0) {
+        return static_cast<size_t>(s_MountedPatchLevel) + 1;
+    }
+
+    for (const auto* s_PartitionInfo : (*Globals::PackageManager)->m_aPartitionInfos) {
+        if (s_PartitionInfo->m_nIndex == p_ChunkIndex) {
+            return static_cast<size_t>(s_PartitionInfo->m_patchLevel) + 1;
+        }
+    }
+
+    return 0;
+}
+
 bool Outfits::FindOutfitReferencesRecursive(
-    const ZRuntimeResourceID& p_CurrentRuntimeResourceId,
-    std::unordered_set<uint64_t>& p_Visited,
+    const uint32_t p_ResourceIndex,
+    std::unordered_set<uint32_t>& p_Visited,
     std::unordered_set<ZRuntimeResourceID>& p_Found,
     int p_Depth
 ) {
@@ -459,30 +648,11 @@ bool Outfits::FindOutfitReferencesRecursive(
         return false;
     }
 
-    if (!p_Visited.insert(p_CurrentRuntimeResourceId.GetID()).second) {
+    if (!p_Visited.insert(p_ResourceIndex).second) {
         return false;
     }
 
-    ZMutex& s_ResourceManagerMutex = Globals::ResourceManager->GetMutex();
-
-    s_ResourceManagerMutex.Lock();
-
-    ZResourceIndex s_ResourceIndex;
-    bool s_StartLoading;
-
-    Functions::ZResourceManager_GetResourceIndex->Call(
-        Globals::ResourceManager,
-        s_ResourceIndex,
-        p_CurrentRuntimeResourceId,
-        0,
-        s_StartLoading
-    );
-
-    ZResourcePtr s_ResourcePtr(s_ResourceIndex);
-
-    s_ResourceManagerMutex.Unlock();
-
-    const ZResourceContainer::SResourceInfo& s_ResourceInfo = s_ResourcePtr.GetResourceInfo();
+    const ZResourceContainer::SResourceInfo& s_ResourceInfo = (*Globals::ResourceContainer)->m_resources[p_ResourceIndex];
 
     bool s_IsOutfitBrickFound = false;
 
@@ -492,7 +662,7 @@ bool Outfits::FindOutfitReferencesRecursive(
 
         if (s_ReferenceInfo.resourceType == 'CPPT' &&
             s_ReferenceInfo.rid == ResId<"[modules:/zglobaloutfitkit.class].pc_entitytype">) {
-            p_Found.insert(p_CurrentRuntimeResourceId);
+            p_Found.insert(s_ResourceInfo.rid);
 
             s_IsOutfitBrickFound = true;
             continue;
@@ -506,7 +676,7 @@ bool Outfits::FindOutfitReferencesRecursive(
             }
 
             s_IsOutfitBrickFound |=
-                FindOutfitReferencesRecursive(s_ReferenceInfo.rid, p_Visited, p_Found, p_Depth + 1);
+                FindOutfitReferencesRecursive(s_Reference.index, p_Visited, p_Found, p_Depth + 1);
         }
     }
 
@@ -616,7 +786,7 @@ void Outfits::LoadOutfits(const std::vector<std::string>& p_Scenes) {
             continue;
         }
 
-        for (const auto& s_SceneRuntimeResourceId : m_Scenes[s_SceneName]) {
+        for (const auto& s_SceneRuntimeResourceId : GetSceneRuntimeResourceIds(s_SceneName)) {
             const auto& s_ChunkIndices = SDK()->GetChunkIndicesForRuntimeResourceId(s_SceneRuntimeResourceId);
 
             // Case like assembly:/_PRO/Scenes/Missions/TheFacility/_Scene_Mission_Polarbear_Module_002_C.entity
@@ -633,10 +803,29 @@ void Outfits::LoadOutfits(const std::vector<std::string>& p_Scenes) {
             BuildSceneToOutfitBrickRuntimeResourceIds(s_SceneName, s_SceneRuntimeResourceId);
         }
 
+        const uint32_t s_Generation = BumpSceneLoadGeneration(s_SceneName);
+
+        // Spawning a brick is expensive, so spread them over multiple frames instead of
+        // spawning all of them at once.
         for (const auto& s_OutfitBrickRuntimeResourceId : m_SceneToOutfitBrickIds[s_SceneName]) {
-            LoadOutfits(s_SceneName, s_OutfitBrickRuntimeResourceId);
+            QueueMainThreadTask(
+                [this, s_SceneName, s_OutfitBrickRuntimeResourceId, s_Generation]() {
+                    // The scene might have been unloaded, or unloaded and loaded again, before we got to this brick.
+                    if (!IsSceneLoadCurrent(s_SceneName, s_Generation)) {
+                        return;
+                    }
+
+                    LoadOutfits(s_SceneName, s_OutfitBrickRuntimeResourceId);
+                }
+            );
         }
     }
+
+    // Written once for all scenes that were scanned, rather than once per scene.
+    if (m_SceneCacheDirty) {
+        SaveSceneCache();
+        m_SceneCacheDirty = false;
+    }
 }
 
 void Outfits::LoadOutfits(const ZRuntimeResourceID& p_OutfitBrickRuntimeResourceId) {
@@ -650,6 +839,8 @@ void Outfits::LoadOutfits(const ZRuntimeResourceID& p_OutfitBrickRuntimeResource
     ZEntityRef s_EntityRef;
 
     if (LoadBrick(p_OutfitBrickRuntimeResourceId, s_ResourcePtr, s_EntityRef)) {
+        std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
         m_AdditionalLoadedOutfitBricks.insert(
             std::make_pair(p_OutfitBrickRuntimeResourceId, std::make_pair(s_ResourcePtr, s_EntityRef))
         );
@@ -663,7 +854,7 @@ void Outfits::UnloadOutfits(const std::unordered_set<std::string>& p_Scenes) {
     std::unordered_set<uint32_t> s_ChunksToUnmount;
 
     for (const auto& s_SceneName : p_Scenes) {
-        for (const auto& s_SceneRuntimeResourceId : m_Scenes[s_SceneName]) {
+        for (const auto& s_SceneRuntimeResourceId : GetSceneRuntimeResourceIds(s_SceneName)) {
             const auto& s_ChunkIndices = SDK()->GetChunkIndicesForRuntimeResourceId(s_SceneRuntimeResourceId);
 
             if (s_ChunkIndices.size() > 0) {
@@ -677,41 +868,32 @@ void Outfits::UnloadOutfits(const std::unordered_set<std::string>& p_Scenes) {
         }
     }
 
-    ZResourceContainer* s_ResourceContainer = *Globals::ResourceContainer;
-    uint32_t s_EarliestPackageId = UINT32_MAX;
+    const std::vector<uint32_t> s_MountedChunkIndices = SDK()->GetMountedChunkIndices();
+    size_t s_EarliestPosition = s_MountedChunkIndices.size();
     uint32_t s_EarliestChunkIndex = UINT32_MAX;
 
-    for (uint32_t s_PackageId = 0; s_PackageId < s_ResourceContainer->m_MountedPackages.size(); ++s_PackageId) {
-        const ZString& s_PackagePath = s_ResourceContainer->m_MountedPackages[s_PackageId];
-        auto s_ChunkIndex = Util::ResourceUtils::TryParseChunkIndexFromResourcePackagePath(s_PackagePath);
-
-        if (!s_ChunkIndex) {
-            continue;
-        }
-
-        if (s_ChunksToUnmount.contains(*s_ChunkIndex)) {
-            s_EarliestPackageId = s_PackageId;
-            s_EarliestChunkIndex = *s_ChunkIndex;
+    for (size_t i = 0; i < s_MountedChunkIndices.size(); ++i) {
+        if (s_ChunksToUnmount.contains(s_MountedChunkIndices[i])) {
+            s_EarliestPosition = i;
+            s_EarliestChunkIndex = s_MountedChunkIndices[i];
             break;
         }
     }
 
-    for (uint32_t s_PackageId = s_EarliestPackageId; s_PackageId < s_ResourceContainer->m_MountedPackages.size(); ++s_PackageId) {
-        const ZString& s_PackagePath = s_ResourceContainer->m_MountedPackages[s_PackageId];
-        auto s_ChunkIndex = Util::ResourceUtils::TryParseChunkIndexFromResourcePackagePath(s_PackagePath);
-
-        if (!s_ChunkIndex) {
-            continue;
-        }
-
-        s_ChunksToUnmount.insert(*s_ChunkIndex);
-    }
+    // Unmounting a chunk unmounts every chunk that was mounted after it as well.
+    s_ChunksToUnmount.insert(s_MountedChunkIndices.begin() + s_EarliestPosition, s_MountedChunkIndices.end());
 
     UnloadOutfits(s_ChunksToUnmount);
     SDK()->UnmountChunk(s_EarliestChunkIndex, false);
 
     for (const auto& s_SceneName : p_Scenes) {
-        m_LoadedScenes.erase(s_SceneName);
+        {
+            std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
+            m_LoadedScenes.erase(s_SceneName);
+        }
+
+        BumpSceneLoadGeneration(s_SceneName);
     }
 
     for (const auto& s_SceneName : m_LoadedScenes) {
@@ -725,12 +907,15 @@ void Outfits::UnloadOutfits(const std::unordered_set<std::string>& p_Scenes) {
             SDK()->MountChunk(s_ChunkIndex);
         }
 
+        // All bricks of the scene are respawned right away, so tasks that are still queued for it are stale.
+        BumpSceneLoadGeneration(s_SceneName);
+
         for (const auto& s_OutfitBrickRuntimeResourceId : m_SceneToOutfitBrickIds[s_SceneName]) {
             LoadOutfits(s_SceneName, s_OutfitBrickRuntimeResourceId);
         }
     }
 
-    for (const auto& s_OutfitBrickRuntimeResourceId : m_SelectedOutfitBricks) {
+    for (const auto& s_OutfitBrickRuntimeResourceId : GetSelectedOutfitBricks()) {
         const auto& s_ChunkIndices = SDK()->GetChunkIndicesForRuntimeResourceId(s_OutfitBrickRuntimeResourceId);
 
         if (!s_ChunksToUnmount.contains(s_ChunkIndices[0])) {
@@ -760,19 +945,14 @@ void Outfits::UnloadOutfits(const std::vector<ZRuntimeResourceID>& p_OutfitBrick
         }
     }
 
-    ZResourceContainer* s_ResourceContainer = *Globals::ResourceContainer;
-    uint32_t s_EarliestPackageId = UINT32_MAX;
+    const std::vector<uint32_t> s_MountedChunkIndices = SDK()->GetMountedChunkIndices();
+    size_t s_EarliestPosition = s_MountedChunkIndices.size();
     uint32_t s_EarliestChunkIndex = UINT32_MAX;
 
-    for (uint32_t s_PackageId = 0; s_PackageId < s_ResourceContainer->m_MountedPackages.size(); ++s_PackageId) {
-        const ZString& s_PackagePath = s_ResourceContainer->m_MountedPackages[s_PackageId];
-        auto s_ChunkIndex = Util::ResourceUtils::TryParseChunkIndexFromResourcePackagePath(s_PackagePath);
-
-        if (!s_ChunkIndex) {
-            continue;
-        }
+    for (size_t i = 0; i < s_MountedChunkIndices.size(); ++i) {
+        const uint32_t s_ChunkIndex = s_MountedChunkIndices[i];
 
-        if (s_ChunksToUnmount.contains(*s_ChunkIndex)) {
+        if (s_ChunksToUnmount.contains(s_ChunkIndex)) {
             bool s_IsChunkUsedByLoadedScene = false;
 
             for (const auto& s_SceneName : m_LoadedScenes) {
@@ -786,23 +966,15 @@ void Outfits::UnloadOutfits(const std::vector<ZRuntimeResourceID>& p_OutfitBrick
                 continue;
             }
 
-            s_EarliestPackageId = s_PackageId;
-            s_EarliestChunkIndex = *s_ChunkIndex;
+            s_EarliestPosition = i;
+            s_EarliestChunkIndex = s_ChunkIndex;
             break;
         }
     }
 
-    if (s_EarliestPackageId != UINT32_MAX) {
-        for (uint32_t s_PackageId = s_EarliestPackageId; s_PackageId < s_ResourceContainer->m_MountedPackages.size(); ++s_PackageId) {
-            const ZString& s_PackagePath = s_ResourceContainer->m_MountedPackages[s_PackageId];
-            auto s_ChunkIndex = Util::ResourceUtils::TryParseChunkIndexFromResourcePackagePath(s_PackagePath);
-
-            if (!s_ChunkIndex) {
-                continue;
-            }
-
-            s_ChunksToUnmount.insert(*s_ChunkIndex);
-        }
+    if (s_EarliestChunkIndex != UINT32_MAX) {
+        // Unmounting a chunk unmounts every chunk that was mounted after it as well.
+        s_ChunksToUnmount.insert(s_MountedChunkIndices.begin() + s_EarliestPosition, s_MountedChunkIndices.end());
 
         UnloadOutfits(s_ChunksToUnmount);
         SDK()->UnmountChunk(s_EarliestChunkIndex, false);
@@ -818,12 +990,14 @@ void Outfits::UnloadOutfits(const std::vector<ZRuntimeResourceID>& p_OutfitBrick
                 SDK()->MountChunk(s_ChunkIndex);
             }
 
+            BumpSceneLoadGeneration(s_SceneName);
+
             for (const auto& s_OutfitBrickRuntimeResourceId : m_SceneToOutfitBrickIds[s_SceneName]) {
                 LoadOutfits(s_SceneName, s_OutfitBrickRuntimeResourceId);
             }
         }
 
-        for (const auto& s_OutfitBrickRuntimeResourceId : m_SelectedOutfitBricks) {
+        for (const auto& s_OutfitBrickRuntimeResourceId : GetSelectedOutfitBricks()) {
             const auto& s_ChunkIndices = SDK()->GetChunkIndicesForRuntimeResourceId(s_OutfitBrickRuntimeResourceId);
 
             if (!s_ChunksToUnmount.contains(s_ChunkIndices[0])) {
@@ -860,6 +1034,8 @@ void Outfits::UnloadOutfits(const std::vector<ZRuntimeResourceID>& p_OutfitBrick
                 s_ExternalRefs
             );
 
+            std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
             m_AdditionalLoadedOutfitBricks.erase(s_Iterator);
         }
     }
@@ -903,6 +1079,8 @@ void Outfits::UnloadOutfits(const std::unordered_set<uint32_t>& p_Chunks) {
                 s_ExternalRefs
             );
 
+            std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
             s_Iterator = m_AdditionalLoadedOutfitBricks.erase(s_Iterator);
         }
         else {
@@ -911,6 +1089,36 @@ void Outfits::UnloadOutfits(const std::unordered_set<uint32_t>& p_Chunks) {
     }
 }
 
+uint32_t Outfits::BumpSceneLoadGeneration(const std::string& p_SceneName) {
+    return ++m_SceneLoadGenerations[p_SceneName];
+}
+
+const std::unordered_set<ZRuntimeResourceID>& Outfits::GetSceneRuntimeResourceIds(
+    const std::string& p_SceneName
+) const {
+    static const std::unordered_set<ZRuntimeResourceID> s_NoRuntimeResourceIds;
+
+    const auto s_Iterator = m_Scenes.find(p_SceneName);
+
+    return s_Iterator != m_Scenes.end() ? s_Iterator->second : s_NoRuntimeResourceIds;
+}
+
+std::unordered_set<ZRuntimeResourceID> Outfits::GetSelectedOutfitBricks() {
+    std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
+    return m_SelectedOutfitBricks;
+}
+
+bool Outfits::IsSceneLoadCurrent(const std::string& p_SceneName, const uint32_t p_Generation) const {
+    if (!m_LoadedScenes.contains(p_SceneName)) {
+        return false;
+    }
+
+    const auto s_Iterator = m_SceneLoadGenerations.find(p_SceneName);
+
+    return s_Iterator != m_SceneLoadGenerations.end() && s_Iterator->second == p_Generation;
+}
+
 std::string Outfits::ToEntityTemplatePath(const std::string_view p_ScenePath) {
     std::string s_NormalizedPath(p_ScenePath);
 
@@ -919,17 +1127,140 @@ std::string Outfits::ToEntityTemplatePath(const std::string_view p_ScenePath) {
     return std::format("[{}].pc_entitytemplate", s_NormalizedPath);
 }
 
-std::filesystem::path Outfits::GetRuntimeDirectory() {
+std::filesystem::path Outfits::GetSceneCachePath() {
     char s_ExePathStr[MAX_PATH]{};
 
     GetModuleFileNameA(nullptr, s_ExePathStr, MAX_PATH);
 
     std::filesystem::path s_ExePath(s_ExePathStr);
 
-    return s_ExePath.parent_path().parent_path() / "Runtime";
+    return s_ExePath.parent_path() / "outfits_scene_cache.bin";
+}
+
+bool Outfits::LoadSceneCache() {
+    m_GameBuildFingerprint = SDK()->GetGameBuildFingerprint();
+
+    std::ifstream s_Stream(GetSceneCachePath(), std::ios::binary);
+
+    if (!s_Stream) {
+        return false;
+    }
+
+    SceneCacheHeader s_Header {};
+
+    s_Stream.read(reinterpret_cast<char*>(&s_Header), sizeof(s_Header));
+
+    if (!s_Stream ||
+        s_Header.m_Magic != c_SceneCacheMagic ||
+        s_Header.m_Version != c_SceneCacheVersion ||
+        s_Header.m_GameBuildFingerprint != m_GameBuildFingerprint ||
+        s_Header.m_ContractSceneCount > c_MaxSceneCacheEntries) {
+        return false;
+    }
+
+    std::vector<ContractScene> s_ContractScenes(s_Header.m_ContractSceneCount);
+
+    s_Stream.read(
+        reinterpret_cast<char*>(s_ContractScenes.data()),
+        static_cast<std::streamsize>(s_ContractScenes.size() * sizeof(ContractScene))
+    );
+
+    std::unordered_map<ZRuntimeResourceID, std::vector<ZRuntimeResourceID>> s_SceneToOutfitBrickIds;
+
+    for (uint32_t i = 0; i < s_Header.m_OutfitSceneCount && s_Stream; ++i) {
+        uint64_t s_SceneRuntimeResourceId = 0;
+        uint64_t s_OutfitBrickCount = 0;
+
+        s_Stream.read(reinterpret_cast<char*>(&s_SceneRuntimeResourceId), sizeof(s_SceneRuntimeResourceId));
+        s_Stream.read(reinterpret_cast<char*>(&s_OutfitBrickCount), sizeof(s_OutfitBrickCount));
+
+        if (!s_Stream || s_OutfitBrickCount > c_MaxSceneCacheEntries) {
+            return false;
+        }
+
+        std::vector<uint64_t> s_OutfitBrickIds(s_OutfitBrickCount);
+
+        s_Stream.read(
+            reinterpret_cast<char*>(s_OutfitBrickIds.data()),
+            static_cast<std::streamsize>(s_OutfitBrickIds.size() * sizeof(uint64_t))
+        );
+
+        auto& s_OutfitBricks = s_SceneToOutfitBrickIds[s_SceneRuntimeResourceId];
+
+        for (const uint64_t s_OutfitBrickId : s_OutfitBrickIds) {
+            s_OutfitBricks.emplace_back(s_OutfitBrickId);
+        }
+    }
+
+    if (!s_Stream) {
+        Logger::Warn("Outfits scene cache is truncated, rebuilding it.");
+        return false;
+    }
+
+    m_ContractScenes = std::move(s_ContractScenes);
+    m_SceneRuntimeResourceIdToOutfitBrickIds = std::move(s_SceneToOutfitBrickIds);
+
+    return true;
+}
+
+void Outfits::SaveSceneCache() const {
+    const std::filesystem::path s_CachePath = GetSceneCachePath();
+    std::filesystem::path s_TemporaryPath = s_CachePath;
+    s_TemporaryPath += ".tmp";
+
+    {
+        std::ofstream s_Stream(s_TemporaryPath, std::ios::binary | std::ios::trunc);
+
+        if (!s_Stream) {
+            return;
+        }
+
+        const SceneCacheHeader s_Header {
+            .m_Magic = c_SceneCacheMagic,
+            .m_Version = c_SceneCacheVersion,
+            .m_GameBuildFingerprint = m_GameBuildFingerprint,
+            .m_ContractSceneCount = static_cast<uint32_t>(m_ContractScenes.size()),
+            .m_OutfitSceneCount = static_cast<uint32_t>(m_SceneRuntimeResourceIdToOutfitBrickIds.size()),
+        };
+
+        s_Stream.write(reinterpret_cast<const char*>(&s_Header), sizeof(s_Header));
+        s_Stream.write(
+            reinterpret_cast<const char*>(m_ContractScenes.data()),
+            static_cast<std::streamsize>(m_ContractScenes.size() * sizeof(ContractScene))
+        );
+
+        for (const auto& [s_SceneRuntimeResourceId, s_OutfitBrickIds] : m_SceneRuntimeResourceIdToOutfitBrickIds) {
+            const uint64_t s_SceneId = s_SceneRuntimeResourceId.GetID();
+            const uint64_t s_OutfitBrickCount = s_OutfitBrickIds.size();
+
+            s_Stream.write(reinterpret_cast<const char*>(&s_SceneId), sizeof(s_SceneId));
+            s_Stream.write(reinterpret_cast<const char*>(&s_OutfitBrickCount), sizeof(s_OutfitBrickCount));
+
+            for (const auto& s_OutfitBrickRuntimeResourceId : s_OutfitBrickIds) {
+                const uint64_t s_OutfitBrickId = s_OutfitBrickRuntimeResourceId.GetID();
+
+                s_Stream.write(reinterpret_cast<const char*>(&s_OutfitBrickId), sizeof(s_OutfitBrickId));
+            }
+        }
+
+        if (!s_Stream) {
+            Logger::Warn("Could not write outfits scene cache.");
+            return;
+        }
+    }
+
+    std::error_code s_ErrorCode;
+    std::filesystem::rename(s_TemporaryPath, s_CachePath, s_ErrorCode);
+
+    if (s_ErrorCode) {
+        Logger::Warn("Could not move outfits scene cache into place: {}", s_ErrorCode.message());
+        std::filesystem::remove(s_TemporaryPath, s_ErrorCode);
+    }
 }
 
 DEFINE_PLUGIN_DETOUR(Outfits, void, ZLevelManager_StartGame, ZLevelManager* th) {
+    std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
     for (const auto& s_Brick : Globals::Hitman5Module->m_pEntitySceneContext->m_aLoadedBricks) {
         if (s_Brick.m_RuntimeResourceID == ResId<"[assembly:/_pro/scenes/bricks/globaldata_s2.brick].pc_entitytype">) {
             m_IsGlobalDataSeason2BrickLoaded = true;
@@ -945,11 +1276,19 @@ DEFINE_PLUGIN_DETOUR(Outfits, void, ZLevelManager_StartGame, ZLevelManager* th)
 }
 
 DEFINE_PLUGIN_DETOUR(Outfits, void, OnClearScene, ZEntitySceneContext* th, bool p_FullyUnloadScene) {
-    m_SelectedScenes.clear();
+    {
+        std::scoped_lock s_Lock(m_LoadedOutfitsMutex);
+
+        m_SelectedScenes.clear();
+    }
+
     m_LoadedGlobalOutfitBricks.clear();
 
     if (!m_LoadedScenes.empty()) {
-        UnloadOutfits(m_LoadedScenes);
+        // Unloading removes the scenes from m_LoadedScenes, so it can't iterate over that set directly.
+        const std::unordered_set<std::string> s_ScenesToUnload = m_LoadedScenes;
+
+        UnloadOutfits(s_ScenesToUnload);
     }
 
     std::vector<ZRuntimeResourceID> s_OutfitBricksToUnload;
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <mutex>
 #include <unordered_set>
+#include <vector>
 
 #include "IPluginInterface.h"
 
@@ -13,12 +15,36 @@ public:
     void OnDrawUI(bool p_HasFocus) override;
 
 private:
+    struct ContractScene {
+        uint32_t m_LocationHash;
+        uint32_t m_Reserved;
+        ZRuntimeResourceID m_SceneRuntimeResourceId;
+
+        bool operator==(const ContractScene&) const = default;
+    };
+
+    struct SceneCacheHeader {
+        uint32_t m_Magic;
+        uint32_t m_Version;
+        uint64_t m_GameBuildFingerprint;
+        uint32_t m_ContractSceneCount;
+        uint32_t m_OutfitSceneCount;
+    };
+
+    // "OSCX" when read as bytes.
+    static constexpr uint32_t c_SceneCacheMagic = 0x5843534f;
+    static constexpr uint32_t c_SceneCacheVersion = 1;
+
+    // Guards against allocating absurd amounts of memory for a corrupted cache.
+    static constexpr uint64_t c_MaxSceneCacheEntries = 65536;
+
     void BuildSceneNamesToRuntimeResourceIds();
     void BuildSceneToOutfitBrickRuntimeResourceIds(const std::string& p_SceneName, const ZRuntimeResourceID& p_SceneRuntimeResourceId);
-    void BuildChunkIndexToResourcePackageCount();
+    static size_t GetResourcePackageCount(uint32_t p_ChunkIndex);
+    static std::vector<ContractScene> ScanContracts();
     static bool FindOutfitReferencesRecursive(
-        const ZRuntimeResourceID& p_CurrentRuntimeResourceId,
-        std::unordered_set<uint64_t>& p_Visited,
+        uint32_t p_ResourceIndex,
+        std::unordered_set<uint32_t>& p_Visited,
         std::unordered_set<ZRuntimeResourceID>& p_Found,
         int p_Depth = 0
     );
@@ -28,14 +54,31 @@ private:
         ZEntityRef& p_EntityRef
     );
     bool LoadGlobalDataBrick(const ZRuntimeResourceID& p_BrickRuntimeResourceId);
+    void DrawGlobalDataBrickCheckbox(
+        const char* p_Label,
+        const ZRuntimeResourceID& p_BrickRuntimeResourceId,
+        bool& p_IsBrickLoaded
+    );
+    void ApplyOutfitSelection(
+        const std::unordered_set<std::string>& p_SelectedScenes,
+        const std::unordered_set<ZRuntimeResourceID>& p_SelectedOutfitBricks,
+        const std::string& p_BrickResourceId
+    );
     void LoadOutfits(const std::string& p_SceneName, const ZRuntimeResourceID& p_OutfitBrickRuntimeResourceId);
     void LoadOutfits(const std::vector<std::string>& p_Scenes);
     void LoadOutfits(const ZRuntimeResourceID& p_OutfitBrickRuntimeResourceId);
     void UnloadOutfits(const std::unordered_set<std::string>& p_Scenes);
     void UnloadOutfits(const std::vector<ZRuntimeResourceID>& p_OutfitBrickRuntimeResourceIds);
     void UnloadOutfits(const std::unordered_set<uint32_t>& p_Chunks);
+    uint32_t BumpSceneLoadGeneration(const std::string& p_SceneName);
+    const std::unordered_set<ZRuntimeResourceID>& GetSceneRuntimeResourceIds(const std::string& p_SceneName) const;
+    std::unordered_set<ZRuntimeResourceID> GetSelectedOutfitBricks();
+    bool IsSceneLoadCurrent(const std::string& p_SceneName, uint32_t p_Generation) const;
+
     static std::string ToEntityTemplatePath(const std::string_view p_ScenePath);
-    static std::filesystem::path GetRuntimeDirectory();
+    static std::filesystem::path GetSceneCachePath();
+    bool LoadSceneCache();
+    void SaveSceneCache() const;
 
     DECLARE_PLUGIN_DETOUR(Outfits, void, OnClearScene, ZEntitySceneContext* th, bool p_FullyUnloadScene);
 
@@ -43,12 +86,28 @@ private:
 
     bool m_OutfitsMenuActive = false;
 
+    // Built by the UI before any scene can be selected and never changed afterwards.
     std::map<std::string, std::unordered_set<ZRuntimeResourceID>> m_Scenes;
     std::unordered_map<std::string, uint32_t> m_SceneToChunkIndex;
     std::unordered_map<std::string, std::unordered_set<ZRuntimeResourceID>> m_SceneToOutfitBrickIds;
+
+    // Scanning the contracts and walking the scenes for outfit bricks is slow, so the results are cached on disk
+    // for as long as the game build stays the same. Scene names are localized, so the cache only stores the
+    // location hashes they're looked up with.
+    uint64_t m_GameBuildFingerprint = 0;
+    std::vector<ContractScene> m_ContractScenes;
+    std::unordered_map<ZRuntimeResourceID, std::vector<ZRuntimeResourceID>> m_SceneRuntimeResourceIdToOutfitBrickIds;
+    bool m_SceneCacheDirty = false;
+
+    // Scenes and bricks are only loaded and unloaded on the main thread, the UI queues a task with its selection.
+    // The mutex guards the state the UI draws: the selection, the loaded scenes and bricks and the popup. The main
+    // thread locks it to write that state and the UI to copy it, never while mounting chunks or spawning bricks.
+    // Every load or respawn of a scene bumps its generation, so queued tasks of an earlier load can tell that
+    // they're stale and don't spawn their brick twice.
+    std::mutex m_LoadedOutfitsMutex;
     std::unordered_set<std::string> m_SelectedScenes;
+    std::unordered_map<std::string, uint32_t> m_SceneLoadGenerations;
     std::unordered_set<std::string> m_LoadedScenes;
-    std::unordered_map<uint32_t, size_t> m_ChunkIndexToResourcePackageCount;
     std::unordered_set<uint32_t> m_PendingChunks;
     std::unordered_map<std::string, std::vector<std::pair<ZResourcePtr, ZEntityRef>>> m_SceneToLoadedOutfitBricks;
     std::unordered_map<ZRuntimeResourceID, std::pair<ZResourcePtr, ZEntityRef>> m_LoadedGlobalOutfitBricks;
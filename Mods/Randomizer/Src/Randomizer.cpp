@@ -2,6 +2,7 @@
 
 #include <random>
 #include <filesystem>
+#include <bit>
 
 #include "IconsMaterialDesign.h"
 
@@ -20,6 +21,7 @@
 #include "Glacier/SExternalReferences.h"
 #include "Glacier/ZUIMap.h"
 
+#include "RepositoryIndex.h"
 #include "Util/ImGuiUtils.h"
 #include "Util/ResourceUtils.h"
 
@@ -542,7 +544,7 @@ void Randomizer::DrawPropsToExcludeTab() {
             }
 
             m_PropsToExclude.push_back(std::make_pair(p_Id, p_Name));
-            m_ExcludedPropRepositoryIds.insert(p_Id);
+            SetPropExcluded(p_Id, true);
 
             SetSettingBool("props_to_exclude", Util::StringUtils::ToLowerCase(p_Id.ToString().c_str()), true);
         },
@@ -592,8 +594,8 @@ void Randomizer::DrawPropsToExcludeTab() {
         if (ImGui::SmallButton(ICON_MD_DELETE)) {
             RemoveSetting("props_to_exclude", Util::StringUtils::ToLowerCase(s_RepositoryId.ToString().c_str()));
 
+            SetPropExcluded(s_RepositoryId, false);
             m_PropsToExclude.erase(m_PropsToExclude.begin() + i);
-            m_ExcludedPropRepositoryIds.erase(s_RepositoryId);
 
             ImGui::PopID();
 
@@ -620,7 +622,7 @@ void Randomizer::DrawPropsToExcludeTab() {
             }
 
             m_PropsToExclude.clear();
-            m_ExcludedPropRepositoryIds.clear();
+            std::ranges::fill(m_ExcludedPropBits, 0);
         }
 
         ImGui::EndDisabled();
@@ -1095,234 +1097,207 @@ void Randomizer::DrawOutfitsToExcludeTab() {
 void Randomizer::LoadRepositoryProps() {
     m_AllRepositoryProps.clear();
 
-    if (m_RepositoryResource.m_nResourceIndex.val == -1) {
-        const auto s_ID = ResId<"[assembly:/repository/pro.repo].pc_repo">;
+    const auto s_RepositoryIndex = SDK()->GetRepositoryIndex();
 
-        Globals::ResourceManager->LoadResource(m_RepositoryResource, s_ID);
+    if (!s_RepositoryIndex) {
+        return;
     }
 
-    if (m_RepositoryResource.GetResourceInfo().status == RESOURCE_STATUS_VALID) {
-        const auto s_RepositoryData = static_cast<THashMap<
-            ZRepositoryID, ZDynamicObject, TDefaultHashMapPolicy<ZRepositoryID>>*>(m_RepositoryResource.
-                GetResourceData());
+    // Items are already sorted by name.
+    for (const uint32_t s_Index : s_RepositoryIndex->GetItems()) {
+        const std::string s_InventoryCategory(s_RepositoryIndex->GetCategory(s_Index));
 
-        for (const auto& [s_RepositoryID, s_DynamicObject] : *s_RepositoryData) {
-            TArray<SDynamicObjectKeyValuePair>* s_Entries = s_DynamicObject.As<TArray<
-                SDynamicObjectKeyValuePair>>();
+        if (s_InventoryCategory == "Evergreen_payout") {
+            continue;
+        }
 
-            ZString s_Id, s_Title, s_CommonName, s_Name, s_InventoryCategoryIcon;
-            std::string s_FinalName;
-            bool s_IsItem = false;
-            bool s_IsWeapon = false;
+        const bool s_IsWeapon = s_RepositoryIndex->IsWeapon(s_Index);
 
-            for (auto& s_Entry : *s_Entries) {
-                if (s_Entry.sKey == "ID_") {
-                    s_Id = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "Title") {
-                    s_Title = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "CommonName") {
-                    s_CommonName = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "Name") {
-                    s_Name = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "InventoryCategoryIcon") {
-                    s_InventoryCategoryIcon = *s_Entry.value.As<ZString>();
+        m_AllRepositoryProps.push_back(std::make_tuple(
+            s_RepositoryIndex->GetId(s_Index),
+            s_RepositoryIndex->GetDisplayName(s_Index),
+            s_IsWeapon,
+            s_InventoryCategory
+        ));
 
-                    if (s_InventoryCategoryIcon == "INVALID_CATEGORY_ICON") {
-                        s_InventoryCategoryIcon = "other";
-                    }
-                    else if (s_InventoryCategoryIcon == "questitem") {
-                        s_InventoryCategoryIcon = "questItem";
-                    }
-                }
-                else if (s_Entry.sKey == "ItemType") {
-                    s_IsItem = true;
-                }
-                else if (s_Entry.sKey == "PrimaryConfiguration") {
-                    s_IsWeapon = true;
-                }
-            }
+        if (s_IsWeapon) {
+            m_RepositoryWeapons.insert(s_RepositoryIndex->GetId(s_Index));
+        }
 
-            if (s_Id.IsEmpty() || !s_IsItem || s_InventoryCategoryIcon == "evergreen_payout") {
-                continue;
-            }
+        m_InventoryCategoryToState.insert(std::make_pair(s_InventoryCategory, true));
+    }
 
-            if (s_Title.IsEmpty() && s_CommonName.IsEmpty() && s_Name.IsEmpty()) {
-                s_FinalName = std::format("<unnamed> [{}]", s_Id.c_str());
-            }
-            else if (!s_Title.IsEmpty()) {
-                s_FinalName = std::format("{} [{}]", s_Title.c_str(), s_Id.c_str());
-            }
-            else if (!s_CommonName.IsEmpty()) {
-                s_FinalName = std::format("{} [{}]", s_CommonName.c_str(), s_Id.c_str());
-            }
-            else if (!s_Name.IsEmpty()) {
-                s_FinalName = std::format("{} [{}]", s_Name.c_str(), s_Id.c_str());
-            }
+    const size_t s_WordCount = (m_AllRepositoryProps.size() + 63) / 64;
 
-            std::string s_InventoryCategoryIcon2 = s_InventoryCategoryIcon.c_str();
-            s_InventoryCategoryIcon2[0] = std::toupper(s_InventoryCategoryIcon2[0]);
+    m_RepositoryIdToPropIndex.clear();
+    m_RepositoryIdToPropIndex.reserve(m_AllRepositoryProps.size());
+    m_SpawnablePropBits.assign(s_WordCount, 0);
+    m_WeaponPropBits.assign(s_WordCount, 0);
+    m_ExcludedPropBits.assign(s_WordCount, 0);
+    m_InventoryCategoryToPropBits.clear();
+    m_ArePropsFiltered = false;
 
-            m_AllRepositoryProps.push_back(std::make_tuple(
-                s_Id,
-                s_FinalName,
-                s_IsWeapon,
-                s_InventoryCategoryIcon2
-            ));
+    for (size_t i = 0; i < m_AllRepositoryProps.size(); ++i) {
+        const auto& [s_RepositoryId, s_Name, s_IsWeapon, s_InventoryCategory] = m_AllRepositoryProps[i];
+        const uint64_t s_Bit = 1ull << (i % 64);
 
-            if (s_IsWeapon) {
-                m_RepositoryWeapons.insert(s_Id);
-            }
+        m_RepositoryIdToPropIndex.emplace(s_RepositoryId, static_cast<uint32_t>(i));
 
-            m_InventoryCategoryToState.insert(std::make_pair(s_InventoryCategoryIcon2, true));
+        if (!s_Name.starts_with("Gadget_Camera") && !s_Name.contains("Gadget_Camera_Tagging")) {
+            m_SpawnablePropBits[i / 64] |= s_Bit;
         }
-    }
 
-    std::ranges::sort(
-        m_AllRepositoryProps,
-        [](const auto& a, const auto& b) {
-            auto [s_RepositoryIdA, s_NameA, s_IsWeaponA, s_InventoryCategoryIconA] = a;
-            auto [s_RepositoryIdB, s_NameB, s_IsWeaponB, s_InventoryCategoryIconB] = b;
+        if (s_IsWeapon) {
+            m_WeaponPropBits[i / 64] |= s_Bit;
+        }
 
-            std::ranges::transform(s_NameA, s_NameA.begin(), [](unsigned char c) { return std::tolower(c); });
-            std::ranges::transform(s_NameB, s_NameB.begin(), [](unsigned char c) { return std::tolower(c); });
+        auto& s_CategoryBits = m_InventoryCategoryToPropBits[s_InventoryCategory];
 
-            return s_NameA < s_NameB;
+        if (s_CategoryBits.empty()) {
+            s_CategoryBits.resize(s_WordCount, 0);
         }
-    );
+
+        s_CategoryBits[i / 64] |= s_Bit;
+    }
 }
 
 void Randomizer::LoadRepositoryOutfits() {
     m_AllRepositoryOutfits.clear();
 
-    if (m_RepositoryResource.m_nResourceIndex.val == -1) {
-        const auto s_ID = ResId<"[assembly:/repository/pro.repo].pc_repo">;
+    const auto s_RepositoryIndex = SDK()->GetRepositoryIndex();
 
-        Globals::ResourceManager->LoadResource(m_RepositoryResource, s_ID);
+    if (!s_RepositoryIndex) {
+        return;
     }
 
-    if (m_RepositoryResource.GetResourceInfo().status == RESOURCE_STATUS_VALID) {
-        const auto s_RepositoryData = static_cast<THashMap<
-            ZRepositoryID, ZDynamicObject, TDefaultHashMapPolicy<ZRepositoryID>>*>(m_RepositoryResource.
-                GetResourceData());
-
-        for (const auto& [s_RepositoryID, s_DynamicObject] : *s_RepositoryData) {
-            TArray<SDynamicObjectKeyValuePair>* s_Entries = s_DynamicObject.As<TArray<
-                SDynamicObjectKeyValuePair>>();
-
-            ZString s_Id, s_CommonName;
-            std::string s_FinalName;
-            bool s_IsOufit = false;
-            bool s_HeroDisguiseAvailable = false;
-            bool s_IsHitmanSuit = false;
-
-            for (auto& s_Entry : *s_Entries) {
-                if (s_Entry.sKey == "ID_") {
-                    s_Id = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "CommonName") {
-                    s_CommonName = *s_Entry.value.As<ZString>();
-                }
-                else if (s_Entry.sKey == "HeroDisguiseAvailable") {
-                    s_HeroDisguiseAvailable = *s_Entry.value.As<bool>();
-                }
-                else if (s_Entry.sKey == "IsHitmanSuit") {
-                    s_IsHitmanSuit = *s_Entry.value.As<bool>();
-                    s_IsOufit = true;
-                }
-            }
+    // Outfits are already sorted by name.
+    for (const uint32_t s_Index : s_RepositoryIndex->GetOutfits()) {
+        const ZRepositoryID& s_Id = s_RepositoryIndex->GetId(s_Index);
 
-            if (s_Id.IsEmpty() || !s_IsOufit) {
-                continue;
-            }
-
-            if (s_CommonName.IsEmpty()) {
-                s_FinalName = std::format("<unnamed> [{}]", s_Id.c_str());
-            }
-            else {
-                s_FinalName = std::format("{} [{}]", s_CommonName.c_str(), s_Id.c_str());
-            }
+        m_AllRepositoryOutfits.push_back(std::make_tuple(s_Id, s_RepositoryIndex->GetDisplayName(s_Index)));
 
-            m_AllRepositoryOutfits.push_back(std::make_tuple(s_Id, s_FinalName));
-
-            if (s_HeroDisguiseAvailable) {
-                m_PlayerOutfits.insert(s_Id);
-            }
+        if (s_RepositoryIndex->IsHeroDisguiseAvailable(s_Index)) {
+            m_PlayerOutfits.insert(s_Id);
+        }
 
-            if (!s_IsHitmanSuit && s_CommonName != "CHAR_Hokkaido_Hero_NinjaSuit_M_HPA2700") {
-                m_ActorOutfits.insert(s_Id);
-            }
+        if (!s_RepositoryIndex->IsHitmanSuit(s_Index) &&
+            s_RepositoryIndex->GetCommonName(s_Index) != "CHAR_Hokkaido_Hero_NinjaSuit_M_HPA2700") {
+            m_ActorOutfits.insert(s_Id);
         }
     }
+}
 
-    std::ranges::sort(
-        m_AllRepositoryOutfits,
-        [](const auto& a, const auto& b) {
-            auto [s_RepositoryIdA, s_NameA] = a;
-            auto [s_RepositoryIdB, s_NameB] = b;
+void Randomizer::SetPropExcluded(const ZRepositoryID& p_RepositoryId, const bool p_IsExcluded) {
+    const auto s_It = m_RepositoryIdToPropIndex.find(p_RepositoryId);
 
-            std::ranges::transform(s_NameA, s_NameA.begin(), [](unsigned char c) { return std::tolower(c); });
-            std::ranges::transform(s_NameB, s_NameB.begin(), [](unsigned char c) { return std::tolower(c); });
+    if (s_It == m_RepositoryIdToPropIndex.end()) {
+        return;
+    }
 
-            return s_NameA < s_NameB;
-        }
-    );
+    const uint64_t s_Bit = 1ull << (s_It->second % 64);
+
+    if (p_IsExcluded) {
+        m_ExcludedPropBits[s_It->second / 64] |= s_Bit;
+    }
+    else {
+        m_ExcludedPropBits[s_It->second / 64] &= ~s_Bit;
+    }
 }
 
 void Randomizer::FilterRepositoryProps() {
-    m_PropsToSpawnInWorld.clear();
-    m_PropsToSpawnInStash.clear();
-    m_PropsToSpawnInPlayerInventory.clear();
-    m_PropsToSpawnInActorInventory.clear();
-    m_WeaponsToSpawnInActorInventory.clear();
-    ZWorldInventory* inv = Globals::WorldInventory;
     if (m_PropsToSpawn.empty()) {
-        for (const auto& [s_RepositoryId, s_Name, s_IsWeapon, s_InventoryCategoryName] : m_AllRepositoryProps) {
-            if (s_Name.starts_with("Gadget_Camera") || s_Name.contains("Gadget_Camera_Tagging")) {
-                continue;
-            }
+        const size_t s_WordCount = m_SpawnablePropBits.size();
+        std::vector<uint64_t> s_FilteredPropBits(s_WordCount, 0);
 
-            if (!m_InventoryCategoryToState[s_InventoryCategoryName]) {
+        for (const auto& [s_InventoryCategory, s_IsEnabled] : m_InventoryCategoryToState) {
+            if (!s_IsEnabled) {
                 continue;
             }
 
-            if (!s_IsWeapon && !m_RandomizeItems) {
-                continue;
-            }
+            const auto s_It = m_InventoryCategoryToPropBits.find(s_InventoryCategory);
 
-            if (s_IsWeapon && !m_RandomizeWeapons) {
+            if (s_It == m_InventoryCategoryToPropBits.end()) {
                 continue;
             }
 
-            if (m_ExcludedPropRepositoryIds.contains(s_RepositoryId)) {
-                continue;
+            for (size_t i = 0; i < s_WordCount; ++i) {
+                s_FilteredPropBits[i] |= s_It->second[i];
             }
+        }
 
-            if (m_RandomizeWorldProps) {
-                m_PropsToSpawnInWorld.push_back(s_RepositoryId);
-            }
+        for (size_t i = 0; i < s_WordCount; ++i) {
+            uint64_t s_TypeMask = 0;
 
-            if (m_RandomizeStashProps) {
-                m_PropsToSpawnInStash.push_back(s_RepositoryId);
+            if (m_RandomizeItems) {
+                s_TypeMask |= ~m_WeaponPropBits[i];
             }
 
-            if (m_RandomizePlayerInventory) {
-                m_PropsToSpawnInPlayerInventory.push_back(s_RepositoryId);
+            if (m_RandomizeWeapons) {
+                s_TypeMask |= m_WeaponPropBits[i];
             }
 
-            if (m_RandomizeActorInventory) {
-                m_PropsToSpawnInActorInventory.push_back(s_RepositoryId);
+            s_FilteredPropBits[i] &= m_SpawnablePropBits[i] & s_TypeMask & ~m_ExcludedPropBits[i];
+        }
 
-                if (s_IsWeapon) {
-                    m_WeaponsToSpawnInActorInventory.push_back(s_RepositoryId);
+        const uint8_t s_FilteredPropTargets = (m_RandomizeWorldProps ? 1 << 0 : 0) |
+            (m_RandomizeStashProps ? 1 << 1 : 0) |
+            (m_RandomizePlayerInventory ? 1 << 2 : 0) |
+            (m_RandomizeActorInventory ? 1 << 3 : 0);
+
+        if (m_ArePropsFiltered &&
+            s_FilteredPropTargets == m_FilteredPropTargets &&
+            s_FilteredPropBits == m_FilteredPropBits) {
+            return;
+        }
+
+        m_PropsToSpawnInWorld.clear();
+        m_PropsToSpawnInStash.clear();
+        m_PropsToSpawnInPlayerInventory.clear();
+        m_PropsToSpawnInActorInventory.clear();
+        m_WeaponsToSpawnInActorInventory.clear();
+
+        for (size_t i = 0; i < s_WordCount; ++i) {
+            for (uint64_t s_Word = s_FilteredPropBits[i]; s_Word != 0; s_Word &= s_Word - 1) {
+                const size_t s_PropIndex = i * 64 + std::countr_zero(s_Word);
+                const auto& [s_RepositoryId, s_Name, s_IsWeapon, s_InventoryCategoryName] =
+                    m_AllRepositoryProps[s_PropIndex];
+
+                if (m_RandomizeWorldProps) {
+                    m_PropsToSpawnInWorld.push_back(s_RepositoryId);
+                }
+
+                if (m_RandomizeStashProps) {
+                    m_PropsToSpawnInStash.push_back(s_RepositoryId);
+                }
+
+                if (m_RandomizePlayerInventory) {
+                    m_PropsToSpawnInPlayerInventory.push_back(s_RepositoryId);
+                }
+
+                if (m_RandomizeActorInventory) {
+                    m_PropsToSpawnInActorInventory.push_back(s_RepositoryId);
+
+                    if (s_IsWeapon) {
+                        m_WeaponsToSpawnInActorInventory.push_back(s_RepositoryId);
+                    }
                 }
             }
         }
+
+        m_FilteredPropBits = std::move(s_FilteredPropBits);
+        m_FilteredPropTargets = s_FilteredPropTargets;
+        m_ArePropsFiltered = true;
     }
     else {
+        m_PropsToSpawnInWorld.clear();
+        m_PropsToSpawnInStash.clear();
+        m_PropsToSpawnInPlayerInventory.clear();
+        m_PropsToSpawnInActorInventory.clear();
+        m_WeaponsToSpawnInActorInventory.clear();
+
+        // The explicit list can change without touching any of the bitsets, so the cached result is stale now.
+        m_ArePropsFiltered = false;
+
         for (const auto& s_PropToSpawn : m_PropsToSpawn) {
             auto& [
                 s_RepositoryId,
@@ -1704,7 +1679,7 @@ void Randomizer::LoadPropsToExcludeFromSettings() {
         }
 
         m_PropsToExclude.push_back(std::make_pair(s_RepositoryId, s_Name));
-        m_ExcludedPropRepositoryIds.insert(s_RepositoryId);
+        SetPropExcluded(s_RepositoryId, true);
     }
 }
 
@@ -27,6 +27,7 @@ private:
 
     void LoadRepositoryProps();
     void LoadRepositoryOutfits();
+    void SetPropExcluded(const ZRepositoryID& p_RepositoryId, bool p_IsExcluded);
     void FilterRepositoryProps();
     void FilterRepositoryOutfits();
 
@@ -181,7 +182,6 @@ private:
 
     int32_t m_RepositoryPropSpawnCount = 1;
 
-    TResourcePtr<ZTemplateEntityFactory> m_RepositoryResource;
     std::vector<std::tuple<ZRepositoryID, std::string, bool, std::string>> m_AllRepositoryProps;
     std::unordered_set<ZRepositoryID> m_RepositoryWeapons;
     std::vector<std::pair<ZRepositoryID, std::string>> m_AllRepositoryOutfits;
@@ -196,7 +196,18 @@ private:
     std::vector<ZRepositoryID> m_PropsToSpawnInActorInventory;
     std::vector<ZRepositoryID> m_WeaponsToSpawnInActorInventory;
     std::vector<std::pair<ZRepositoryID, std::string>> m_PropsToExclude;
-    std::unordered_set<ZRepositoryID> m_ExcludedPropRepositoryIds;
+
+    // Bitsets over m_AllRepositoryProps, one bit per prop. The props only change when the repository is reloaded,
+    // so FilterRepositoryProps can combine these word by word and skip rebuilding the spawn lists when the result
+    // and the spawn targets are the same as last time.
+    std::unordered_map<ZRepositoryID, uint32_t> m_RepositoryIdToPropIndex;
+    std::vector<uint64_t> m_SpawnablePropBits;
+    std::vector<uint64_t> m_WeaponPropBits;
+    std::vector<uint64_t> m_ExcludedPropBits;
+    std::unordered_map<std::string, std::vector<uint64_t>> m_InventoryCategoryToPropBits;
+    std::vector<uint64_t> m_FilteredPropBits;
+    uint8_t m_FilteredPropTargets = 0;
+    bool m_ArePropsFiltered = false;
 
     bool m_SpawnInWorld = true;
     bool m_SpawnInStash = true;
@@ -3,6 +3,7 @@
 #include <Hooks.h>
 #include <Logging.h>
 #include <Globals.h>
+#include <RepositoryIndex.h>
 
 #include <Glacier/CompileReflection.h>
 #include <Glacier/EUpdateMode.h>
@@ -20,7 +21,8 @@
  *
  * The SMF TitaniumBullets mod works by patching entries in `pro.repo` so that ammo uses an
  * ammo config with penetration enabled. This plugin replicates that behaviour at runtime by
- * editing the in-memory repository objects (and restoring them when disabled).
+ * editing the in-memory repository objects through the SDK on the main thread (and restoring
+ * them when disabled).
  */
 
 namespace {
@@ -51,37 +53,19 @@ static const std::array<ZRepositoryID, 20> kTargets = {
     ZRepositoryID("fb1ed921-817d-4ced-9e0d-85743fb23aaa"),
 };
 
-bool IsTargetId(const ZRepositoryID& p_Id) {
-    return std::find(kTargets.begin(), kTargets.end(), p_Id) != kTargets.end();
-}
-
-static const ZString kIdKey = ZString(std::string_view("ID_"));
-static const ZString kAmmoConfigKey = ZString(std::string_view("AmmoConfig"));
-
-ZRepositoryID GetRepoIdFromDynamicObjectOrDefault(const ZDynamicObject& p_Value) {
-    if (const auto s_Repo = p_Value.As<ZRepositoryID>()) {
-        return *s_Repo;
-    }
-
-    if (const auto s_Str = p_Value.As<ZString>()) {
-        return ZRepositoryID(*s_Str);
-    }
-
-    return ZRepositoryID("00000000-0000-0000-0000-000000000000");
-}
-
-SDynamicObjectKeyValuePair* FindPair(TArray<SDynamicObjectKeyValuePair>* p_Entries, const ZString& p_Key) {
-    if (!p_Entries) {
-        return nullptr;
+// Get an AmmoConfig pointing at the penetration config, keeping the type of the original value.
+bool GetPenetrationAmmoConfig(const ZDynamicObject& p_AmmoConfig, ZDynamicObject& p_PenetrationAmmoConfig) {
+    if (p_AmmoConfig.As<ZRepositoryID>()) {
+        p_PenetrationAmmoConfig = kPenetrationAmmoConfigId;
+        return true;
     }
 
-    for (auto& entry : *p_Entries) {
-        if (entry.sKey == p_Key) {
-            return &entry;
-        }
+    if (p_AmmoConfig.As<ZString>()) {
+        p_PenetrationAmmoConfig = ZString(std::string_view(kPenetrationAmmoConfigIdStr));
+        return true;
     }
 
-    return nullptr;
+    return false;
 }
 } // namespace
 
@@ -121,10 +105,6 @@ void TitaniumBullets::OnEngineInitialized() {
         "[TitaniumBullets] Ready (enabled={}). Will apply repository patch when available.",
         m_Enabled
     );
-
-    if (m_Enabled) {
-        ApplyRepositoryPatch();
-    }
 }
 
 void TitaniumBullets::OnFrameUpdate(const SGameUpdateEvent&) {
@@ -135,25 +115,14 @@ void TitaniumBullets::OnFrameUpdate(const SGameUpdateEvent&) {
     ApplyRepositoryPatch();
 }
 
-bool TitaniumBullets::EnsureRepositoryLoaded() {
-    if (!Globals::ResourceManager) {
-        return false;
-    }
-
-    if (m_RepositoryResource.m_nResourceIndex.val == -1) {
-        const auto s_Id = ResId<"[assembly:/repository/pro.repo].pc_repo">;
-        Globals::ResourceManager->GetResourcePtr(m_RepositoryResource, s_Id, 0);
-    }
-
-    return m_RepositoryResource && m_RepositoryResource.GetResourceInfo().status == RESOURCE_STATUS_VALID;
-}
-
 bool TitaniumBullets::ApplyRepositoryPatch() {
     if (m_PatchApplied) {
         return true;
     }
 
-    if (!EnsureRepositoryLoaded()) {
+    const auto s_RepositoryIndex = SDK()->GetRepositoryIndex();
+
+    if (!s_RepositoryIndex) {
         if (!m_LogRepoNotReadyOnce) {
             Logger::Debug("[TitaniumBullets] pro.repo not ready yet; waiting...");
             m_LogRepoNotReadyOnce = true;
@@ -164,89 +133,45 @@ bool TitaniumBullets::ApplyRepositoryPatch() {
 
     m_LogRepoNotReadyOnce = false;
 
-    const auto s_RepositoryData = static_cast<THashMap<
-        ZRepositoryID, ZDynamicObject, TDefaultHashMapPolicy<ZRepositoryID>>*>(m_RepositoryResource.GetResourceData());
-
-    if (!s_RepositoryData) {
-        Logger::Warn("[TitaniumBullets] pro.repo resource data is null");
-        m_AutoApplyDisabled = true;
-        return false;
-    }
-
     // Clear any stale state and re-capture originals for this scene/load.
     m_OriginalAmmoConfigs.clear();
     m_OriginalAmmoConfigs.reserve(kTargets.size());
     m_RepoEntriesPatched = 0;
 
-    // 1) Fast-path: patch by hashmap key (if keys match SMF IDs)
+    // The repository index resolves targets both by hashmap key and by their ID_ field.
     for (const auto& s_TargetId : kTargets) {
-        auto s_It = s_RepositoryData->find(s_TargetId);
-        if (s_It == s_RepositoryData->end()) {
+        const uint32_t s_Index = s_RepositoryIndex->Find(s_TargetId);
+
+        if (s_Index == RepositoryIndex::c_InvalidIndex) {
             continue;
         }
 
-        auto& s_DynamicObject = s_It->second;
-        auto* s_Entries = s_DynamicObject.As<TArray<SDynamicObjectKeyValuePair>>();
+        const auto* s_AmmoConfigPair = s_RepositoryIndex->GetAmmoConfig(s_Index);
 
-        auto* s_AmmoConfigPair = FindPair(s_Entries, kAmmoConfigKey);
         if (!s_AmmoConfigPair) {
+            Logger::Warn("[TitaniumBullets] Target entry missing AmmoConfig (ID={})", s_TargetId.ToString());
             continue;
         }
 
-        if (s_AmmoConfigPair->value.As<ZRepositoryID>()) {
-            m_OriginalAmmoConfigs.emplace_back(s_TargetId, s_AmmoConfigPair->value);
-            s_AmmoConfigPair->value = kPenetrationAmmoConfigId;
-            ++m_RepoEntriesPatched;
-        } else if (s_AmmoConfigPair->value.As<ZString>()) {
-            m_OriginalAmmoConfigs.emplace_back(s_TargetId, s_AmmoConfigPair->value);
-            s_AmmoConfigPair->value = ZString(std::string_view(kPenetrationAmmoConfigIdStr));
-            ++m_RepoEntriesPatched;
-        }
-    }
-
-    // 2) Fallback: some versions may not use ID_ as the hashmap key; scan by ID_ field.
-    if (m_RepoEntriesPatched == 0) {
-        for (auto& [s_MapKey, s_DynamicObject] : *s_RepositoryData) {
-            auto* s_Entries = s_DynamicObject.As<TArray<SDynamicObjectKeyValuePair>>();
-            if (!s_Entries) {
-                continue;
-            }
-
-            auto* s_IdPair = FindPair(s_Entries, kIdKey);
-            if (!s_IdPair) {
-                continue;
-            }
-
-            const auto s_RepoId = GetRepoIdFromDynamicObjectOrDefault(s_IdPair->value);
-            if (!IsTargetId(s_RepoId)) {
-                continue;
-            }
+        const ZDynamicObject s_OriginalAmmoConfig = s_AmmoConfigPair->value;
+        ZDynamicObject s_PenetrationAmmoConfig;
 
-            auto* s_AmmoConfigPair = FindPair(s_Entries, kAmmoConfigKey);
-            if (!s_AmmoConfigPair) {
-                Logger::Warn("[TitaniumBullets] Target entry missing AmmoConfig (ID={})", s_RepoId.ToString());
-                continue;
-            }
-
-            if (s_AmmoConfigPair->value.As<ZRepositoryID>()) {
-                m_OriginalAmmoConfigs.emplace_back(s_MapKey, s_AmmoConfigPair->value);
-                s_AmmoConfigPair->value = kPenetrationAmmoConfigId;
-                ++m_RepoEntriesPatched;
-            } else if (s_AmmoConfigPair->value.As<ZString>()) {
-                m_OriginalAmmoConfigs.emplace_back(s_MapKey, s_AmmoConfigPair->value);
-                s_AmmoConfigPair->value = ZString(std::string_view(kPenetrationAmmoConfigIdStr));
+        if (GetPenetrationAmmoConfig(s_OriginalAmmoConfig, s_PenetrationAmmoConfig)) {
+            if (SDK()->SetRepositoryAmmoConfig(s_TargetId, s_PenetrationAmmoConfig)) {
+                m_OriginalAmmoConfigs.emplace_back(s_TargetId, s_OriginalAmmoConfig);
                 ++m_RepoEntriesPatched;
-            } else {
-                const auto* s_TypeInfo = s_AmmoConfigPair->value.GetTypeID()
-                    ? s_AmmoConfigPair->value.GetTypeID()->GetTypeInfo()
-                    : nullptr;
-                Logger::Warn(
-                    "[TitaniumBullets] AmmoConfig has unexpected type '{}' (ID={})",
-                    s_TypeInfo && s_TypeInfo->pszTypeName ? s_TypeInfo->pszTypeName : "<null>",
-                    s_RepoId.ToString()
-                );
             }
         }
+        else {
+            const auto* s_TypeInfo = s_AmmoConfigPair->value.GetTypeID()
+                ? s_AmmoConfigPair->value.GetTypeID()->GetTypeInfo()
+                : nullptr;
+            Logger::Warn(
+                "[TitaniumBullets] AmmoConfig has unexpected type '{}' (ID={})",
+                s_TypeInfo && s_TypeInfo->pszTypeName ? s_TypeInfo->pszTypeName : "<null>",
+                s_TargetId.ToString()
+            );
+        }
     }
 
     if (m_RepoEntriesPatched == 0) {
@@ -271,7 +196,7 @@ void TitaniumBullets::RestoreRepositoryPatch() {
         return;
     }
 
-    if (!EnsureRepositoryLoaded()) {
+    if (!SDK()->GetRepositoryIndex()) {
         Logger::Warn("[TitaniumBullets] Cannot restore; pro.repo not available");
         m_PatchApplied = false;
         m_OriginalAmmoConfigs.clear();
@@ -279,33 +204,11 @@ void TitaniumBullets::RestoreRepositoryPatch() {
         return;
     }
 
-    const auto s_RepositoryData = static_cast<THashMap<
-        ZRepositoryID, ZDynamicObject, TDefaultHashMapPolicy<ZRepositoryID>>*>(m_RepositoryResource.GetResourceData());
-
-    if (!s_RepositoryData) {
-        Logger::Warn("[TitaniumBullets] Cannot restore; pro.repo resource data is null");
-        m_PatchApplied = false;
-        m_OriginalAmmoConfigs.clear();
-        m_AutoApplyDisabled = false;
-        return;
-    }
-
     m_RepoEntriesRestored = 0;
 
     // Restore only the entries we originally patched.
-    for (const auto& [s_MapKey, s_OriginalAmmoConfig] : m_OriginalAmmoConfigs) {
-        auto s_It = s_RepositoryData->find(s_MapKey);
-        if (s_It == s_RepositoryData->end()) {
-            continue;
-        }
-
-        auto* s_Entries = s_It->second.As<TArray<SDynamicObjectKeyValuePair>>();
-        if (!s_Entries) {
-            continue;
-        }
-
-        if (auto* s_AmmoConfigPair = FindPair(s_Entries, kAmmoConfigKey)) {
-            s_AmmoConfigPair->value = s_OriginalAmmoConfig;
+    for (const auto& [s_TargetId, s_OriginalAmmoConfig] : m_OriginalAmmoConfigs) {
+        if (SDK()->SetRepositoryAmmoConfig(s_TargetId, s_OriginalAmmoConfig)) {
             ++m_RepoEntriesRestored;
         }
     }
@@ -322,13 +225,17 @@ void TitaniumBullets::OnDrawMenu() {
     if (ImGui::Checkbox(ICON_MD_SHIELD " Titanium Bullets", &m_Enabled)) {
         SetSettingBool("TitaniumBullets", "Enabled", m_Enabled);
 
+        // The repository can only be changed on the main thread, so the patch is applied or restored in a task.
         if (m_Enabled) {
-            m_AutoApplyDisabled = false;
-            // Apply immediately if possible; otherwise the frame update will apply later.
-            ApplyRepositoryPatch();
+            QueueMainThreadTask(
+                [this]() {
+                    m_AutoApplyDisabled = false;
+                    ApplyRepositoryPatch();
+                }
+            );
             Logger::Info("[TitaniumBullets] ENABLED");
         } else {
-            RestoreRepositoryPatch();
+            QueueMainThreadTask([this]() { RestoreRepositoryPatch(); });
             Logger::Info("[TitaniumBullets] DISABLED");
         }
     }
@@ -360,8 +267,12 @@ void TitaniumBullets::OnDrawUI(const bool p_HasFocus) {
         ImGui::Separator();
 
         if (ImGui::Button("Apply Now")) {
-            m_AutoApplyDisabled = false;
-            ApplyRepositoryPatch();
+            QueueMainThreadTask(
+                [this]() {
+                    m_AutoApplyDisabled = false;
+                    ApplyRepositoryPatch();
+                }
+            );
         }
 
         ImGui::SameLine();
@@ -369,7 +280,7 @@ void TitaniumBullets::OnDrawUI(const bool p_HasFocus) {
         if (ImGui::Button("Restore Now")) {
             m_Enabled = false;
             SetSettingBool("TitaniumBullets", "Enabled", m_Enabled);
-            RestoreRepositoryPatch();
+            QueueMainThreadTask([this]() { RestoreRepositoryPatch(); });
         }
 
         ImGui::Separator();
@@ -392,8 +303,7 @@ void TitaniumBullets::OnDrawUI(const bool p_HasFocus) {
 DEFINE_PLUGIN_DETOUR(TitaniumBullets, void, OnClearScene, 
     ZEntitySceneContext* th, bool p_FullyUnloadScene) 
 {
-    // Scene unload resets the repository state; clear our cached handle and patch state.
-    m_RepositoryResource = {};
+    // Scene unload resets the repository state; clear our patch state.
     m_OriginalAmmoConfigs.clear();
     m_PatchApplied = false;
     m_RepoEntriesPatched = 0;
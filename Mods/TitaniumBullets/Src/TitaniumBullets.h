@@ -40,7 +40,6 @@ private:
     DECLARE_PLUGIN_DETOUR(TitaniumBullets, void, OnClearScene,
         ZEntitySceneContext* th, bool p_FullyUnloadScene);
 
-    bool EnsureRepositoryLoaded();
     bool ApplyRepositoryPatch();
     void RestoreRepositoryPatch();
 
@@ -54,9 +53,6 @@ private:
     uint32_t m_RepoEntriesPatched = 0;
     uint32_t m_RepoEntriesRestored = 0;
 
-    // Repository resource handle (pro.repo)
-    ZResourcePtr m_RepositoryResource = {};
-
     // Original AmmoConfig values for patched entries (for restoration)
     std::vector<std::pair<ZRepositoryID, ZDynamicObject>> m_OriginalAmmoConfigs;
 };
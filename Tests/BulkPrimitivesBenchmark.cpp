@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "FrustumCulling.h"
+#include "TestUtils.h"
+
+namespace {
+    struct Vertex {
+        float position[3];
+        float color[4];
+    };
+
+    // An axis aligned box of 40 units around the origin.
+    constexpr float c_Planes[FrustumCulling::c_PlaneCount * 4] = {
+        1.f, 0.f, 0.f, -20.f,
+        -1.f, 0.f, 0.f, -20.f,
+        0.f, 1.f, 0.f, -20.f,
+        0.f, -1.f, 0.f, -20.f,
+        0.f, 0.f, 1.f, -20.f,
+        0.f, 0.f, -1.f, -20.f,
+    };
+
+    bool IsInside(const Vertex& p_Vertex) {
+        return FrustumCulling::ClassifyPoint(
+            c_Planes, p_Vertex.position[0], p_Vertex.position[1], p_Vertex.position[2]
+        ) != FrustumCulling::EContainment::Outside;
+    }
+}
+
+// Compares drawing an indexed mesh one triangle at a time, the way DrawTriangle3D culls and writes each triangle,
+// against the blocks of four DrawIndexedTriangles3D uses, including its up front index validation.
+// Visible triangles are written to a vertex buffer in both cases, like they are written to the primitive batch.
+int main() {
+    constexpr size_t c_VertexCount = 500'000;
+    constexpr size_t c_TriangleCount = 1'000'000;
+    constexpr size_t c_ChunkSize = 1024;
+    constexpr int c_Iterations = 20;
+
+    std::mt19937 s_Random(1234);
+    std::uniform_real_distribution<float> s_Position(-40.f, 40.f);
+    std::uniform_int_distribution<uint32_t> s_Index(0, c_VertexCount - 1);
+
+    std::vector<Vertex> s_Vertices(c_VertexCount);
+
+    for (Vertex& s_Vertex : s_Vertices) {
+        s_Vertex = {{s_Position(s_Random), s_Position(s_Random), s_Position(s_Random)}, {1.f, 1.f, 1.f, 1.f}};
+    }
+
+    std::vector<uint32_t> s_Indices(c_TriangleCount * 3);
+
+    for (uint32_t& s_Value : s_Indices) {
+        s_Value = s_Index(s_Random);
+    }
+
+    std::vector<Vertex> s_Output(c_TriangleCount * 3);
+    size_t s_OutputCount = 0;
+
+    const double s_PerTriangleTime = MeasureMilliseconds(
+        c_Iterations, [&]() {
+            s_OutputCount = 0;
+
+            for (size_t i = 0; i < c_TriangleCount; ++i) {
+                const Vertex& s_V1 = s_Vertices[s_Indices[i * 3]];
+                const Vertex& s_V2 = s_Vertices[s_Indices[i * 3 + 1]];
+                const Vertex& s_V3 = s_Vertices[s_Indices[i * 3 + 2]];
+
+                if (!IsInside(s_V1) && !IsInside(s_V2) && !IsInside(s_V3)) {
+                    continue;
+                }
+
+                s_Output[s_OutputCount++] = s_V1;
+                s_Output[s_OutputCount++] = s_V2;
+                s_Output[s_OutputCount++] = s_V3;
+            }
+        }
+    );
+
+    std::printf(
+        "Per triangle: %.3f ms for %zu triangles, %zu visible\n", s_PerTriangleTime, c_TriangleCount,
+        s_OutputCount / 3
+    );
+
+    const double s_BulkTime = MeasureMilliseconds(
+        c_Iterations, [&]() {
+            s_OutputCount = 0;
+
+            if (*std::ranges::max_element(s_Indices) >= s_Vertices.size()) {
+                return;
+            }
+
+            uint8_t s_Masks[c_ChunkSize / 4];
+
+            for (size_t s_ChunkStart = 0; s_ChunkStart < c_TriangleCount; s_ChunkStart += c_ChunkSize) {
+                const size_t s_ChunkSize = std::min(c_ChunkSize, c_TriangleCount - s_ChunkStart);
+                const uint32_t* s_ChunkIndices = s_Indices.data() + s_ChunkStart * 3;
+
+                for (size_t s_First = 0; s_First < s_ChunkSize; s_First += 4) {
+                    const size_t s_Count = std::min<size_t>(4, s_ChunkSize - s_First);
+                    float s_Corners[3][4][3];
+
+                    for (size_t i = 0; i < s_Count; ++i) {
+                        for (size_t j = 0; j < 3; ++j) {
+                            const Vertex& s_Vertex = s_Vertices[s_ChunkIndices[(s_First + i) * 3 + j]];
+                            std::copy_n(s_Vertex.position, 3, s_Corners[j][i]);
+                        }
+                    }
+
+                    s_Masks[s_First / 4] = static_cast<uint8_t>(
+                        FrustumCulling::CullPoints4(c_Planes, s_Corners[0][0], sizeof(s_Corners[0][0]), s_Count) |
+                        FrustumCulling::CullPoints4(c_Planes, s_Corners[1][0], sizeof(s_Corners[1][0]), s_Count) |
+                        FrustumCulling::CullPoints4(c_Planes, s_Corners[2][0], sizeof(s_Corners[2][0]), s_Count)
+                    );
+                }
+
+                for (size_t i = 0; i < s_ChunkSize; ++i) {
+                    if (!(s_Masks[i / 4] & (1u << (i % 4)))) {
+                        continue;
+                    }
+
+                    for (size_t j = 0; j < 3; ++j) {
+                        s_Output[s_OutputCount++] = s_Vertices[s_ChunkIndices[i * 3 + j]];
+                    }
+                }
+            }
+        }
+    );
+
+    std::printf(
+        "Blocks of four: %.3f ms for %zu triangles, %zu visible\n", s_BulkTime, c_TriangleCount, s_OutputCount / 3
+    );
+
+    return 0;
+}
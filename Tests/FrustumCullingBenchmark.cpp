@@ -0,0 +1,71 @@
+#include <random>
+#include <vector>
+
+#include "FrustumCulling.h"
+#include "TestUtils.h"
+
+// Compares culling points one at a time with the scalar test against the batch kernels.
+int main() {
+    constexpr size_t c_PointCount = 1'000'000;
+    constexpr int c_Iterations = 20;
+
+    std::mt19937 s_Random(1234);
+    std::uniform_real_distribution<float> s_Position(-30.f, 30.f);
+
+    std::vector<float> s_X(c_PointCount);
+    std::vector<float> s_Y(c_PointCount);
+    std::vector<float> s_Z(c_PointCount);
+
+    for (size_t i = 0; i < c_PointCount; ++i) {
+        s_X[i] = s_Position(s_Random);
+        s_Y[i] = s_Position(s_Random);
+        s_Z[i] = s_Position(s_Random);
+    }
+
+    // An axis aligned box of 40 units around the origin.
+    const float s_Planes[FrustumCulling::c_PlaneCount * 4] = {
+        1.f, 0.f, 0.f, -20.f,
+        -1.f, 0.f, 0.f, -20.f,
+        0.f, 1.f, 0.f, -20.f,
+        0.f, -1.f, 0.f, -20.f,
+        0.f, 0.f, 1.f, -20.f,
+        0.f, 0.f, -1.f, -20.f,
+    };
+
+    std::vector<uint64_t> s_Visibility(FrustumCulling::GetVisibilityMaskSize(c_PointCount));
+
+    const double s_ScalarTime = MeasureMilliseconds(
+        c_Iterations, [&]() {
+            std::fill(s_Visibility.begin(), s_Visibility.end(), 0ull);
+
+            for (size_t i = 0; i < c_PointCount; ++i) {
+                if (FrustumCulling::ClassifyPoint(s_Planes, s_X[i], s_Y[i], s_Z[i]) !=
+                    FrustumCulling::EContainment::Outside) {
+                    s_Visibility[i / 64] |= 1ull << (i % 64);
+                }
+            }
+        }
+    );
+
+    std::printf("Scalar: %.3f ms for %zu points\n", s_ScalarTime, c_PointCount);
+
+    const auto s_MeasureBatch = [&]() {
+        return MeasureMilliseconds(
+            c_Iterations, [&]() {
+                FrustumCulling::CullPoints(
+                    s_Planes, {s_X.data(), s_Y.data(), s_Z.data()}, c_PointCount, s_Visibility.data()
+                );
+            }
+        );
+    };
+
+    FrustumCulling::SetAvxEnabled(false);
+    std::printf("SSE: %.3f ms for %zu points\n", s_MeasureBatch(), c_PointCount);
+
+    if (FrustumCulling::IsAvxSupported()) {
+        FrustumCulling::SetAvxEnabled(true);
+        std::printf("AVX: %.3f ms for %zu points\n", s_MeasureBatch(), c_PointCount);
+    }
+
+    return 0;
+}
@@ -0,0 +1,280 @@
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "FrustumCulling.h"
+#include "TestUtils.h"
+
+namespace {
+    struct Vector3 {
+        float x;
+        float y;
+        float z;
+    };
+
+    Vector3 Normalize(const Vector3& p_Vector) {
+        const float s_Length = std::sqrt(p_Vector.x * p_Vector.x + p_Vector.y * p_Vector.y + p_Vector.z * p_Vector.z);
+        return {p_Vector.x / s_Length, p_Vector.y / s_Length, p_Vector.z / s_Length};
+    }
+
+    Vector3 Cross(const Vector3& p_A, const Vector3& p_B) {
+        return {p_A.y * p_B.z - p_A.z * p_B.y, p_A.z * p_B.x - p_A.x * p_B.z, p_A.x * p_B.y - p_A.y * p_B.x};
+    }
+
+    Vector3 RandomDirection(std::mt19937& p_Random) {
+        std::normal_distribution<float> s_Distribution;
+        return Normalize({s_Distribution(p_Random), s_Distribution(p_Random), s_Distribution(p_Random)});
+    }
+
+    // Outward facing planes around the origin, so primitives near the origin are inside and far away ones aren't.
+    std::vector<float> RandomPlanes(std::mt19937& p_Random) {
+        std::uniform_real_distribution<float> s_Distance(5.f, 20.f);
+        std::vector<float> s_Planes;
+
+        for (size_t i = 0; i < FrustumCulling::c_PlaneCount; ++i) {
+            const Vector3 s_Normal = RandomDirection(p_Random);
+
+            s_Planes.push_back(s_Normal.x);
+            s_Planes.push_back(s_Normal.y);
+            s_Planes.push_back(s_Normal.z);
+            s_Planes.push_back(-s_Distance(p_Random));
+        }
+
+        return s_Planes;
+    }
+
+    std::vector<float> RandomValues(
+        std::mt19937& p_Random, const size_t p_Count, const float p_Min, const float p_Max
+    ) {
+        std::uniform_real_distribution<float> s_Distribution(p_Min, p_Max);
+        std::vector<float> s_Values(p_Count);
+
+        for (float& s_Value : s_Values) {
+            s_Value = s_Distribution(p_Random);
+        }
+
+        return s_Values;
+    }
+
+    bool IsVisible(const std::vector<uint64_t>& p_Visibility, const size_t p_Index) {
+        return (p_Visibility[p_Index / 64] >> (p_Index % 64)) & 1;
+    }
+
+    // Bits past the last primitive must stay cleared, so callers can count visible primitives with popcount.
+    bool HasNoBitsPastEnd(const std::vector<uint64_t>& p_Visibility, const size_t p_Count) {
+        for (size_t i = p_Count; i < p_Visibility.size() * 64; ++i) {
+            if (IsVisible(p_Visibility, i)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void TestPoints(std::mt19937& p_Random, const size_t p_Count) {
+        const std::vector<float> s_Planes = RandomPlanes(p_Random);
+        const std::vector<float> s_X = RandomValues(p_Random, p_Count, -30.f, 30.f);
+        const std::vector<float> s_Y = RandomValues(p_Random, p_Count, -30.f, 30.f);
+        const std::vector<float> s_Z = RandomValues(p_Random, p_Count, -30.f, 30.f);
+
+        // Start with every bit set to make sure the kernels clear the mask first.
+        std::vector<uint64_t> s_Visibility(FrustumCulling::GetVisibilityMaskSize(p_Count) + 1, ~0ull);
+        FrustumCulling::CullPoints(s_Planes.data(), {s_X.data(), s_Y.data(), s_Z.data()}, p_Count, s_Visibility.data());
+        s_Visibility.pop_back();
+
+        for (size_t i = 0; i < p_Count; ++i) {
+            const bool s_Expected = FrustumCulling::ClassifyPoint(s_Planes.data(), s_X[i], s_Y[i], s_Z[i]) !=
+                FrustumCulling::EContainment::Outside;
+
+            CHECK(IsVisible(s_Visibility, i) == s_Expected);
+        }
+
+        CHECK(HasNoBitsPastEnd(s_Visibility, p_Count));
+    }
+
+    void TestAABBs(std::mt19937& p_Random, const size_t p_Count) {
+        const std::vector<float> s_Planes = RandomPlanes(p_Random);
+        const std::vector<float> s_CenterX = RandomValues(p_Random, p_Count, -30.f, 30.f);
+        const std::vector<float> s_CenterY = RandomValues(p_Random, p_Count, -30.f, 30.f);
+        const std::vector<float> s_CenterZ = RandomValues(p_Random, p_Count, -30.f, 30.f);
+        const std::vector<float> s_Size = RandomValues(p_Random, p_Count * 3, 0.f, 8.f);
+
+        std::vector<float> s_Bounds[6];
+
+        for (auto& s_Component : s_Bounds) {
+            s_Component.resize(p_Count);
+        }
+
+        for (size_t i = 0; i < p_Count; ++i) {
+            s_Bounds[0][i] = s_CenterX[i] - s_Size[i * 3 + 0];
+            s_Bounds[1][i] = s_CenterY[i] - s_Size[i * 3 + 1];
+            s_Bounds[2][i] = s_CenterZ[i] - s_Size[i * 3 + 2];
+            s_Bounds[3][i] = s_CenterX[i] + s_Size[i * 3 + 0];
+            s_Bounds[4][i] = s_CenterY[i] + s_Size[i * 3 + 1];
+            s_Bounds[5][i] = s_CenterZ[i] + s_Size[i * 3 + 2];
+        }
+
+        const FrustumCullAABBs s_AABBs {
+            s_Bounds[0].data(), s_Bounds[1].data(), s_Bounds[2].data(),
+            s_Bounds[3].data(), s_Bounds[4].data(), s_Bounds[5].data(),
+        };
+
+        std::vector<uint64_t> s_Visibility(FrustumCulling::GetVisibilityMaskSize(p_Count) + 1, ~0ull);
+        FrustumCulling::CullAABBs(s_Planes.data(), s_AABBs, p_Count, s_Visibility.data());
+        s_Visibility.pop_back();
+
+        for (size_t i = 0; i < p_Count; ++i) {
+            const float s_Min[3] = {s_Bounds[0][i], s_Bounds[1][i], s_Bounds[2][i]};
+            const float s_Max[3] = {s_Bounds[3][i], s_Bounds[4][i], s_Bounds[5][i]};
+
+            const bool s_Expected = FrustumCulling::ClassifyAABB(s_Planes.data(), s_Min, s_Max) !=
+                FrustumCulling::EContainment::Outside;
+
+            CHECK(IsVisible(s_Visibility, i) == s_Expected);
+        }
+
+        CHECK(HasNoBitsPastEnd(s_Visibility, p_Count));
+    }
+
+    void TestOBBs(std::mt19937& p_Random, const size_t p_Count) {
+        const std::vector<float> s_Planes = RandomPlanes(p_Random);
+
+        std::vector<float> s_Center[3];
+        std::vector<float> s_HalfSize[3];
+        std::vector<float> s_Axes[3][3];
+
+        for (size_t c = 0; c < 3; ++c) {
+            s_Center[c] = RandomValues(p_Random, p_Count, -30.f, 30.f);
+            s_HalfSize[c] = RandomValues(p_Random, p_Count, 0.f, 8.f);
+
+            for (size_t a = 0; a < 3; ++a) {
+                s_Axes[a][c].resize(p_Count);
+            }
+        }
+
+        for (size_t i = 0; i < p_Count; ++i) {
+            // Build an orthonormal basis from two random directions.
+            const Vector3 s_AxisX = RandomDirection(p_Random);
+            const Vector3 s_AxisY = Normalize(Cross(RandomDirection(p_Random), s_AxisX));
+            const Vector3 s_AxisZ = Cross(s_AxisX, s_AxisY);
+            const Vector3 s_Basis[3] = {s_AxisX, s_AxisY, s_AxisZ};
+
+            for (size_t a = 0; a < 3; ++a) {
+                s_Axes[a][0][i] = s_Basis[a].x;
+                s_Axes[a][1][i] = s_Basis[a].y;
+                s_Axes[a][2][i] = s_Basis[a].z;
+            }
+        }
+
+        FrustumCullOBBs s_OBBs {
+            s_Center[0].data(), s_Center[1].data(), s_Center[2].data(),
+            s_HalfSize[0].data(), s_HalfSize[1].data(), s_HalfSize[2].data(),
+        };
+
+        for (size_t a = 0; a < 3; ++a) {
+            for (size_t c = 0; c < 3; ++c) {
+                s_OBBs.axes[a][c] = s_Axes[a][c].data();
+            }
+        }
+
+        std::vector<uint64_t> s_Visibility(FrustumCulling::GetVisibilityMaskSize(p_Count) + 1, ~0ull);
+        FrustumCulling::CullOBBs(s_Planes.data(), s_OBBs, p_Count, s_Visibility.data());
+        s_Visibility.pop_back();
+
+        for (size_t i = 0; i < p_Count; ++i) {
+            const float s_BoxCenter[3] = {s_Center[0][i], s_Center[1][i], s_Center[2][i]};
+            const float s_BoxHalfSize[3] = {s_HalfSize[0][i], s_HalfSize[1][i], s_HalfSize[2][i]};
+            float s_BoxAxes[3][3];
+
+            for (size_t a = 0; a < 3; ++a) {
+                for (size_t c = 0; c < 3; ++c) {
+                    s_BoxAxes[a][c] = s_Axes[a][c][i];
+                }
+            }
+
+            const bool s_Expected = FrustumCulling::ClassifyOBB(
+                s_Planes.data(), s_BoxCenter, s_BoxHalfSize, s_BoxAxes
+            ) != FrustumCulling::EContainment::Outside;
+
+            CHECK(IsVisible(s_Visibility, i) == s_Expected);
+        }
+
+        CHECK(HasNoBitsPastEnd(s_Visibility, p_Count));
+    }
+
+    void TestPoints4(std::mt19937& p_Random) {
+        // Points inside a larger struct, like the positions of lines and triangles.
+        struct Primitive {
+            float position[3];
+            float color[4];
+        };
+
+        const std::vector<float> s_Planes = RandomPlanes(p_Random);
+        const std::vector<float> s_Values = RandomValues(p_Random, 4 * 3, -30.f, 30.f);
+
+        Primitive s_Primitives[4];
+
+        for (size_t i = 0; i < 4; ++i) {
+            s_Primitives[i] = {{s_Values[i * 3], s_Values[i * 3 + 1], s_Values[i * 3 + 2]}, {1.f, 1.f, 1.f, 1.f}};
+        }
+
+        for (size_t s_Count = 0; s_Count <= 4; ++s_Count) {
+            const uint32_t s_Mask = FrustumCulling::CullPoints4(
+                s_Planes.data(), s_Primitives[0].position, sizeof(Primitive), s_Count
+            );
+
+            for (size_t i = 0; i < 4; ++i) {
+                const float* s_Position = s_Primitives[i].position;
+                const bool s_Expected = i < s_Count && FrustumCulling::ClassifyPoint(
+                    s_Planes.data(), s_Position[0], s_Position[1], s_Position[2]
+                ) != FrustumCulling::EContainment::Outside;
+
+                CHECK(((s_Mask >> i) & 1) == s_Expected);
+            }
+
+            CHECK((s_Mask >> 4) == 0);
+        }
+    }
+
+    void RunTests(std::mt19937& p_Random) {
+        // Every count up to a few blocks covers partial blocks for both vector widths, the larger ones
+        // cover primitives in later mask words.
+        std::vector<size_t> s_Counts;
+
+        for (size_t i = 0; i <= 130; ++i) {
+            s_Counts.push_back(i);
+        }
+
+        s_Counts.push_back(1000);
+        s_Counts.push_back(4097);
+
+        for (const size_t s_Count : s_Counts) {
+            TestPoints(p_Random, s_Count);
+            TestAABBs(p_Random, s_Count);
+            TestOBBs(p_Random, s_Count);
+        }
+
+        for (int i = 0; i < 1000; ++i) {
+            TestPoints4(p_Random);
+        }
+    }
+}
+
+int main() {
+    std::mt19937 s_Random(1234);
+
+    FrustumCulling::SetAvxEnabled(false);
+    std::printf("Testing the SSE kernels.\n");
+    RunTests(s_Random);
+
+    if (FrustumCulling::IsAvxSupported()) {
+        FrustumCulling::SetAvxEnabled(true);
+        std::printf("Testing the AVX kernels.\n");
+        RunTests(s_Random);
+    }
+    else {
+        std::printf("AVX isn't supported, skipping the AVX kernels.\n");
+    }
+
+    return TestResult();
+}
@@ -0,0 +1,129 @@
+#include <random>
+#include <vector>
+
+#include "InterfaceCache.h"
+#include "TestUtils.h"
+
+namespace {
+    // Stand-ins for STypeID, SInterfaceData and ZEntityType.
+    struct TypeID {
+        uint64_t m_Id;
+    };
+
+    struct InterfaceData {
+        const TypeID* m_Type;
+        int64_t m_nInterfaceOffset;
+    };
+
+    struct EntityType {
+        std::vector<InterfaceData> m_Interfaces;
+    };
+
+    using BenchmarkInterfaceCache = InterfaceCache<EntityType, TypeID, InterfaceData>;
+
+    struct Query {
+        const EntityType* m_Type;
+        const TypeID* m_TypeID;
+    };
+
+    int64_t FindInterfaceIndexLinear(const EntityType& p_Type, const TypeID* p_TypeID) {
+        for (size_t i = 0; i < p_Type.m_Interfaces.size(); ++i) {
+            if (p_Type.m_Interfaces[i].m_Type == p_TypeID) {
+                return static_cast<int64_t>(i);
+            }
+        }
+
+        return -1;
+    }
+}
+
+// Compares scanning the interfaces of an entity type for every cast against the per-thread interface cache.
+// Casts are made with a few hot combinations of types and interfaces, like a mod casting the same entities
+// every frame, and a small share of misses.
+int main() {
+    constexpr size_t c_TypeIDCount = 500;
+    constexpr size_t c_EntityTypeCount = 2000;
+    constexpr size_t c_HotQueryCount = 100;
+    constexpr size_t c_QueryCount = 1'000'000;
+    constexpr int c_Iterations = 20;
+
+    std::mt19937 s_Random(1234);
+
+    std::vector<TypeID> s_TypeIDs(c_TypeIDCount);
+
+    for (size_t i = 0; i < c_TypeIDCount; ++i) {
+        s_TypeIDs[i].m_Id = i;
+    }
+
+    std::uniform_int_distribution<size_t> s_TypeIDIndex(0, c_TypeIDCount - 1);
+    std::uniform_int_distribution<size_t> s_InterfaceCount(5, 40);
+    std::vector<EntityType> s_EntityTypes(c_EntityTypeCount);
+
+    for (EntityType& s_EntityType : s_EntityTypes) {
+        const size_t s_Count = s_InterfaceCount(s_Random);
+
+        for (size_t i = 0; i < s_Count; ++i) {
+            s_EntityType.m_Interfaces.push_back({&s_TypeIDs[s_TypeIDIndex(s_Random)], static_cast<int64_t>(i * 8)});
+        }
+    }
+
+    // Most hot casts are to interfaces the type implements, the rest are to random ones.
+    std::uniform_int_distribution<size_t> s_EntityTypeIndex(0, c_EntityTypeCount - 1);
+    std::vector<Query> s_HotQueries;
+
+    for (size_t i = 0; i < c_HotQueryCount; ++i) {
+        const EntityType& s_EntityType = s_EntityTypes[s_EntityTypeIndex(s_Random)];
+        std::uniform_int_distribution<size_t> s_Interface(0, s_EntityType.m_Interfaces.size() - 1);
+
+        const TypeID* s_TypeID = i % 10 == 0
+                                     ? &s_TypeIDs[s_TypeIDIndex(s_Random)]
+                                     : s_EntityType.m_Interfaces[s_Interface(s_Random)].m_Type;
+
+        s_HotQueries.push_back({&s_EntityType, s_TypeID});
+    }
+
+    std::uniform_int_distribution<size_t> s_HotQueryIndex(0, c_HotQueryCount - 1);
+    std::vector<Query> s_Queries(c_QueryCount);
+
+    for (Query& s_Query : s_Queries) {
+        s_Query = s_HotQueries[s_HotQueryIndex(s_Random)];
+    }
+
+    int64_t s_LinearSum = 0;
+
+    const double s_LinearTime = MeasureMilliseconds(
+        c_Iterations, [&]() {
+            s_LinearSum = 0;
+
+            for (const Query& s_Query : s_Queries) {
+                s_LinearSum += FindInterfaceIndexLinear(*s_Query.m_Type, s_Query.m_TypeID);
+            }
+        }
+    );
+
+    std::printf("Linear: %.3f ms for %zu casts\n", s_LinearTime, c_QueryCount);
+
+    int64_t s_CachedSum = 0;
+
+    const double s_CachedTime = MeasureMilliseconds(
+        c_Iterations, [&]() {
+            s_CachedSum = 0;
+
+            for (const Query& s_Query : s_Queries) {
+                s_CachedSum += BenchmarkInterfaceCache::FindInterfaceIndex(
+                    s_Query.m_Type, s_Query.m_TypeID, s_Query.m_Type->m_Interfaces.data(),
+                    static_cast<uint32_t>(s_Query.m_Type->m_Interfaces.size())
+                );
+            }
+        }
+    );
+
+    std::printf("Cached: %.3f ms for %zu casts\n", s_CachedTime, c_QueryCount);
+
+    if (s_LinearSum != s_CachedSum) {
+        std::printf("The cached lookups found different interfaces than the linear ones.\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include <vector>
+
+#include "InterfaceCache.h"
+#include "TestUtils.h"
+
+namespace {
+    struct TypeID {
+        uint64_t m_Id;
+    };
+
+    struct InterfaceData {
+        const TypeID* m_Type;
+        int64_t m_nInterfaceOffset;
+    };
+
+    struct EntityType {
+        std::vector<InterfaceData> m_Interfaces;
+    };
+
+    using TestInterfaceCache = InterfaceCache<EntityType, TypeID, InterfaceData>;
+
+    int64_t Find(const EntityType& p_Type, const TypeID& p_TypeID) {
+        return TestInterfaceCache::FindInterfaceIndex(
+            &p_Type, &p_TypeID, p_Type.m_Interfaces.data(), static_cast<uint32_t>(p_Type.m_Interfaces.size())
+        );
+    }
+}
+
+int main() {
+    TypeID s_TypeIDs[4] = {{0}, {1}, {2}, {3}};
+    EntityType s_Type {{{&s_TypeIDs[0], 0}, {&s_TypeIDs[1], 8}, {&s_TypeIDs[1], 16}}};
+
+    // Misses and hits give the same result as a scan, which finds the first matching interface.
+    for (int i = 0; i < 2; ++i) {
+        CHECK(Find(s_Type, s_TypeIDs[0]) == 0);
+        CHECK(Find(s_Type, s_TypeIDs[1]) == 1);
+        CHECK(Find(s_Type, s_TypeIDs[2]) == -1);
+    }
+
+    // An interface array that was changed in place doesn't return the cached index.
+    s_Type.m_Interfaces[1].m_Type = &s_TypeIDs[3];
+    CHECK(Find(s_Type, s_TypeIDs[1]) == 2);
+    CHECK(Find(s_Type, s_TypeIDs[3]) == 1);
+
+    // Neither does a type whose interface array was replaced.
+    s_Type.m_Interfaces = {{&s_TypeIDs[2], 0}};
+    CHECK(Find(s_Type, s_TypeIDs[0]) == -1);
+    CHECK(Find(s_Type, s_TypeIDs[2]) == 0);
+
+    // Cached misses are forgotten after clearing the cache.
+    CHECK(Find(s_Type, s_TypeIDs[1]) == -1);
+    s_Type.m_Interfaces[0].m_Type = &s_TypeIDs[1];
+    TestInterfaceCache::Clear();
+    CHECK(Find(s_Type, s_TypeIDs[1]) == 0);
+
+    return TestResult();
+}
@@ -0,0 +1,392 @@
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <NavPower.h>
+
+#include "NavMeshTriangulation.h"
+#include "TestUtils.h"
+
+namespace {
+    // The triangulation DebugMod used before NavMeshTriangulation. It's kept as it was, apart from a guard for
+    // polygons where it doesn't find an ear, on which it never returned.
+    namespace Baseline {
+        float AngleBetween(const SVector3& a, const SVector3& b) {
+            float angle = SVector3::DotProduct(a, b);
+            angle /= (a.Length() * b.Length());
+            return angle = acosf(angle);
+        }
+
+        SVector3 ProjectionOnto(const SVector3& a, const SVector3& b) {
+            const SVector3 bn = b / b.Length();
+            return bn * SVector3::DotProduct(a, bn);
+        }
+
+        bool AreOnSameSide(const SVector3& p1, const SVector3& p2, const SVector3& a, const SVector3& b) {
+            const SVector3 cp1 = SVector3::CrossProduct(b - a, p1 - a);
+            const SVector3 cp2 = SVector3::CrossProduct(b - a, p2 - a);
+
+            return SVector3::DotProduct(cp1, cp2) >= 0;
+        }
+
+        SVector3 ComputeTriangleNormal(const SVector3& t1, const SVector3& t2, const SVector3& t3) {
+            return SVector3::CrossProduct(t2 - t1, t3 - t1);
+        }
+
+        bool IsInTriangle(
+            const SVector3& point, const SVector3& triangle1, const SVector3& triangle2, const SVector3& triangle3
+        ) {
+            const bool within_tri_prisim = AreOnSameSide(point, triangle1, triangle2, triangle3) &&
+                AreOnSameSide(point, triangle2, triangle1, triangle3) &&
+                AreOnSameSide(point, triangle3, triangle1, triangle2);
+
+            if (!within_tri_prisim) {
+                return false;
+            }
+
+            const SVector3 n = ComputeTriangleNormal(triangle1, triangle2, triangle3);
+            const SVector3 proj = ProjectionOnto(point, n);
+
+            return proj.Length() == 0;
+        }
+
+        void VertexTriangluation(const std::vector<SVector3>& vertices, std::vector<unsigned short>& indices) {
+            if (vertices.size() < 3) {
+                return;
+            }
+
+            if (vertices.size() == 3) {
+                indices.push_back(0);
+                indices.push_back(1);
+                indices.push_back(2);
+                return;
+            }
+
+            std::vector<SVector3> tVerts = vertices;
+
+            while (true) {
+                const size_t s_RemainingVertexCount = tVerts.size();
+
+                for (int i = 0; i < int(tVerts.size()); i++) {
+                    const SVector3 pPrev = i == 0 ? tVerts[tVerts.size() - 1] : tVerts[i - 1];
+                    const SVector3 pCur = tVerts[i];
+                    const SVector3 pNext = i == tVerts.size() - 1 ? tVerts[0] : tVerts[i + 1];
+
+                    if (tVerts.size() == 3) {
+                        for (int j = 0; j < int(tVerts.size()); j++) {
+                            if (vertices[j] == pCur)
+                                indices.push_back(j);
+                            if (vertices[j] == pPrev)
+                                indices.push_back(j);
+                            if (vertices[j] == pNext)
+                                indices.push_back(j);
+                        }
+
+                        tVerts.clear();
+                        break;
+                    }
+
+                    if (tVerts.size() == 4) {
+                        for (int j = 0; j < int(vertices.size()); j++) {
+                            if (vertices[j] == pCur)
+                                indices.push_back(j);
+                            if (vertices[j] == pPrev)
+                                indices.push_back(j);
+                            if (vertices[j] == pNext)
+                                indices.push_back(j);
+                        }
+
+                        SVector3 tempVec;
+
+                        for (int j = 0; j < int(tVerts.size()); j++) {
+                            if (tVerts[j] != pCur && tVerts[j] != pPrev && tVerts[j] != pNext) {
+                                tempVec = tVerts[j];
+                                break;
+                            }
+                        }
+
+                        for (int j = 0; j < int(vertices.size()); j++) {
+                            if (vertices[j] == pPrev)
+                                indices.push_back(j);
+                            if (vertices[j] == pNext)
+                                indices.push_back(j);
+                            if (vertices[j] == tempVec)
+                                indices.push_back(j);
+                        }
+
+                        tVerts.clear();
+                        break;
+                    }
+
+                    float angle = AngleBetween(pPrev - pCur, pNext - pCur) * (180 / 3.14159265359);
+                    if (angle <= 0 && angle >= 180)
+                        continue;
+
+                    bool inTri = false;
+
+                    for (int j = 0; j < int(vertices.size()); j++) {
+                        if (IsInTriangle(vertices[j], pPrev, pCur, pNext) && vertices[j] != pPrev &&
+                            vertices[j] != pCur && vertices[j] != pNext) {
+                            inTri = true;
+                            break;
+                        }
+                    }
+
+                    if (inTri)
+                        continue;
+
+                    for (int j = 0; j < int(vertices.size()); j++) {
+                        if (vertices[j] == pCur)
+                            indices.push_back(j);
+                        if (vertices[j] == pPrev)
+                            indices.push_back(j);
+                        if (vertices[j] == pNext)
+                            indices.push_back(j);
+                    }
+
+                    for (int j = 0; j < int(tVerts.size()); j++) {
+                        if (tVerts[j] == pCur) {
+                            tVerts.erase(tVerts.begin() + j);
+                            break;
+                        }
+                    }
+
+                    i = -1;
+                }
+
+                if (indices.size() == 0)
+                    break;
+
+                if (tVerts.size() == 0)
+                    break;
+
+                // Added for the tests, nothing was clipped in this pass so nothing will be in the next one either.
+                if (tVerts.size() == s_RemainingVertexCount)
+                    break;
+            }
+        }
+    }
+
+    SVector3 GetNewellNormal(const std::vector<SVector3>& p_Vertices) {
+        SVector3 s_Normal(0.f, 0.f, 0.f);
+
+        for (size_t i = 0; i < p_Vertices.size(); ++i) {
+            const SVector3& s_Current = p_Vertices[i];
+            const SVector3& s_Next = p_Vertices[(i + 1) % p_Vertices.size()];
+
+            s_Normal.x += (s_Current.y - s_Next.y) * (s_Current.z + s_Next.z);
+            s_Normal.y += (s_Current.z - s_Next.z) * (s_Current.x + s_Next.x);
+            s_Normal.z += (s_Current.x - s_Next.x) * (s_Current.y + s_Next.y);
+        }
+
+        return s_Normal;
+    }
+
+    // Convex with every corner clearly turning the same way and no repeated vertices. The baseline produces a proper
+    // fan for these, so the output has to be identical.
+    bool IsStrictlyConvex(const std::vector<SVector3>& p_Vertices) {
+        const SVector3 s_Normal = GetNewellNormal(p_Vertices).GetUnitVec();
+        const size_t s_VertexCount = p_Vertices.size();
+
+        for (size_t i = 0; i < s_VertexCount; ++i) {
+            const SVector3& a = p_Vertices[(i + s_VertexCount - 1) % s_VertexCount];
+            const SVector3& b = p_Vertices[i];
+            const SVector3& c = p_Vertices[(i + 1) % s_VertexCount];
+            const float s_Turn = SVector3::DotProduct(SVector3::CrossProduct(b - a, c - b), s_Normal);
+
+            if (s_Turn <= 0.01f * (b - a).Length() * (c - b).Length()) {
+                return false;
+            }
+
+            for (size_t j = i + 1; j < s_VertexCount; ++j) {
+                if (p_Vertices[i] == p_Vertices[j]) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // Returns whether the triangulation was compared against the baseline.
+    bool CheckPolygon(const std::vector<SVector3>& p_Vertices) {
+        const size_t s_VertexCount = p_Vertices.size();
+
+        std::vector<unsigned short> s_Indices = {1, 2, 3};
+        NavMeshTriangulation::TriangulatePolygon(p_Vertices, s_Indices);
+
+        // Existing indices are kept and every polygon turns into n - 2 triangles.
+        CHECK(s_Indices.size() == 3 + (s_VertexCount - 2) * 3);
+        s_Indices.erase(s_Indices.begin(), s_Indices.begin() + 3);
+
+        for (const unsigned short s_Index : s_Indices) {
+            CHECK(s_Index < s_VertexCount);
+        }
+
+        // Triangles mustn't overlap or leave gaps, so together they cover exactly the area of the polygon.
+        const SVector3 s_Normal = GetNewellNormal(p_Vertices);
+        const float s_PolygonArea = s_Normal.Length() / 2.f;
+        float s_TriangleArea = 0.f;
+
+        for (size_t i = 0; i + 2 < s_Indices.size(); i += 3) {
+            const SVector3& a = p_Vertices[s_Indices[i]];
+            const SVector3& b = p_Vertices[s_Indices[i + 1]];
+            const SVector3& c = p_Vertices[s_Indices[i + 2]];
+
+            s_TriangleArea += std::abs(SVector3::DotProduct(SVector3::CrossProduct(b - a, c - a), s_Normal)) /
+                (2.f * s_Normal.Length());
+        }
+
+        CHECK(std::abs(s_TriangleArea - s_PolygonArea) <= 1e-3f * s_PolygonArea + 1e-4f);
+
+        if (!IsStrictlyConvex(p_Vertices)) {
+            return false;
+        }
+
+        std::vector<unsigned short> s_BaselineIndices;
+        Baseline::VertexTriangluation(p_Vertices, s_BaselineIndices);
+
+        CHECK(s_Indices == s_BaselineIndices);
+
+        return true;
+    }
+
+    void TestNavMesh(const std::filesystem::path& p_Path) {
+        std::ifstream s_File(p_Path, std::ios::binary);
+        std::vector<char> s_Data((std::istreambuf_iterator<char>(s_File)), std::istreambuf_iterator<char>());
+
+        CHECK(s_Data.size() > sizeof(NavPower::Binary::Header));
+
+        if (s_Data.size() <= sizeof(NavPower::Binary::Header)) {
+            return;
+        }
+
+        NavPower::NavMesh s_NavMesh;
+        s_NavMesh.read(reinterpret_cast<uintptr_t>(s_Data.data()), static_cast<uint32_t>(s_Data.size()));
+
+        std::vector<NavPower::Area*> s_Areas;
+        std::set<const NavPower::Binary::Area*> s_BinaryAreas;
+
+        for (auto& s_Section : s_NavMesh.m_aSections) {
+            for (auto& s_Graph : s_Section.m_aNavGraphs) {
+                for (auto& s_Area : s_Graph.m_areas) {
+                    s_Areas.push_back(&s_Area);
+                    s_BinaryAreas.insert(s_Area.m_area);
+                }
+            }
+        }
+
+        CHECK(!s_Areas.empty());
+
+        size_t s_ComparedCount = 0;
+
+        for (size_t i = 0; i < s_Areas.size(); ++i) {
+            // DebugMod looks up adjacent areas by their offset divided by sizeof(Area), which needs areas to be at
+            // least that far apart and every adjacent area to be one of the navmesh.
+            if (i > 0) {
+                const auto s_Current = reinterpret_cast<uintptr_t>(s_Areas[i]->m_area);
+                const auto s_Previous = reinterpret_cast<uintptr_t>(s_Areas[i - 1]->m_area);
+
+                CHECK(s_Current - s_Previous >= sizeof(NavPower::Binary::Area));
+            }
+
+            std::vector<SVector3> s_Vertices;
+
+            for (const NavPower::Binary::Edge* s_Edge : s_Areas[i]->m_edges) {
+                s_Vertices.push_back(s_Edge->m_pos);
+                CHECK(!s_Edge->m_pAdjArea || s_BinaryAreas.contains(s_Edge->m_pAdjArea));
+            }
+
+            if (s_Vertices.size() >= 3 && CheckPolygon(s_Vertices)) {
+                ++s_ComparedCount;
+            }
+        }
+
+        std::printf(
+            "%s: %zu areas, %zu compared against the baseline.\n", p_Path.filename().string().c_str(), s_Areas.size(),
+            s_ComparedCount
+        );
+    }
+
+    // Random convex polygons, flat at the origin where the containment test of the baseline works and tilted where
+    // it never finds anything.
+    void TestRandomPolygons(std::mt19937& p_Random) {
+        std::uniform_int_distribution<size_t> s_VertexCount(3, 100);
+        std::uniform_real_distribution<float> s_Angle(0.f, 6.2831853f);
+        std::uniform_real_distribution<float> s_Value(-50.f, 50.f);
+
+        for (int i = 0; i < 1000; ++i) {
+            const size_t s_Count = s_VertexCount(p_Random);
+            const bool s_IsFlat = i % 2 == 0;
+            const SVector3 s_Center(s_Value(p_Random), s_Value(p_Random), s_IsFlat ? 0.f : s_Value(p_Random));
+            const float s_SlopeX = s_IsFlat ? 0.f : s_Value(p_Random) / 100.f;
+            const float s_SlopeY = s_IsFlat ? 0.f : s_Value(p_Random) / 100.f;
+            const float s_Radius = 1.f + std::abs(s_Value(p_Random));
+
+            std::vector<float> s_Angles(s_Count);
+
+            for (float& s_VertexAngle : s_Angles) {
+                s_VertexAngle = s_Angle(p_Random);
+            }
+
+            std::sort(s_Angles.begin(), s_Angles.end());
+
+            std::vector<SVector3> s_Vertices;
+
+            for (const float s_VertexAngle : s_Angles) {
+                const float x = std::cos(s_VertexAngle) * s_Radius;
+                const float y = std::sin(s_VertexAngle) * s_Radius;
+
+                s_Vertices.push_back(s_Center + SVector3(x, y, x * s_SlopeX + y * s_SlopeY));
+            }
+
+            CheckPolygon(s_Vertices);
+        }
+    }
+
+    void TestSmallPolygons() {
+        std::vector<unsigned short> s_Indices;
+
+        NavMeshTriangulation::TriangulatePolygon({}, s_Indices);
+        CHECK(s_Indices.empty());
+
+        const std::vector<SVector3> s_Line = {SVector3(0.f, 0.f, 0.f), SVector3(1.f, 0.f, 0.f)};
+        NavMeshTriangulation::TriangulatePolygon(s_Line, s_Indices);
+        CHECK(s_Indices.empty());
+
+        CHECK(CheckPolygon({SVector3(0.f, 0.f, 0.f), SVector3(1.f, 0.f, 0.f), SVector3(0.f, 1.f, 0.f)}));
+    }
+}
+
+// Navmeshes are loaded from the test data and from any paths passed on the command line,
+// so navps extracted from the game can be checked as well.
+int main(int argc, char** argv) {
+    std::vector<std::filesystem::path> s_Paths;
+
+    for (const auto& s_Entry : std::filesystem::directory_iterator(ZHMMODSDK_TEST_DATA_DIR)) {
+        if (s_Entry.path().extension() == ".navp") {
+            s_Paths.push_back(s_Entry.path());
+        }
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        s_Paths.emplace_back(argv[i]);
+    }
+
+    CHECK(!s_Paths.empty());
+
+    for (const auto& s_Path : s_Paths) {
+        TestNavMesh(s_Path);
+    }
+
+    std::mt19937 s_Random(1234);
+
+    TestSmallPolygons();
+    TestRandomPolygons(s_Random);
+
+    return TestResult();
+}
@@ -0,0 +1,178 @@
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <ResourceLib_HM3.h>
+#include <simdjson.h>
+#include <zhmmodsdk_rs.h>
+
+#include "TestUtils.h"
+
+// Checks that the BIN1 resources the Rust library writes for converted QN entities are the same as the ones
+// ResourceLib generates from RT JSON. Both are converted back to JSON by ResourceLib and compared.
+
+namespace {
+    std::string ReadFile(const std::filesystem::path& p_Path) {
+        std::ifstream s_File(p_Path, std::ios::binary);
+        std::stringstream s_Stream;
+        s_Stream << s_File.rdbuf();
+        return s_Stream.str();
+    }
+
+    std::string ResourceToJson(const char* p_ResourceType, const void* p_Data, const size_t p_Size) {
+        const auto* s_Converter = HM3_GetConverterForResource(p_ResourceType);
+        auto* s_Json = s_Converter->FromMemoryToJsonString(p_Data, p_Size);
+
+        if (!s_Json) {
+            return {};
+        }
+
+        std::string s_Result(s_Json->JsonData, s_Json->StrSize);
+        s_Converter->FreeJsonString(s_Json);
+
+        return s_Result;
+    }
+
+    std::string GeneratedResourceToJson(const char* p_ResourceType, const char* p_Json) {
+        const auto* s_Generator = HM3_GetGeneratorForResource(p_ResourceType);
+        auto* s_ResourceMem = s_Generator->FromJsonStringToResourceMem(p_Json, strlen(p_Json), false);
+
+        if (!s_ResourceMem) {
+            return {};
+        }
+
+        std::string s_Result = ResourceToJson(p_ResourceType, s_ResourceMem->ResourceData, s_ResourceMem->DataSize);
+        s_Generator->FreeResourceMem(s_ResourceMem);
+
+        return s_Result;
+    }
+
+    // Matrices are converted from QN transforms with double precision natively, so floats get some tolerance.
+    bool AreEqual(simdjson::dom::element p_A, simdjson::dom::element p_B) {
+        if (p_A.is_number() && p_B.is_number()) {
+            const double s_A = p_A.get_double().value();
+            const double s_B = p_B.get_double().value();
+
+            return std::abs(s_A - s_B) <= 1e-4 * std::max(1.0, std::abs(s_A));
+        }
+
+        if (p_A.type() != p_B.type()) {
+            return false;
+        }
+
+        switch (p_A.type()) {
+            case simdjson::dom::element_type::ARRAY: {
+                const auto s_A = p_A.get_array().value();
+                const auto s_B = p_B.get_array().value();
+
+                if (s_A.size() != s_B.size()) {
+                    return false;
+                }
+
+                for (size_t i = 0; i < s_A.size(); ++i) {
+                    if (!AreEqual(s_A.at(i).value(), s_B.at(i).value())) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+            case simdjson::dom::element_type::OBJECT: {
+                const auto s_A = p_A.get_object().value();
+                const auto s_B = p_B.get_object().value();
+
+                if (s_A.size() != s_B.size()) {
+                    return false;
+                }
+
+                for (const auto [s_Key, s_Value] : s_A) {
+                    simdjson::dom::element s_Other;
+
+                    if (s_B.at_key(s_Key).get(s_Other) || !AreEqual(s_Value, s_Other)) {
+                        std::printf("Mismatch at key %.*s.\n", static_cast<int>(s_Key.size()), s_Key.data());
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+            case simdjson::dom::element_type::STRING:
+                return p_A.get_string().value() == p_B.get_string().value();
+            case simdjson::dom::element_type::BOOL:
+                return p_A.get_bool().value() == p_B.get_bool().value();
+            default:
+                return true;
+        }
+    }
+
+    bool AreEqualJson(const std::string& p_A, const std::string& p_B) {
+        simdjson::dom::parser s_ParserA;
+        simdjson::dom::parser s_ParserB;
+        simdjson::dom::element s_A;
+        simdjson::dom::element s_B;
+
+        if (s_ParserA.parse(p_A).get(s_A) || s_ParserB.parse(p_B).get(s_B)) {
+            return false;
+        }
+
+        return AreEqual(s_A, s_B);
+    }
+
+    void TestResource(
+        const char* p_ResourceType, const char* p_ExpectedJson, const char* p_Json, const Vec_uint8_t& p_Bin1
+    ) {
+        const std::string s_Expected = GeneratedResourceToJson(p_ResourceType, p_ExpectedJson);
+        CHECK(!s_Expected.empty());
+
+        const std::string s_Actual = p_Bin1.len > 0
+            ? ResourceToJson(p_ResourceType, p_Bin1.ptr, p_Bin1.len)
+            : GeneratedResourceToJson(p_ResourceType, p_Json);
+
+        CHECK(!s_Actual.empty());
+        CHECK(AreEqualJson(s_Expected, s_Actual));
+    }
+
+    void TestEntity(const std::filesystem::path& p_Path, const bool p_ExpectNative) {
+        std::printf("Testing %s.\n", p_Path.filename().string().c_str());
+
+        const std::string s_Json = ReadFile(p_Path);
+        CHECK(!s_Json.empty());
+
+        auto* s_Native = convert_qn_entity(s_Json.c_str());
+        auto* s_FromJson = convert_qn_entity_to_json(s_Json.c_str());
+
+        CHECK(s_Native && s_FromJson);
+
+        if (!s_Native || !s_FromJson) {
+            return;
+        }
+
+        // Entities with property types the native writer doesn't know fall back to JSON as a whole.
+        CHECK((s_Native->factory_bin1.len > 0) == p_ExpectNative);
+        CHECK(s_Native->blueprint_bin1.len > 0);
+        CHECK(s_FromJson->factory_bin1.len == 0 && s_FromJson->blueprint_bin1.len == 0);
+
+        TestResource("TEMP", s_FromJson->factory_json, s_Native->factory_json, s_Native->factory_bin1);
+        TestResource("TBLU", s_FromJson->blueprint_json, s_Native->blueprint_json, s_Native->blueprint_bin1);
+
+        CHECK(strcmp(s_Native->factory_meta.hash, s_FromJson->factory_meta.hash) == 0);
+        CHECK(s_Native->factory_meta.references.len == s_FromJson->factory_meta.references.len);
+        CHECK(strcmp(s_Native->blueprint_meta.hash, s_FromJson->blueprint_meta.hash) == 0);
+        CHECK(s_Native->blueprint_meta.references.len == s_FromJson->blueprint_meta.references.len);
+
+        free_qn_converted_data(s_Native);
+        free_qn_converted_data(s_FromJson);
+    }
+}
+
+int main() {
+    const std::filesystem::path s_DataDir = ZHMMODSDK_TEST_DATA_DIR;
+
+    TestEntity(s_DataDir / "NativeBin1.entity.json", true);
+    TestEntity(s_DataDir / "ResourceLibFallback.entity.json", false);
+
+    return TestResult();
+}
@@ -0,0 +1,78 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ResourceLib_HM3.h>
+#include <zhmmodsdk_rs.h>
+
+#include "TestUtils.h"
+
+// Compares the old way of loading QN entities (RT JSON text that ResourceLib generates BIN1 from) against the
+// Rust library writing BIN1 directly. Entity files can be passed on the command line, the test data is used
+// otherwise. Only the conversion is measured, not loading the resources into the game.
+
+namespace {
+    void GenerateWithResourceLib(const char* p_ResourceType, const char* p_Json) {
+        const auto* s_Generator = HM3_GetGeneratorForResource(p_ResourceType);
+
+        if (auto* s_ResourceMem = s_Generator->FromJsonStringToResourceMem(p_Json, strlen(p_Json), false)) {
+            s_Generator->FreeResourceMem(s_ResourceMem);
+        }
+    }
+
+    // Resources that were written natively don't need ResourceLib anymore. The rest still goes through it.
+    void GenerateResources(const QnConvertedData& p_Data) {
+        if (p_Data.factory_bin1.len == 0) {
+            GenerateWithResourceLib("TEMP", p_Data.factory_json);
+        }
+
+        if (p_Data.blueprint_bin1.len == 0) {
+            GenerateWithResourceLib("TBLU", p_Data.blueprint_json);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    constexpr int c_Iterations = 50;
+
+    std::vector<std::filesystem::path> s_Paths;
+
+    for (int i = 1; i < argc; ++i) {
+        s_Paths.emplace_back(argv[i]);
+    }
+
+    if (s_Paths.empty()) {
+        s_Paths.emplace_back(std::filesystem::path(ZHMMODSDK_TEST_DATA_DIR) / "NativeBin1.entity.json");
+    }
+
+    for (const auto& s_Path : s_Paths) {
+        std::ifstream s_File(s_Path, std::ios::binary);
+        std::stringstream s_Stream;
+        s_Stream << s_File.rdbuf();
+        const std::string s_Json = s_Stream.str();
+
+        const auto s_MeasureConversion = [&](const auto p_Convert) {
+            return MeasureMilliseconds(
+                c_Iterations, [&]() {
+                    if (auto* s_Data = p_Convert(s_Json.c_str())) {
+                        GenerateResources(*s_Data);
+                        free_qn_converted_data(s_Data);
+                    }
+                }
+            );
+        };
+
+        const double s_JsonTime = s_MeasureConversion(&convert_qn_entity_to_json);
+        const double s_NativeTime = s_MeasureConversion(&convert_qn_entity);
+
+        std::printf(
+            "%s (%zu bytes): RT JSON + ResourceLib %.3f ms, native BIN1 %.3f ms\n",
+            s_Path.filename().string().c_str(), s_Json.size(), s_JsonTime, s_NativeTime
+        );
+    }
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "StaticMeshChunks.h"
+#include "TestUtils.h"
+
+namespace {
+    std::vector<ColoredVertex> RandomVertices(std::mt19937& p_Random, const size_t p_Count) {
+        std::uniform_real_distribution<float> s_Position(-100.f, 100.f);
+        std::vector<ColoredVertex> s_Vertices(p_Count);
+
+        for (ColoredVertex& s_Vertex : s_Vertices) {
+            s_Vertex.position = SVector3(s_Position(p_Random), s_Position(p_Random), s_Position(p_Random));
+            s_Vertex.color = SVector4(1.f, 1.f, 1.f, 1.f);
+        }
+
+        return s_Vertices;
+    }
+
+    std::vector<uint32_t> RandomIndices(std::mt19937& p_Random, const size_t p_Count, const size_t p_VertexCount) {
+        std::uniform_int_distribution<uint32_t> s_Index(0, static_cast<uint32_t>(p_VertexCount - 1));
+        std::vector<uint32_t> s_Indices(p_Count);
+
+        for (uint32_t& s_Value : s_Indices) {
+            s_Value = s_Index(p_Random);
+        }
+
+        return s_Indices;
+    }
+
+    // The primitives of an index list, so lists can be compared regardless of the order of their primitives.
+    std::vector<std::vector<uint32_t>> GetPrimitives(
+        const std::vector<uint32_t>& p_Indices, const size_t p_PrimitiveCount, const uint32_t p_IndicesPerPrimitive
+    ) {
+        std::vector<std::vector<uint32_t>> s_Primitives;
+
+        for (size_t i = 0; i < p_PrimitiveCount; ++i) {
+            s_Primitives.emplace_back(
+                p_Indices.begin() + i * p_IndicesPerPrimitive, p_Indices.begin() + (i + 1) * p_IndicesPerPrimitive
+            );
+        }
+
+        std::sort(s_Primitives.begin(), s_Primitives.end());
+
+        return s_Primitives;
+    }
+
+    bool IsInside(const SVector3& p_Position, const StaticMeshChunks::Chunk& p_Chunk) {
+        return p_Position.x >= p_Chunk.m_Min.x && p_Position.x <= p_Chunk.m_Max.x &&
+            p_Position.y >= p_Chunk.m_Min.y && p_Position.y <= p_Chunk.m_Max.y &&
+            p_Position.z >= p_Chunk.m_Min.z && p_Position.z <= p_Chunk.m_Max.z;
+    }
+
+    void TestBuild(
+        std::mt19937& p_Random, const size_t p_PrimitiveCount, const uint32_t p_IndicesPerPrimitive,
+        const size_t p_TrailingIndices
+    ) {
+        const std::vector<ColoredVertex> s_Vertices = RandomVertices(p_Random, 1000);
+        const std::vector<uint32_t> s_Indices = RandomIndices(
+            p_Random, p_PrimitiveCount * p_IndicesPerPrimitive + p_TrailingIndices, s_Vertices.size()
+        );
+
+        StaticMeshChunks s_Chunks;
+        std::vector<uint32_t> s_SortedIndices;
+
+        CHECK(s_Chunks.Build(s_Vertices, s_Indices, p_IndicesPerPrimitive, s_SortedIndices));
+
+        // Incomplete primitives at the end are dropped, everything else is kept exactly once.
+        CHECK(s_SortedIndices.size() == p_PrimitiveCount * p_IndicesPerPrimitive);
+        CHECK(
+            GetPrimitives(s_SortedIndices, p_PrimitiveCount, p_IndicesPerPrimitive) ==
+            GetPrimitives(s_Indices, p_PrimitiveCount, p_IndicesPerPrimitive)
+        );
+
+        const auto& s_ChunkList = s_Chunks.GetChunks();
+        const size_t s_ExpectedChunkCount =
+            (p_PrimitiveCount + StaticMeshChunks::c_PrimitivesPerChunk - 1) / StaticMeshChunks::c_PrimitivesPerChunk;
+
+        CHECK(s_ChunkList.size() == s_ExpectedChunkCount);
+
+        // Chunks cover the sorted indices back to back, and their bounds contain all of their vertices.
+        uint32_t s_NextIndex = 0;
+
+        for (const auto& s_Chunk : s_ChunkList) {
+            CHECK(s_Chunk.m_FirstIndex == s_NextIndex);
+            CHECK(s_Chunk.m_IndexCount > 0);
+            CHECK(s_Chunk.m_IndexCount % p_IndicesPerPrimitive == 0);
+            CHECK(s_Chunk.m_IndexCount <= StaticMeshChunks::c_PrimitivesPerChunk * p_IndicesPerPrimitive);
+
+            for (uint32_t i = 0; i < s_Chunk.m_IndexCount; ++i) {
+                CHECK(IsInside(s_Vertices[s_SortedIndices[s_Chunk.m_FirstIndex + i]].position, s_Chunk));
+            }
+
+            s_NextIndex += s_Chunk.m_IndexCount;
+        }
+
+        CHECK(s_NextIndex == s_SortedIndices.size());
+
+        // The structure-of-arrays bounds match the bounds of the chunks.
+        const FrustumCullAABBs s_Bounds = s_Chunks.GetChunkBounds();
+
+        for (size_t i = 0; i < s_ChunkList.size(); ++i) {
+            CHECK(s_Bounds.minX[i] == s_ChunkList[i].m_Min.x);
+            CHECK(s_Bounds.minY[i] == s_ChunkList[i].m_Min.y);
+            CHECK(s_Bounds.minZ[i] == s_ChunkList[i].m_Min.z);
+            CHECK(s_Bounds.maxX[i] == s_ChunkList[i].m_Max.x);
+            CHECK(s_Bounds.maxY[i] == s_ChunkList[i].m_Max.y);
+            CHECK(s_Bounds.maxZ[i] == s_ChunkList[i].m_Max.z);
+        }
+    }
+
+    void TestSpatialCoherence() {
+        // Two clusters of triangles that are far apart must never share a chunk.
+        std::vector<ColoredVertex> s_Vertices;
+        std::vector<uint32_t> s_Indices;
+
+        for (size_t i = 0; i < StaticMeshChunks::c_PrimitivesPerChunk * 2; ++i) {
+            const float s_Offset = (i % 2 == 0) ? -1000.f : 1000.f;
+            const float s_Jitter = static_cast<float>(i % 7);
+
+            for (uint32_t j = 0; j < 3; ++j) {
+                s_Indices.push_back(static_cast<uint32_t>(s_Vertices.size()));
+                s_Vertices.push_back({SVector3(s_Offset + s_Jitter + j, s_Jitter, 0.f), SVector4()});
+            }
+        }
+
+        StaticMeshChunks s_Chunks;
+        std::vector<uint32_t> s_SortedIndices;
+
+        CHECK(s_Chunks.Build(s_Vertices, s_Indices, 3, s_SortedIndices));
+        CHECK(s_Chunks.GetChunks().size() == 2);
+
+        for (const auto& s_Chunk : s_Chunks.GetChunks()) {
+            CHECK(s_Chunk.m_Max.x - s_Chunk.m_Min.x < 100.f);
+        }
+    }
+
+    void TestInvalidIndices() {
+        const std::vector<ColoredVertex> s_Vertices(3);
+        const std::vector<uint32_t> s_Indices = {0, 1, 2, 0, 1, 3};
+
+        StaticMeshChunks s_Chunks;
+        std::vector<uint32_t> s_SortedIndices;
+
+        CHECK(!s_Chunks.Build(s_Vertices, s_Indices, 3, s_SortedIndices));
+
+        // An out of range index in an incomplete primitive at the end is ignored along with the primitive.
+        const std::vector<uint32_t> s_TrailingIndices = {0, 1, 2, 7};
+
+        CHECK(s_Chunks.Build(s_Vertices, s_TrailingIndices, 3, s_SortedIndices));
+        CHECK(s_SortedIndices.size() == 3);
+
+        CHECK(s_Chunks.Build(s_Vertices, {}, 3, s_SortedIndices));
+        CHECK(s_Chunks.GetChunks().empty());
+        CHECK(s_SortedIndices.empty());
+    }
+
+    void TestVisibleRanges(std::mt19937& p_Random) {
+        const std::vector<ColoredVertex> s_Vertices = RandomVertices(p_Random, 1000);
+        const std::vector<uint32_t> s_Indices = RandomIndices(
+            p_Random, StaticMeshChunks::c_PrimitivesPerChunk * 70 * 3, s_Vertices.size()
+        );
+
+        StaticMeshChunks s_Chunks;
+        std::vector<uint32_t> s_SortedIndices;
+
+        CHECK(s_Chunks.Build(s_Vertices, s_Indices, 3, s_SortedIndices));
+
+        const auto& s_ChunkList = s_Chunks.GetChunks();
+        std::vector<uint64_t> s_Visibility(FrustumCulling::GetVisibilityMaskSize(s_ChunkList.size()), 0);
+        std::vector<StaticMeshChunks::DrawRange> s_Ranges = {{1, 2}};
+
+        s_Chunks.GetVisibleRanges(s_Visibility.data(), s_Ranges);
+        CHECK(s_Ranges.empty());
+
+        // All chunks visible are merged into a single range, across mask words.
+        std::fill(s_Visibility.begin(), s_Visibility.end(), ~0ull);
+        s_Chunks.GetVisibleRanges(s_Visibility.data(), s_Ranges);
+        CHECK(s_Ranges.size() == 1);
+        CHECK(s_Ranges[0].m_FirstIndex == 0);
+        CHECK(s_Ranges[0].m_IndexCount == s_SortedIndices.size());
+
+        // Every other chunk visible can't be merged.
+        std::fill(s_Visibility.begin(), s_Visibility.end(), 0x5555555555555555ull);
+        s_Chunks.GetVisibleRanges(s_Visibility.data(), s_Ranges);
+        CHECK(s_Ranges.size() == (s_ChunkList.size() + 1) / 2);
+
+        for (size_t i = 0; i < s_Ranges.size(); ++i) {
+            CHECK(s_Ranges[i].m_FirstIndex == s_ChunkList[i * 2].m_FirstIndex);
+            CHECK(s_Ranges[i].m_IndexCount == s_ChunkList[i * 2].m_IndexCount);
+        }
+
+        // Chunks 63 and 64 are in different mask words but still form one range.
+        std::fill(s_Visibility.begin(), s_Visibility.end(), 0ull);
+        s_Visibility[0] = 1ull << 63;
+        s_Visibility[1] = 1ull;
+        s_Chunks.GetVisibleRanges(s_Visibility.data(), s_Ranges);
+        CHECK(s_Ranges.size() == 1);
+        CHECK(s_Ranges[0].m_FirstIndex == s_ChunkList[63].m_FirstIndex);
+        CHECK(s_Ranges[0].m_IndexCount == s_ChunkList[63].m_IndexCount + s_ChunkList[64].m_IndexCount);
+    }
+}
+
+int main() {
+    std::mt19937 s_Random(1234);
+
+    for (const size_t s_PrimitiveCount : {1, 2, 511, 512, 513, 1024, 5000}) {
+        TestBuild(s_Random, s_PrimitiveCount, 3, 0);
+        TestBuild(s_Random, s_PrimitiveCount, 3, 2);
+        TestBuild(s_Random, s_PrimitiveCount, 2, 0);
+        TestBuild(s_Random, s_PrimitiveCount, 2, 1);
+    }
+
+    TestSpatialCoherence();
+    TestInvalidIndices();
+    TestVisibleRanges(s_Random);
+
+    return TestResult();
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+/**
+ * Minimal helpers shared by the tests and benchmarks. Tests report every failed check and return
+ * a non-zero exit code through TestResult() so CTest picks them up.
+ */
+inline int g_FailedChecks = 0;
+
+#define CHECK(p_Condition) \
+    do { \
+        if (!(p_Condition)) { \
+            std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #p_Condition); \
+            ++g_FailedChecks; \
+        } \
+    } while (false)
+
+inline int TestResult() {
+    if (g_FailedChecks > 0) {
+        std::printf("%d checks failed.\n", g_FailedChecks);
+        return 1;
+    }
+
+    std::printf("All checks passed.\n");
+    return 0;
+}
+
+/**
+ * Run a callable a number of times and return the average duration of a run in milliseconds.
+ */
+template <typename T>
+double MeasureMilliseconds(const int p_Iterations, T&& p_Callable) {
+    const auto s_Start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < p_Iterations; ++i) {
+        p_Callable();
+    }
+
+    const auto s_End = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(s_End - s_Start).count() / p_Iterations;
+}
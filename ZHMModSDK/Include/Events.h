@@ -6,7 +6,23 @@
 #include "Glacier/TArray.h"
 #include "Glacier/ZString.h"
 
+struct SChunkMountProgress {
+    // Index of the chunk that was mounted last.
+    uint32_t m_ChunkIndex;
+    uint32_t m_MountedChunkCount;
+    uint32_t m_TotalChunkCount;
+
+    // Number of resources still loading after all chunks have been mounted.
+    uint32_t m_PendingResourceCount;
+};
+
 class ZHMSDK_API Events {
 public:
     static EventDispatcher<TArray<ZString>>* OnConsoleCommand;
+
+    /**
+     * Called while the SDK mounts chunks, e.g. to load the dependencies of a spawned entity.
+     * It's called once after each chunk is mounted, and then repeatedly while the resources of those chunks load.
+     */
+    static EventDispatcher<const SChunkMountProgress&>* OnChunkMountProgress;
 };
\ No newline at end of file
@@ -188,4 +188,12 @@ inline constexpr uint32_t ZHMTypeId = Hash::Crc32(ZHMTypeName<T>.data(), ZHMType
 /**
  * ZRuntimeResourceID from an IOI path string.
  */
-template <detail::StringLiteral Path> inline constexpr auto ResId = detail::IOIPathToRuntimeResourceID<Path>();
\ No newline at end of file
+template <detail::StringLiteral Path> inline constexpr auto ResId = detail::IOIPathToRuntimeResourceID<Path>();
+
+/**
+ * The ID of a property or pin from its name, hashed at compile time.
+ * Prefer this over passing the name to ZEntityRef::GetProperty / SetProperty, which hashes it on every call.
+ */
+template <detail::StringLiteral Name> inline constexpr uint32_t PropertyId = Hash::Crc32(
+    Name.Value, sizeof(Name.Value) - 1
+);
@@ -187,26 +187,32 @@ struct SPinData {
 
 class ZEntityType {
 public:
-    SPropertyData* FindProperty(uint32_t p_PropertyId) const {
-        if (!m_pPropertyData) {
-            return nullptr;
-        }
+    /**
+     * Find the data of a property of this type.
+     * Types with many properties are looked up through a sorted index, which is built the first time one of their
+     * properties is requested and cached until the scene is cleared.
+     * @param p_PropertyId The ID of the property (CRC32 of its name, see PropertyId).
+     * @return The property data, or nullptr if the type has no such property.
+     */
+    ZHMSDK_API SPropertyData* FindProperty(uint32_t p_PropertyId) const;
+
+    /**
+     * Find the offset of an interface from the start of entities of this type.
+     * Results are cached per thread, so repeatedly casting entities of the same type is a single table lookup.
+     * @param p_TypeID The type ID of the interface.
+     * @param p_Offset Receives the offset of the interface.
+     * @return True if the type implements the interface.
+     */
+    ZHMSDK_API bool FindInterfaceOffset(const STypeID* p_TypeID, int64_t& p_Offset) const;
 
-        auto s_Property = std::find_if(
-            m_pPropertyData->begin(),
-            m_pPropertyData->end(),
-            [p_PropertyId](const SPropertyData& p_Property) {
-                return p_Property.m_nPropertyID == p_PropertyId;
-            }
-        );
+private:
+    friend class ModSDK;
 
-        if (s_Property != m_pPropertyData->end()) {
-            return s_Property;
-        }
-
-        return nullptr;
-    }
+    // Entity types are freed together with their scene, and their addresses are reused afterwards.
+    static void ClearPropertyIndices();
+    static void ClearInterfaceCache();
 
+public:
     int32_t m_nBorrowedPointersMask; // 0x0
     TArray<SPropertyData>* m_pPropertyData; // 0x8
     TArray<SPropertyData>* m_pResettablePropertyData; // 0x10
@@ -375,75 +381,42 @@ public:
 
     template <class T>
     T* QueryInterface() const {
-        const auto s_Entity = GetEntity();
-
-        if (!s_Entity || !*Globals::TypeRegistry || !s_Entity->GetType())
-            return nullptr;
-
-        const auto s_TypeID = (*Globals::TypeRegistry)->GetTypeID(ZHMTypeName<T>);
-
-        if (!s_TypeID)
-            return nullptr;
-
-        for (const auto& s_Interface : *s_Entity->GetType()->m_pInterfaceData) {
-            if (s_Interface.m_Type == s_TypeID) {
-                return reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(m_pObj) + s_Interface.m_nInterfaceOffset);
-            }
-        }
-
-        return nullptr;
+        return static_cast<T*>(QueryInterface(GetStaticTypeID<T>()));
     }
 
     template <class T>
     T* QueryInterface(STypeID* p_TypeID) const {
-        const auto s_Entity = GetEntity();
-
-        if (!s_Entity || !*Globals::TypeRegistry || !s_Entity->GetType())
-            return nullptr;
-
-        for (const auto& s_Interface : *s_Entity->GetType()->m_pInterfaceData) {
-            if (s_Interface.m_Type == p_TypeID) {
-                return reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(m_pObj) + s_Interface.m_nInterfaceOffset);
-            }
-        }
-
-        return nullptr;
+        return static_cast<T*>(QueryInterface(p_TypeID));
     }
 
     void* QueryInterface(const STypeID* p_TypeID) const {
         const auto s_Entity = GetEntity();
 
-        if (!s_Entity || !*Globals::TypeRegistry || !s_Entity->GetType())
+        if (!p_TypeID || !s_Entity || !s_Entity->GetType())
             return nullptr;
 
-        for (const auto& s_Interface : *s_Entity->GetType()->m_pInterfaceData) {
-            if (s_Interface.m_Type == p_TypeID) {
-                return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(m_pObj) + s_Interface.m_nInterfaceOffset);
-            }
-        }
+        int64_t s_Offset;
+
+        if (!s_Entity->GetType()->FindInterfaceOffset(p_TypeID, s_Offset))
+            return nullptr;
 
-        return nullptr;
+        return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(m_pObj) + s_Offset);
     }
 
     template <class T>
     bool HasInterface() const {
         const auto s_Entity = GetEntity();
 
-        if (!s_Entity || !*Globals::TypeRegistry)
+        if (!s_Entity || !s_Entity->GetType())
             return false;
 
-        const auto s_TypeID = (*Globals::TypeRegistry)->GetTypeID(ZHMTypeName<T>);
+        const auto s_TypeID = GetStaticTypeID<T>();
 
         if (!s_TypeID)
             return false;
 
-        for (const auto& s_Interface : *s_Entity->GetType()->m_pInterfaceData) {
-            if (s_Interface.m_Type == s_TypeID) {
-                return true;
-            }
-        }
-
-        return false;
+        int64_t s_Offset;
+        return s_Entity->GetType()->FindInterfaceOffset(s_TypeID, s_Offset);
     }
 
     bool HasInterface(const ZString& p_TypeName) const {
@@ -457,13 +430,8 @@ public:
         if (!s_TypeID)
             return false;
 
-        for (const auto& s_Interface : *s_Entity->GetType()->m_pInterfaceData) {
-            if (s_Interface.m_Type == s_TypeID) {
-                return true;
-            }
-        }
-
-        return false;
+        int64_t s_Offset;
+        return s_Entity->GetType()->FindInterfaceOffset(s_TypeID, s_Offset);
     }
 
     template <typename T>
@@ -477,41 +445,36 @@ public:
 
         const auto s_Type = s_Entity->GetType();
 
-        if (!s_Type || !s_Type->m_pPropertyData)
+        if (!s_Type)
             return s_PropertyValue;
 
-        for (uint32_t i = 0; i < s_Type->m_pPropertyData->size(); ++i) {
-            const SPropertyData* s_Property = &(*s_Type->m_pPropertyData)[i];
+        const SPropertyData* s_Property = s_Type->FindProperty(nPropertyID);
 
-            if (s_Property->m_nPropertyID != nPropertyID) {
-                continue;
-            }
-
-            const auto* s_PropertyInfo = s_Property->GetPropertyInfo();
-            const auto s_PropertyAddress = reinterpret_cast<uintptr_t>(m_pObj) + s_Property->m_nPropertyOffset;
-
-            const uint16_t s_TypeSize = s_PropertyInfo->m_propertyInfo.m_Type->GetTypeInfo()->m_nTypeSize;
-            const uint16_t s_TypeAlignment = s_PropertyInfo->m_propertyInfo.m_Type->GetTypeInfo()->m_nTypeAlignment;
+        if (!s_Property)
+            return s_PropertyValue;
 
-            auto* s_Data = (*Globals::MemoryManager)->m_pNormalAllocator->AllocateAligned(s_TypeSize, s_TypeAlignment);
+        const auto* s_PropertyInfo = s_Property->GetPropertyInfo();
+        const auto s_PropertyAddress = reinterpret_cast<uintptr_t>(m_pObj) + s_Property->m_nPropertyOffset;
 
-            if (s_PropertyInfo->m_propertyInfo.m_Flags & EPropertyInfoFlags::E_HAS_GETTER_SETTER) {
-                s_PropertyInfo->m_propertyInfo.m_PropetyGetter(
-                    reinterpret_cast<void*>(s_PropertyAddress),
-                    s_Data,
-                    s_PropertyInfo->m_propertyInfo.m_nExtraData
-                );
-            }
-            else {
-                s_PropertyInfo->m_propertyInfo.m_Type->GetTypeInfo()->m_pTypeFunctions->placementCopyConstruct(
-                    s_Data, reinterpret_cast<void*>(s_PropertyAddress)
-                );
-            }
+        const uint16_t s_TypeSize = s_PropertyInfo->m_propertyInfo.m_Type->GetTypeInfo()->m_nTypeSize;
+        const uint16_t s_TypeAlignment = s_PropertyInfo->m_propertyInfo.m_Type->GetTypeInfo()->m_nTypeAlignment;
 
-            s_PropertyValue.UNSAFE_Assign(s_PropertyInfo->m_propertyInfo.m_Type, s_Data);
+        auto* s_Data = (*Globals::MemoryManager)->m_pNormalAllocator->AllocateAligned(s_TypeSize, s_TypeAlignment);
 
-            break;
+        if (s_PropertyInfo->m_propertyInfo.m_Flags & EPropertyInfoFlags::E_HAS_GETTER_SETTER) {
+            s_PropertyInfo->m_propertyInfo.m_PropetyGetter(
+                reinterpret_cast<void*>(s_PropertyAddress),
+                s_Data,
+                s_PropertyInfo->m_propertyInfo.m_nExtraData
+            );
         }
+        else {
+            s_PropertyInfo->m_propertyInfo.m_Type->GetTypeInfo()->m_pTypeFunctions->placementCopyConstruct(
+                s_Data, reinterpret_cast<void*>(s_PropertyAddress)
+            );
+        }
+
+        s_PropertyValue.UNSAFE_Assign(s_PropertyInfo->m_propertyInfo.m_Type, s_Data);
 
         return s_PropertyValue;
     }
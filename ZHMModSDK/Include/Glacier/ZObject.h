@@ -6,12 +6,37 @@
 #include "Globals.h"
 #include "ZObjectPool.h"
 
+#include <atomic>
 #include <cassert>
 
 class STypeID;
 class ZString;
 struct SDynamicObjectKeyValuePair;
 
+/**
+ * Get the type ID of T from the type registry.
+ * Types are never unregistered, so once the ID has been found it's cached instead of looking it up by name again.
+ * @return The type ID, or nullptr if T isn't registered (yet).
+ */
+template <class T>
+STypeID* GetStaticTypeID() {
+    static std::atomic<STypeID*> s_CachedTypeID = nullptr;
+
+    STypeID* s_TypeID = s_CachedTypeID.load(std::memory_order_acquire);
+
+    if (s_TypeID || !*Globals::TypeRegistry) {
+        return s_TypeID;
+    }
+
+    s_TypeID = (*Globals::TypeRegistry)->GetTypeID(ZHMTypeName<T>);
+
+    if (s_TypeID) {
+        s_CachedTypeID.store(s_TypeID, std::memory_order_release);
+    }
+
+    return s_TypeID;
+}
+
 class ZObjectRef {
 public:
     ZHMSDK_API static STypeID* GetVoidType();
@@ -128,7 +153,7 @@ public:
     void Replace(const T& p_Value) {
         Clear();
 
-        m_pTypeID = (*Globals::TypeRegistry)->GetTypeID(ZHMTypeName<T>);
+        m_pTypeID = GetStaticTypeID<T>();
         m_pData = (*Globals::MemoryManager)->m_pNormalAllocator->AllocateAligned(
             m_pTypeID->GetTypeInfo()->m_nTypeSize,
             m_pTypeID->GetTypeInfo()->m_nTypeAlignment
@@ -249,7 +274,7 @@ class ZVariantRef :
         public ZObjectRef {
 public:
     ZVariantRef(T* p_Value) {
-        m_pTypeID = (*Globals::TypeRegistry)->GetTypeID(ZHMTypeName<T>);
+        m_pTypeID = GetStaticTypeID<T>();
         m_pData = p_Value;
     }
 
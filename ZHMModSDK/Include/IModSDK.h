@@ -1,17 +1,23 @@
 #pragma once
 
+#include <memory>
+
 #include "ModSDKVersion.h"
 #include "Glacier/ZPrimitives.h"
 #include "Glacier/ZEntity.h"
 #include "Glacier/ZResource.h"
 #include "Glacier/EntityFactory.h"
 #include "Common.h"
+#include "MainThreadTask.h"
 #include "imgui.h"
 #include "D3DUtils.h"
 #include "directx/d3d12.h"
 
 #include "implot.h"
 
+#include <span>
+#include <vector>
+
 class IPluginInterface;
 class ZRenderDestination;
 class SVector2;
@@ -21,6 +27,8 @@ template <typename T>
 class TEntityRef;
 
 class ZHitman5;
+class RepositoryIndex;
+class PluginSettingHandle;
 
 struct ImGuiTexture;
 
@@ -54,7 +62,7 @@ public:
     /**
      * Try to get the name of a pin by its ID.
      * @param p_PinId The pid id (CRC32 of the pin name).
-     * @param p_Name The output name of the pin.
+     * @param p_Name The output name of the pin. It points to static storage, so no memory is allocated.
      * @return True if the pin name was found, false otherwise.
      */
     virtual bool GetPinName(int32_t p_PinId, ZString& p_Name) = 0;
@@ -266,7 +274,7 @@ public:
     ) = 0;
 
     /**
-     * Check if a chunk is mounted.
+     * Check if a chunk is mounted. This is a constant time lookup and can be called frequently.
      * @param p_ChunkIndex The index of the chunk to check.
      * @return True if the chunk is mounted, false otherwise.
      */
@@ -305,10 +313,11 @@ public:
 
     /**
      * Get the list of indices of chunks that contain the resource with the specified runtime resource ID.
+     * Safe to call from any thread.
      * @param id The runtime resource ID to look up.
-     * @return A constant reference to an array of chunk indices. If no chunks are found, an empty array is returned.
+     * @return The chunk indices. If no chunks are found, an empty array is returned.
      */
-    virtual const TArray<uint32_t>& GetChunkIndicesForRuntimeResourceId(const ZRuntimeResourceID& id) = 0;
+    virtual TArray<uint32_t> GetChunkIndicesForRuntimeResourceId(const ZRuntimeResourceID& id) = 0;
 
     /**
      * Create a DirectX 12 texture from DDS data in memory and initialize an ImGui texture descriptor.
@@ -367,6 +376,93 @@ public:
         ScopedD3DRef<ID3D12Resource>& p_OutTexture,
         ImGuiTexture& p_OutImGuiTexture
     ) = 0;
+
+    /**
+     * Queue a task to run on the main thread. Tasks from all mods share a single per-frame
+     * time budget; whatever doesn't fit in the current frame continues on the next one.
+     * Tasks queued by a mod are dropped if the mod gets unloaded before they run.
+     * This can be called from any thread.
+     * @param p_Plugin The plugin queuing the task.
+     * @param p_Task The task to run. Return ETaskStatus::Continue from it to be resumed on a later frame.
+     * @param p_Priority The priority of the task. Higher priority tasks always run first.
+     */
+    virtual void QueueMainThreadTask(IPluginInterface* p_Plugin, MainThreadTask&& p_Task, ETaskPriority p_Priority) = 0;
+
+    /**
+     * Load entity resources from several QuickEntity JSON strings at once. The entities are converted
+     * in parallel and then loaded one after another, which is faster than calling LoadQnEntity for each.
+     * @param p_Jsons The QuickEntity JSON strings.
+     * @param p_BlueprintFactoriesOut The resulting blueprint factory resources. Must be the same size as p_Jsons.
+     * @param p_FactoriesOut The resulting factory resources. Must be the same size as p_Jsons.
+     * @return True if all resources were loaded successfully, false if any of them failed.
+     */
+    virtual bool LoadQnEntities(
+        std::span<const ZString> p_Jsons,
+        std::span<TResourcePtr<ZTemplateEntityBlueprintFactory>> p_BlueprintFactoriesOut,
+        std::span<TResourcePtr<ZTemplateEntityFactory>> p_FactoriesOut
+    ) = 0;
+
+    /**
+     * Get the highest patch level of a mounted chunk.
+     * @param p_ChunkIndex The index of the chunk to check.
+     * @return The patch level (0 if only the base package is mounted), or -1 if the chunk isn't mounted.
+     */
+    virtual int32_t GetMountedChunkPatchLevel(uint32_t p_ChunkIndex) = 0;
+
+    /**
+     * Get the indices of all mounted chunks, in the order they were mounted. Unmounting a chunk also unmounts every
+     * chunk that was mounted after it.
+     * @return The chunk indices, each listed once.
+     */
+    virtual std::vector<uint32_t> GetMountedChunkIndices() = 0;
+
+    /**
+     * Get an index of the game repository (pro.repo). The SDK builds it on the main thread once the repository
+     * is loaded and keeps it across scenes. When called on the main thread, the index is built right away if the
+     * repository is loaded but the index isn't built yet. Safe to call from any thread.
+     * Prefer this over walking the repository resource, since the index is shared by all mods.
+     * @return The index, or nullptr if the repository isn't loaded yet. The index references the repository
+     *         resource, so don't hold on to it past the current frame.
+     */
+    virtual std::shared_ptr<const RepositoryIndex> GetRepositoryIndex() = 0;
+
+    /**
+     * Get a handle to a plugin setting, which holds its already parsed value.
+     * Reading through the handle doesn't lock or parse anything, so it's cheap enough for per-frame code.
+     * @param p_Plugin The plugin to get the setting for.
+     * @param p_Section The section of the setting in the INI file.
+     * @param p_Name The name of the setting.
+     * @return The handle, valid for as long as the plugin is loaded, or nullptr if the plugin is unknown.
+     */
+    virtual const PluginSettingHandle* GetPluginSettingHandle(
+        IPluginInterface* p_Plugin, const ZString& p_Section, const ZString& p_Name
+    ) = 0;
+
+    /**
+     * Try to get the ID of a pin by its name.
+     * @param p_Name The name of the pin (case-sensitive).
+     * @param p_PinId The output ID of the pin.
+     * @return True if the pin is known, false otherwise.
+     */
+    virtual bool GetPinId(const ZString& p_Name, int32_t& p_PinId) = 0;
+
+    /**
+     * Get a fingerprint of the installed game files: the executable and everything in the runtime directory.
+     * It changes when the game is updated or when a mod adds or replaces resource packages, so mods can store it
+     * next to data they cache on disk and rebuild the data when it no longer matches.
+     * @return The fingerprint. Computing it walks the runtime directory, so call it once and keep the result.
+     */
+    virtual uint64_t GetGameBuildFingerprint() = 0;
+
+    /**
+     * Replace the AmmoConfig of a repository entry, which changes the repository the game reads from.
+     * Has to be called on the main thread, so the change doesn't race with the game or other mods reading it.
+     * @param p_Id The ID of the entry, either its ID_ property or its key in the repository.
+     * @param p_Value The new value.
+     * @return True if the value was replaced, false if the entry has no AmmoConfig, the repository isn't loaded
+     *         or this isn't the main thread.
+     */
+    virtual bool SetRepositoryAmmoConfig(const ZRepositoryID& p_Id, const ZDynamicObject& p_Value) = 0;
 };
 
 /**
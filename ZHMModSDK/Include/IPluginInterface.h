@@ -3,6 +3,7 @@
 #include "Hooks.h"
 #include "IModSDK.h"
 #include "IRenderer.h"
+#include "PluginSettingHandle.h"
 
 class IPluginInterface {
 public:
@@ -182,6 +183,27 @@ public:
         SDK()->ReloadPluginSettings(this);
     }
 
+    /**
+     * Get a handle to a setting, which can be kept around and read from every frame without any parsing.
+     * The handle follows changes to the setting, including reloads.
+     * @param p_Section The section of the setting in the INI file.
+     * @param p_Name The name of the setting.
+     * @return The handle, valid for as long as this plugin is loaded.
+     */
+    const PluginSettingHandle* GetSettingHandle(const ZString& p_Section, const ZString& p_Name) {
+        return SDK()->GetPluginSettingHandle(this, p_Section, p_Name);
+    }
+
+    /**
+     * Queue a task to run on the main thread, within the frame budget shared by all mods.
+     * @param p_Task The task to run. Can return ETaskStatus::Continue to be resumed on a later frame.
+     * @param p_Priority The priority of the task.
+     */
+    template <typename T>
+    void QueueMainThreadTask(T&& p_Task, ETaskPriority p_Priority = ETaskPriority::Normal) {
+        SDK()->QueueMainThreadTask(this, MainThreadTask(std::forward<T>(p_Task)), p_Priority);
+    }
+
     friend class ModSDK;
 };
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include "imgui.h"
 
 #include "Glacier/ZMath.h"
@@ -37,6 +39,23 @@ struct Triangle {
     SVector2 textureCoordinates3;
 };
 
+struct ColoredVertex {
+    SVector3 position;
+    SVector4 color;
+};
+
+/**
+ * Handle to a mesh created with IRenderer::CreateStaticMesh.
+ */
+enum class StaticMeshHandle : uint32_t {
+    Invalid = 0,
+};
+
+enum class StaticMeshTopology {
+    Triangles,
+    Lines,
+};
+
 struct AABB {
     SVector3 min;
     SVector3 max;
@@ -138,4 +157,57 @@ public:
 
     virtual void SetMaxDrawDistance(float p_MaxDrawDistance) = 0;
     virtual float GetMaxDrawDistance() const = 0;
+
+    /**
+     * Draw a large number of lines at once.
+     * Lines are culled in blocks and written straight into the line batch, which is a lot cheaper
+     * than calling DrawLine3D for each line individually.
+     */
+    virtual void DrawLines3D(std::span<const Line> p_Lines) = 0;
+
+    /**
+     * Draw a large number of untextured triangles at once. Texture coordinates are ignored.
+     */
+    virtual void DrawTriangles3D(std::span<const Triangle> p_Triangles) = 0;
+
+    /**
+     * Draw an indexed triangle list, where every three indices form a triangle.
+     * Triangles are culled individually, so this can be used for large meshes that are only partially visible.
+     * Every index must be smaller than p_Vertices.size(). If any index is out of range an error is logged and
+     * nothing is drawn. Indices past the last full triangle are ignored.
+     */
+    virtual void DrawIndexedTriangles3D(
+        std::span<const ColoredVertex> p_Vertices, std::span<const uint32_t> p_Indices
+    ) = 0;
+
+    /**
+     * Create a mesh that is kept in GPU memory, for geometry that doesn't change every frame.
+     * The mesh is uploaded on first use and split into spatial chunks that are culled individually,
+     * so drawing it is a lot cheaper than re-submitting the same primitives every frame.
+     * @param p_Vertices The vertices of the mesh.
+     * @param p_Indices The indices of the mesh. Every three (for triangles) or two (for lines) indices form a primitive.
+     * @param p_Topology Whether the mesh consists of triangles or lines.
+     * @return A handle to the mesh, or StaticMeshHandle::Invalid if the mesh couldn't be created.
+     */
+    virtual StaticMeshHandle CreateStaticMesh(
+        std::span<const ColoredVertex> p_Vertices, std::span<const uint32_t> p_Indices,
+        StaticMeshTopology p_Topology = StaticMeshTopology::Triangles
+    ) = 0;
+
+    /**
+     * Replace the colors of a range of vertices of a static mesh.
+     * @param p_Mesh The mesh to update.
+     * @param p_FirstVertex The index of the first vertex to update.
+     * @param p_Colors The new colors. Colors past the end of the mesh are ignored.
+     */
+    virtual void UpdateStaticMeshColors(
+        StaticMeshHandle p_Mesh, size_t p_FirstVertex, std::span<const SVector4> p_Colors
+    ) = 0;
+
+    virtual void DrawStaticMesh(StaticMeshHandle p_Mesh) = 0;
+
+    /**
+     * Destroy a static mesh. Its GPU memory is released once the GPU is done with any frame still using it.
+     */
+    virtual void DestroyStaticMesh(StaticMeshHandle p_Mesh) = 0;
 };
\ No newline at end of file
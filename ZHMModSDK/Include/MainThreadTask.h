@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Priority of a task queued on the main thread scheduler.
+ * Higher priority tasks always run before lower priority ones.
+ */
+enum class ETaskPriority : uint8_t {
+    High,
+    Normal,
+    Low,
+};
+
+/**
+ * Result of running a main thread task.
+ * Tasks that return Continue are queued again and resumed on a later frame.
+ */
+enum class ETaskStatus : uint8_t {
+    Done,
+    Continue,
+};
+
+/**
+ * A move-only callable that is run by the main thread scheduler.
+ *
+ * Small callables are stored inline, so queuing a lambda that only captures a few
+ * pointers or values does not allocate. Larger callables fall back to the heap.
+ * All storage management happens through functions instantiated in the module that
+ * created the task, so tasks can safely be passed between mods and the SDK.
+ *
+ * The wrapped callable can either return nothing (in which case it's considered done
+ * after running once), or an ETaskStatus value.
+ */
+class MainThreadTask {
+public:
+    static constexpr size_t c_InlineSize = 6 * sizeof(void*);
+
+    MainThreadTask() = default;
+
+    template <
+        typename T,
+        typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, MainThreadTask>>
+    >
+    MainThreadTask(T&& p_Callable) {
+        using Callable = std::decay_t<T>;
+
+        if constexpr (IsStoredInline<Callable>()) {
+            new(m_Storage) Callable(std::forward<T>(p_Callable));
+            m_Operations = &c_InlineOperations<Callable>;
+        }
+        else {
+            *reinterpret_cast<Callable**>(m_Storage) = new Callable(std::forward<T>(p_Callable));
+            m_Operations = &c_HeapOperations<Callable>;
+        }
+    }
+
+    MainThreadTask(MainThreadTask&& p_Other) noexcept {
+        MoveFrom(p_Other);
+    }
+
+    MainThreadTask& operator=(MainThreadTask&& p_Other) noexcept {
+        if (this != &p_Other) {
+            Reset();
+            MoveFrom(p_Other);
+        }
+
+        return *this;
+    }
+
+    MainThreadTask(const MainThreadTask&) = delete;
+    MainThreadTask& operator=(const MainThreadTask&) = delete;
+
+    ~MainThreadTask() {
+        Reset();
+    }
+
+    ETaskStatus operator()() {
+        return m_Operations->Invoke(m_Storage);
+    }
+
+    explicit operator bool() const {
+        return m_Operations != nullptr;
+    }
+
+    void Reset() {
+        if (m_Operations) {
+            m_Operations->Destroy(m_Storage);
+            m_Operations = nullptr;
+        }
+    }
+
+private:
+    struct Operations {
+        ETaskStatus (*Invoke)(void* p_Storage);
+        void (*Move)(void* p_Destination, void* p_Source);
+        void (*Destroy)(void* p_Storage);
+    };
+
+    template <typename Callable>
+    static constexpr bool IsStoredInline() {
+        return sizeof(Callable) <= c_InlineSize &&
+            alignof(Callable) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible_v<Callable>;
+    }
+
+    template <typename Callable>
+    static ETaskStatus InvokeCallable(Callable& p_Callable) {
+        if constexpr (std::is_same_v<std::invoke_result_t<Callable&>, ETaskStatus>) {
+            return p_Callable();
+        }
+        else {
+            p_Callable();
+            return ETaskStatus::Done;
+        }
+    }
+
+    template <typename Callable>
+    static constexpr Operations c_InlineOperations {
+        [](void* p_Storage) {
+            return InvokeCallable(*static_cast<Callable*>(p_Storage));
+        },
+        [](void* p_Destination, void* p_Source) {
+            new(p_Destination) Callable(std::move(*static_cast<Callable*>(p_Source)));
+            static_cast<Callable*>(p_Source)->~Callable();
+        },
+        [](void* p_Storage) {
+            static_cast<Callable*>(p_Storage)->~Callable();
+        },
+    };
+
+    template <typename Callable>
+    static constexpr Operations c_HeapOperations {
+        [](void* p_Storage) {
+            return InvokeCallable(**static_cast<Callable**>(p_Storage));
+        },
+        [](void* p_Destination, void* p_Source) {
+            *static_cast<Callable**>(p_Destination) = *static_cast<Callable**>(p_Source);
+        },
+        [](void* p_Storage) {
+            delete *static_cast<Callable**>(p_Storage);
+        },
+    };
+
+    void MoveFrom(MainThreadTask& p_Other) {
+        if (p_Other.m_Operations) {
+            p_Other.m_Operations->Move(m_Storage, p_Other.m_Storage);
+            m_Operations = p_Other.m_Operations;
+            p_Other.m_Operations = nullptr;
+        }
+    }
+
+private:
+    alignas(std::max_align_t) unsigned char m_Storage[c_InlineSize];
+    const Operations* m_Operations = nullptr;
+};
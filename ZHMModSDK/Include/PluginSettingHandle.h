@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * A pre-parsed view of a single plugin setting.
+ *
+ * The SDK parses the value of the setting whenever it's set, removed or reloaded, so reading it through a handle
+ * is just a few atomic loads, without any locking, string copies or parsing. This makes handles suitable for code
+ * that reads settings every frame. Get one through IPluginInterface::GetSettingHandle. Handles stay valid for as
+ * long as the plugin is loaded.
+ */
+class PluginSettingHandle {
+public:
+    bool Exists() const {
+        return (Load().m_Flags & c_ExistsFlag) != 0;
+    }
+
+    int64_t GetInt(const int64_t p_DefaultValue) const {
+        const auto s_Value = Load();
+        return (s_Value.m_Flags & c_IntFlag) ? s_Value.m_Int : p_DefaultValue;
+    }
+
+    uint64_t GetUInt(const uint64_t p_DefaultValue) const {
+        const auto s_Value = Load();
+        return (s_Value.m_Flags & c_UIntFlag) ? s_Value.m_UInt : p_DefaultValue;
+    }
+
+    double GetDouble(const double p_DefaultValue) const {
+        const auto s_Value = Load();
+        return (s_Value.m_Flags & c_DoubleFlag) ? s_Value.m_Double : p_DefaultValue;
+    }
+
+    bool GetBool(const bool p_DefaultValue) const {
+        const auto s_Value = Load();
+        return (s_Value.m_Flags & c_BoolFlag) ? s_Value.m_Bool : p_DefaultValue;
+    }
+
+private:
+    friend class ModSettings;
+
+    static constexpr uint32_t c_ExistsFlag = 1 << 0;
+    static constexpr uint32_t c_IntFlag = 1 << 1;
+    static constexpr uint32_t c_UIntFlag = 1 << 2;
+    static constexpr uint32_t c_DoubleFlag = 1 << 3;
+    static constexpr uint32_t c_BoolFlag = 1 << 4;
+
+    struct Value {
+        uint32_t m_Flags = 0;
+        int64_t m_Int = 0;
+        uint64_t m_UInt = 0;
+        double m_Double = 0.0;
+        bool m_Bool = false;
+    };
+
+    // The values are guarded by a sequence counter, which is odd while they're being written.
+    // Readers retry until they see the same even counter before and after reading.
+    Value Load() const {
+        while (true) {
+            const uint32_t s_Sequence = m_Sequence.load(std::memory_order_acquire);
+
+            if (s_Sequence & 1) {
+                continue;
+            }
+
+            Value s_Value;
+            s_Value.m_Flags = m_Flags.load(std::memory_order_relaxed);
+            s_Value.m_Int = m_Int.load(std::memory_order_relaxed);
+            s_Value.m_UInt = m_UInt.load(std::memory_order_relaxed);
+            s_Value.m_Double = m_Double.load(std::memory_order_relaxed);
+            s_Value.m_Bool = m_Bool.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (m_Sequence.load(std::memory_order_relaxed) == s_Sequence) {
+                return s_Value;
+            }
+        }
+    }
+
+    // Only called by ModSettings, which serializes writers.
+    void Store(const Value& p_Value) {
+        const uint32_t s_Sequence = m_Sequence.load(std::memory_order_relaxed);
+
+        m_Sequence.store(s_Sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        m_Flags.store(p_Value.m_Flags, std::memory_order_relaxed);
+        m_Int.store(p_Value.m_Int, std::memory_order_relaxed);
+        m_UInt.store(p_Value.m_UInt, std::memory_order_relaxed);
+        m_Double.store(p_Value.m_Double, std::memory_order_relaxed);
+        m_Bool.store(p_Value.m_Bool, std::memory_order_relaxed);
+
+        m_Sequence.store(s_Sequence + 2, std::memory_order_release);
+    }
+
+private:
+    std::atomic<uint32_t> m_Sequence {0};
+    std::atomic<uint32_t> m_Flags {0};
+    std::atomic<int64_t> m_Int {0};
+    std::atomic<uint64_t> m_UInt {0};
+    std::atomic<double> m_Double {0.0};
+    std::atomic<bool> m_Bool {false};
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Glacier/ZPrimitives.h"
+#include "Glacier/ZString.h"
+
+struct SDynamicObjectKeyValuePair;
+
+/**
+ * A columnar index of the game repository (pro.repo).
+ *
+ * The repository is a hash map of dynamic objects, and reading a single property of an entry means comparing
+ * the keys of all its key / value pairs. The SDK walks it once when it's first requested and stores the
+ * properties mods usually need in typed columns, so lookups by ID and listing entries of a kind are cheap.
+ *
+ * Entries are addressed by a stable index in [0, GetEntryCount()). The index references the data of the loaded
+ * repository resource, and the SDK builds a new one if that resource is ever reloaded. Get it again through
+ * IModSDK::GetRepositoryIndex instead of holding on to it.
+ */
+class RepositoryIndex {
+public:
+    static constexpr uint32_t c_InvalidIndex = UINT32_MAX;
+
+    /**
+     * Build the index from the data of a loaded repository resource.
+     * @param p_RepositoryData The resource data, a THashMap<ZRepositoryID, ZDynamicObject>.
+     */
+    void Build(void* p_RepositoryData);
+    void Clear();
+
+    bool IsLoaded() const {
+        return m_IsLoaded;
+    }
+
+    size_t GetEntryCount() const {
+        return m_Ids.size();
+    }
+
+    /**
+     * Find an entry by its ID. Both the ID_ property and the key of the entry in the repository are indexed.
+     * @return The index of the entry, or c_InvalidIndex if there's no such entry.
+     */
+    uint32_t Find(const ZRepositoryID& p_Id) const {
+        const auto s_It = m_IdToIndex.find(p_Id);
+        return s_It != m_IdToIndex.end() ? s_It->second : c_InvalidIndex;
+    }
+
+    const ZRepositoryID& GetId(const uint32_t p_Index) const { return m_Ids[p_Index]; }
+    const ZString& GetTitle(const uint32_t p_Index) const { return m_Titles[p_Index]; }
+    const ZString& GetCommonName(const uint32_t p_Index) const { return m_CommonNames[p_Index]; }
+    const ZString& GetName(const uint32_t p_Index) const { return m_Names[p_Index]; }
+
+    /**
+     * Get the name to show for an entry, formatted as "<name> [<id>]". Items use their title, common name or name
+     * (whichever is set first), outfits their common name.
+     */
+    const std::string& GetDisplayName(const uint32_t p_Index) const { return m_DisplayNames[p_Index]; }
+
+    /**
+     * Get the category of an item, based on its InventoryCategoryIcon with the first letter capitalized
+     * (e.g. "Melee" or "QuestItem"). Items with an invalid icon are in the "Other" category.
+     */
+    std::string_view GetCategory(const uint32_t p_Index) const {
+        return m_CategoryNames[m_CategoryIds[p_Index]];
+    }
+
+    uint16_t GetCategoryId(const uint32_t p_Index) const { return m_CategoryIds[p_Index]; }
+
+    bool IsItem(const uint32_t p_Index) const { return m_Flags[p_Index] & c_ItemFlag; }
+    bool IsWeapon(const uint32_t p_Index) const { return m_Flags[p_Index] & c_WeaponFlag; }
+    bool IsOutfit(const uint32_t p_Index) const { return m_Flags[p_Index] & c_OutfitFlag; }
+    bool IsHitmanSuit(const uint32_t p_Index) const { return m_Flags[p_Index] & c_HitmanSuitFlag; }
+    bool IsHeroDisguiseAvailable(const uint32_t p_Index) const { return m_Flags[p_Index] & c_HeroDisguiseFlag; }
+
+    /**
+     * Get the AmmoConfig property of an entry. The pair lives in the repository resource. Use
+     * IModSDK::SetRepositoryAmmoConfig to change it.
+     * @return The key / value pair, or nullptr if the entry has no AmmoConfig.
+     */
+    const SDynamicObjectKeyValuePair* GetAmmoConfig(const uint32_t p_Index) const { return m_AmmoConfigs[p_Index]; }
+
+    /**
+     * Entries with an ItemType, sorted by display name (case-insensitive).
+     */
+    std::span<const uint32_t> GetItems() const { return m_Items; }
+
+    /**
+     * Items with a PrimaryConfiguration, sorted by display name (case-insensitive).
+     */
+    std::span<const uint32_t> GetWeapons() const { return m_Weapons; }
+
+    /**
+     * Entries with an IsHitmanSuit property, sorted by display name (case-insensitive).
+     */
+    std::span<const uint32_t> GetOutfits() const { return m_Outfits; }
+
+    std::span<const std::string> GetCategoryNames() const { return m_CategoryNames; }
+
+    /**
+     * Items of a category, sorted by display name (case-insensitive).
+     */
+    std::span<const uint32_t> GetCategoryItems(const uint16_t p_CategoryId) const {
+        return m_CategoryItems[p_CategoryId];
+    }
+
+private:
+    static constexpr uint8_t c_ItemFlag = 1 << 0;
+    static constexpr uint8_t c_WeaponFlag = 1 << 1;
+    static constexpr uint8_t c_OutfitFlag = 1 << 2;
+    static constexpr uint8_t c_HitmanSuitFlag = 1 << 3;
+    static constexpr uint8_t c_HeroDisguiseFlag = 1 << 4;
+
+    uint16_t InternCategory(std::string_view p_InventoryCategoryIcon);
+
+    // Changes to the repository go through the SDK, which makes sure they happen on the main thread.
+    friend class ModSDK;
+
+private:
+    bool m_IsLoaded = false;
+
+    std::vector<ZRepositoryID> m_Ids;
+    std::vector<ZString> m_Titles;
+    std::vector<ZString> m_CommonNames;
+    std::vector<ZString> m_Names;
+    std::vector<std::string> m_DisplayNames;
+    std::vector<uint16_t> m_CategoryIds;
+    std::vector<uint8_t> m_Flags;
+    std::vector<SDynamicObjectKeyValuePair*> m_AmmoConfigs;
+
+    std::unordered_map<ZRepositoryID, uint32_t> m_IdToIndex;
+
+    std::vector<uint32_t> m_Items;
+    std::vector<uint32_t> m_Weapons;
+    std::vector<uint32_t> m_Outfits;
+
+    std::vector<std::string> m_CategoryNames;
+    std::vector<std::vector<uint32_t>> m_CategoryItems;
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include <simdjson.h>
+
+namespace Util {
+    class JsonUtils {
+    public:
+        /**
+         * Copy JSON into a buffer with the padding simdjson needs after it, so it can be parsed without allocating
+         * a padded_string. The buffer only grows, so reusing it for every document avoids reallocating it.
+         * @param p_Json The JSON to copy.
+         * @param p_Buffer The buffer to copy it into. The returned view points into it.
+         */
+        static simdjson::padded_string_view PadJson(const std::string_view p_Json, std::vector<char>& p_Buffer) {
+            if (p_Buffer.size() < p_Json.size() + simdjson::SIMDJSON_PADDING) {
+                p_Buffer.resize(p_Json.size() + simdjson::SIMDJSON_PADDING);
+            }
+
+            std::memcpy(p_Buffer.data(), p_Json.data(), p_Json.size());
+
+            return simdjson::padded_string_view(p_Buffer.data(), p_Json.size(), p_Buffer.size());
+        }
+    };
+}
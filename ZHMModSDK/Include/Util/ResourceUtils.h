@@ -44,5 +44,37 @@ namespace Util {
 
             return s_Value;
         }
+
+        /**
+         * Attempts to extract the patch level from a resource package path
+         * (e.g. for "../runtime//chunk3patch3.rpkg" it would return 3, and for "../runtime//chunk3.rpkg" 0).
+         *
+         * @param s_ResourcePackagePath Resource package path.
+         * @return Patch level if the path is a chunk package, std::nullopt otherwise.
+         */
+        static std::optional<uint32_t> TryParsePatchLevelFromResourcePackagePath(
+            const ZString& s_ResourcePackagePath
+        ) {
+            if (!TryParseChunkIndexFromResourcePackagePath(s_ResourcePackagePath)) {
+                return std::nullopt;
+            }
+
+            const std::string_view s_Path(s_ResourcePackagePath.c_str(), s_ResourcePackagePath.size());
+            size_t s_Position = s_Path.rfind("patch");
+
+            if (s_Position == std::string_view::npos) {
+                return 0;
+            }
+
+            s_Position += 5;
+            uint32_t s_Value = 0;
+
+            while (s_Position < s_Path.size() && std::isdigit(static_cast<unsigned char>(s_Path[s_Position]))) {
+                s_Value = s_Value * 10 + (s_Path[s_Position] - '0');
+                ++s_Position;
+            }
+
+            return s_Value;
+        }
     };
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+//! Times building the resource chunk map over a directory of generated rpkg files, once on a single
+//! thread and once on the default rayon pool.
+//!
+//! Run with `cargo bench --bench resource_chunk_map`.
+
+use std::fs;
+use std::path::Path;
+use std::time::Instant;
+
+use rpkg_rs::resource::package_builder::{PackageBuilder, PackageResourceBuilder, PackageVersion};
+use rpkg_rs::resource::resource_package::ChunkType;
+use rpkg_rs::resource::runtime_resource_id::RuntimeResourceID;
+use zhmmodsdk_rs::build_resource_chunk_map;
+
+const CHUNK_COUNT: u64 = 32;
+const RESOURCES_PER_CHUNK: u64 = 20_000;
+const ITERATIONS: u32 = 5;
+
+/// Writes `chunkN.rpkg` files and a plain text package definition that lists them.
+fn generate_runtime_directory(runtime_path: &Path) {
+    fs::create_dir_all(runtime_path).expect("Failed to create the runtime directory");
+
+    let mut package_definition = String::new();
+
+    for chunk in 0..CHUNK_COUNT {
+        package_definition.push_str(&format!(
+            "@partition name=chunk{} parent=none type=standard patchlevel=0\n",
+            chunk
+        ));
+
+        let mut builder = PackageBuilder::new(chunk as u8, ChunkType::Standard);
+
+        for i in 0..RESOURCES_PER_CHUNK {
+            // Every fourth resource repeats one of the previous chunk, like resources shared between chunks.
+            let index = if i % 4 == 0 && chunk > 0 {
+                (chunk - 1) * RESOURCES_PER_CHUNK + i
+            } else {
+                chunk * RESOURCES_PER_CHUNK + i
+            };
+
+            let rid = RuntimeResourceID::from(index.wrapping_mul(0x9E37_79B9_7F4A_7C15) >> 8);
+            let resource = PackageResourceBuilder::from_memory(
+                rid,
+                "TEMP",
+                index.to_le_bytes().to_vec(),
+                None,
+                false,
+            )
+            .expect("Failed to build resource");
+
+            builder.with_resource(resource);
+        }
+
+        builder
+            .build(
+                PackageVersion::RPKGv2,
+                &runtime_path.join(format!("chunk{}.rpkg", chunk)),
+            )
+            .expect("Failed to write package");
+    }
+
+    fs::write(
+        runtime_path.join("packagedefinition.txt"),
+        package_definition,
+    )
+    .expect("Failed to write the package definition");
+}
+
+fn measure(runtime_path: &Path, thread_count: usize) -> f64 {
+    let pool = rayon::ThreadPoolBuilder::new()
+        .num_threads(thread_count)
+        .build()
+        .expect("Failed to build thread pool");
+
+    let start = Instant::now();
+
+    for _ in 0..ITERATIONS {
+        let entries = pool
+            .install(|| {
+                build_resource_chunk_map(runtime_path, &runtime_path.join("packagedefinition.txt"))
+            })
+            .expect("Failed to build the resource chunk map");
+
+        assert!(entries.windows(2).all(|pair| pair[0].rid <= pair[1].rid));
+    }
+
+    start.elapsed().as_secs_f64() * 1000.0 / ITERATIONS as f64
+}
+
+fn main() {
+    let runtime_path =
+        std::env::temp_dir().join(format!("zhmmodsdk_chunk_map_bench_{}", std::process::id()));
+
+    generate_runtime_directory(&runtime_path);
+
+    let thread_count = rayon::current_num_threads();
+
+    println!(
+        "{} chunks with {} resources each",
+        CHUNK_COUNT, RESOURCES_PER_CHUNK
+    );
+    println!("1 thread: {:.3} ms", measure(&runtime_path, 1));
+    println!(
+        "{} threads: {:.3} ms",
+        thread_count,
+        measure(&runtime_path, thread_count)
+    );
+
+    let _ = fs::remove_dir_all(&runtime_path);
+}
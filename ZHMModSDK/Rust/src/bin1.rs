@@ -0,0 +1,659 @@
+//! Writes the BIN1 resources of converted entities directly, instead of serializing them to JSON text that
+//! ResourceLib then has to parse again.
+//!
+//! The factory (TEMP) and blueprint (TBLU) are read from the `serde_json::Value` of their RT structs, which has the
+//! same shape as the JSON ResourceLib reads. The struct layouts match the ones in Glacier/EntityFactory.h.
+//! Only the property types in `ValueLayout` are supported. For anything else the writers return `None`, and the
+//! resource has to be generated by ResourceLib instead.
+
+use std::collections::HashMap;
+
+use serde_json::Value;
+
+const SEGMENT_RELOCATIONS: u32 = 0x12EBA5ED;
+const SEGMENT_TYPE_IDS: u32 = 0x3989BF9F;
+
+/// Set on the length of strings that point into resource data, so the engine never frees them.
+const STATIC_STRING_FLAG: u32 = 0x4000_0000;
+
+const ZSTRING_SIZE: usize = 0x10;
+const TARRAY_SIZE: usize = 0x18;
+const ENTITY_REFERENCE_SIZE: usize = 0x20;
+const PROPERTY_SIZE: usize = 0x18;
+const PIN_CONNECTION_SIZE: usize = 0x38;
+const EXTERNAL_PIN_CONNECTION_SIZE: usize = 0x70;
+
+/// The types property values can have, and how they're laid out.
+enum ValueLayout {
+    Bool,
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Int64,
+    UInt64,
+    Float32,
+    Float64,
+    String,
+    Vector2,
+    Vector3,
+    Matrix43,
+    EntityReference,
+    Array(Box<ValueLayout>),
+}
+
+impl ValueLayout {
+    fn from_type_name(type_name: &str) -> Option<Self> {
+        Some(match type_name {
+            "bool" => Self::Bool,
+            "int8" => Self::Int8,
+            "uint8" => Self::UInt8,
+            "int16" => Self::Int16,
+            "uint16" => Self::UInt16,
+            "int32" => Self::Int32,
+            "uint32" => Self::UInt32,
+            "int64" => Self::Int64,
+            "uint64" => Self::UInt64,
+            "float32" => Self::Float32,
+            "float64" => Self::Float64,
+            "ZString" => Self::String,
+            "SVector2" => Self::Vector2,
+            "SVector3" => Self::Vector3,
+            "SMatrix43" => Self::Matrix43,
+            "SEntityTemplateReference" => Self::EntityReference,
+            _ => {
+                let element_type_name = type_name.strip_prefix("TArray<")?.strip_suffix('>')?;
+                Self::Array(Box::new(Self::from_type_name(element_type_name)?))
+            }
+        })
+    }
+
+    fn size(&self) -> usize {
+        match self {
+            Self::Bool | Self::Int8 | Self::UInt8 => 1,
+            Self::Int16 | Self::UInt16 => 2,
+            Self::Int32 | Self::UInt32 | Self::Float32 => 4,
+            Self::Int64 | Self::UInt64 | Self::Float64 => 8,
+            Self::String => ZSTRING_SIZE,
+            Self::Vector2 => 8,
+            Self::Vector3 => 12,
+            Self::Matrix43 => 48,
+            Self::EntityReference => ENTITY_REFERENCE_SIZE,
+            Self::Array(_) => TARRAY_SIZE,
+        }
+    }
+
+    fn alignment(&self) -> usize {
+        match self {
+            Self::Vector2 | Self::Vector3 | Self::Matrix43 => 4,
+            Self::String | Self::EntityReference | Self::Array(_) => 8,
+            _ => self.size(),
+        }
+    }
+}
+
+fn as_i32(value: &Value) -> Option<i32> {
+    value.as_i64()?.try_into().ok()
+}
+
+fn as_f32(value: &Value) -> Option<f32> {
+    Some(value.as_f64()? as f32)
+}
+
+fn as_array(value: &Value) -> Option<&[Value]> {
+    value.as_array().map(Vec::as_slice)
+}
+
+/// Reads a `TPair`, which is either a `[key, value]` array or a `{ "key", "value" }` object.
+fn as_pair(value: &Value) -> Option<(&Value, &Value)> {
+    match value {
+        Value::Array(pair) if pair.len() == 2 => Some((&pair[0], &pair[1])),
+        Value::Object(pair) => Some((pair.get("key")?, pair.get("value")?)),
+        _ => None,
+    }
+}
+
+/// Standard CRC-32, which the engine uses for property IDs.
+fn crc32(data: &[u8]) -> u32 {
+    let mut hash = 0xFFFF_FFFFu32;
+
+    for &byte in data {
+        hash ^= byte as u32;
+
+        for _ in 0..8 {
+            hash = if hash & 1 != 0 {
+                (hash >> 1) ^ 0xEDB8_8320
+            } else {
+                hash >> 1
+            };
+        }
+    }
+
+    !hash
+}
+
+/// Property IDs are either the ID itself or the name of the property.
+fn as_property_id(value: &Value) -> Option<u32> {
+    match value {
+        Value::String(name) => Some(crc32(name.as_bytes())),
+        _ => value.as_u64()?.try_into().ok(),
+    }
+}
+
+/// Converts a QN transform (position, rotation in degrees and scale) to the rows of an SMatrix43.
+/// This is the same conversion as Editor::QneTransformToMatrix.
+fn transform_to_matrix(value: &Value) -> Option<[f32; 12]> {
+    let vector = |value: &Value| -> Option<[f64; 3]> {
+        Some([
+            value.get("x")?.as_f64()?,
+            value.get("y")?.as_f64()?,
+            value.get("z")?.as_f64()?,
+        ])
+    };
+
+    let rotation = vector(value.get("rotation")?)?;
+    let position = vector(value.get("position")?)?;
+    let scale = match value.get("scale") {
+        Some(scale) => vector(scale)?,
+        None => [1.0, 1.0, 1.0],
+    };
+
+    let [x, y, z] = rotation.map(f64::to_radians);
+
+    let (c1, c2, c3) = ((x / 2.0).cos(), (y / 2.0).cos(), (z / 2.0).cos());
+    let (s1, s2, s3) = ((x / 2.0).sin(), (y / 2.0).sin(), (z / 2.0).sin());
+
+    let quat_x = s1 * c2 * c3 + c1 * s2 * s3;
+    let quat_y = c1 * s2 * c3 - s1 * c2 * s3;
+    let quat_z = c1 * c2 * s3 + s1 * s2 * c3;
+    let quat_w = c1 * c2 * c3 - s1 * s2 * s3;
+
+    let (x2, y2, z2) = (quat_x + quat_x, quat_y + quat_y, quat_z + quat_z);
+    let (xx, xy, xz) = (quat_x * x2, quat_x * y2, quat_x * z2);
+    let (yy, yz, zz) = (quat_y * y2, quat_y * z2, quat_z * z2);
+    let (wx, wy, wz) = (quat_w * x2, quat_w * y2, quat_w * z2);
+
+    let matrix = [
+        (1.0 - (yy + zz)) * scale[0],
+        (xy - wz) * scale[1],
+        (xz + wy) * scale[2],
+        (xy + wz) * scale[0],
+        (1.0 - (xx + zz)) * scale[1],
+        (yz - wx) * scale[2],
+        (xz - wy) * scale[0],
+        (yz + wx) * scale[1],
+        (1.0 - (xx + yy)) * scale[2],
+        position[0],
+        position[1],
+        position[2],
+    ];
+
+    Some(matrix.map(|component| component as f32))
+}
+
+/// Builds the data of a BIN1 resource, along with the pointers and type IDs the engine patches when loading it.
+/// Pointers are stored as offsets into the data.
+struct Writer {
+    data: Vec<u8>,
+    relocations: Vec<u32>,
+    type_id_offsets: Vec<u32>,
+    type_names: Vec<String>,
+    type_indices: HashMap<String, u32>,
+}
+
+impl Writer {
+    fn new() -> Self {
+        Self {
+            data: Vec::with_capacity(64 * 1024),
+            relocations: Vec::new(),
+            type_id_offsets: Vec::new(),
+            type_names: Vec::new(),
+            type_indices: HashMap::new(),
+        }
+    }
+
+    /// Reserves zeroed space at the end of the data and returns its offset.
+    fn alloc(&mut self, size: usize, alignment: usize) -> usize {
+        let offset = self.data.len().next_multiple_of(alignment);
+        self.data.resize(offset + size, 0);
+        offset
+    }
+
+    fn put_bytes(&mut self, offset: usize, bytes: &[u8]) {
+        self.data[offset..offset + bytes.len()].copy_from_slice(bytes);
+    }
+
+    fn put_u32(&mut self, offset: usize, value: u32) {
+        self.put_bytes(offset, &value.to_le_bytes());
+    }
+
+    fn put_i32(&mut self, offset: usize, value: i32) {
+        self.put_bytes(offset, &value.to_le_bytes());
+    }
+
+    fn put_u64(&mut self, offset: usize, value: u64) {
+        self.put_bytes(offset, &value.to_le_bytes());
+    }
+
+    fn put_f32s(&mut self, offset: usize, values: &[f32]) {
+        for (i, value) in values.iter().enumerate() {
+            self.put_bytes(offset + i * 4, &value.to_le_bytes());
+        }
+    }
+
+    fn put_pointer(&mut self, offset: usize, target: usize) {
+        self.put_u64(offset, target as u64);
+        self.relocations.push(offset as u32);
+    }
+
+    fn put_type(&mut self, offset: usize, type_name: &str) {
+        let type_index = match self.type_indices.get(type_name) {
+            Some(&index) => index,
+            None => {
+                let index = self.type_names.len() as u32;
+                self.type_names.push(type_name.to_owned());
+                self.type_indices.insert(type_name.to_owned(), index);
+                index
+            }
+        };
+
+        self.put_u64(offset, type_index as u64);
+        self.type_id_offsets.push(offset as u32);
+    }
+
+    /// Writes a ZString. The characters are stored with their length in front and a terminator after them.
+    fn put_string(&mut self, offset: usize, value: &str) {
+        let start = self.alloc(4 + value.len() + 1, 4);
+
+        self.put_u32(start, value.len() as u32);
+        self.put_bytes(start + 4, value.as_bytes());
+
+        self.put_u32(offset, value.len() as u32 | STATIC_STRING_FLAG);
+        self.put_pointer(offset + 8, start + 4);
+    }
+
+    /// Writes a TArray of `count` elements and returns the offset of the first one.
+    /// The elements have their count in front, like strings. Empty arrays have null pointers.
+    fn put_array(
+        &mut self,
+        offset: usize,
+        count: usize,
+        element_size: usize,
+        element_alignment: usize,
+    ) -> usize {
+        if count == 0 {
+            return 0;
+        }
+
+        let start = (self.data.len() + 4).next_multiple_of(element_alignment.max(4));
+        let end = start + count * element_size;
+
+        self.data.resize(end, 0);
+        self.put_u32(start - 4, count as u32);
+
+        self.put_pointer(offset, start);
+        self.put_pointer(offset + 8, end);
+        self.put_pointer(offset + 16, end);
+
+        start
+    }
+
+    /// Writes an array of JSON values, calling `put_element` with the offset of each element.
+    fn put_array_of(
+        &mut self,
+        offset: usize,
+        values: &Value,
+        element_size: usize,
+        element_alignment: usize,
+        mut put_element: impl FnMut(&mut Self, usize, &Value) -> Option<()>,
+    ) -> Option<()> {
+        let values = as_array(values)?;
+        let start = self.put_array(offset, values.len(), element_size, element_alignment);
+
+        for (i, value) in values.iter().enumerate() {
+            put_element(self, start + i * element_size, value)?;
+        }
+
+        Some(())
+    }
+
+    fn put_i32_array(&mut self, offset: usize, values: &Value) -> Option<()> {
+        self.put_array_of(offset, values, 4, 4, |writer, offset, value| {
+            writer.put_i32(offset, as_i32(value)?);
+            Some(())
+        })
+    }
+
+    fn put_value(&mut self, offset: usize, layout: &ValueLayout, value: &Value) -> Option<()> {
+        match layout {
+            ValueLayout::Bool => self.put_bytes(offset, &[value.as_bool()? as u8]),
+            ValueLayout::Int8 => {
+                self.put_bytes(offset, &i8::try_from(value.as_i64()?).ok()?.to_le_bytes())
+            }
+            ValueLayout::UInt8 => {
+                self.put_bytes(offset, &u8::try_from(value.as_u64()?).ok()?.to_le_bytes())
+            }
+            ValueLayout::Int16 => {
+                self.put_bytes(offset, &i16::try_from(value.as_i64()?).ok()?.to_le_bytes())
+            }
+            ValueLayout::UInt16 => {
+                self.put_bytes(offset, &u16::try_from(value.as_u64()?).ok()?.to_le_bytes())
+            }
+            ValueLayout::Int32 => self.put_i32(offset, as_i32(value)?),
+            ValueLayout::UInt32 => self.put_u32(offset, value.as_u64()?.try_into().ok()?),
+            ValueLayout::Int64 => self.put_bytes(offset, &value.as_i64()?.to_le_bytes()),
+            ValueLayout::UInt64 => self.put_u64(offset, value.as_u64()?),
+            ValueLayout::Float32 => self.put_f32s(offset, &[as_f32(value)?]),
+            ValueLayout::Float64 => self.put_bytes(offset, &value.as_f64()?.to_le_bytes()),
+            ValueLayout::String => self.put_string(offset, value.as_str()?),
+            ValueLayout::Vector2 => self.put_f32s(
+                offset,
+                &[as_f32(value.get("x")?)?, as_f32(value.get("y")?)?],
+            ),
+            ValueLayout::Vector3 => self.put_f32s(
+                offset,
+                &[
+                    as_f32(value.get("x")?)?,
+                    as_f32(value.get("y")?)?,
+                    as_f32(value.get("z")?)?,
+                ],
+            ),
+            ValueLayout::Matrix43 => self.put_f32s(offset, &transform_to_matrix(value)?),
+            ValueLayout::EntityReference => self.put_entity_reference(offset, value)?,
+            ValueLayout::Array(element) => self.put_array_of(
+                offset,
+                value,
+                element.size(),
+                element.alignment(),
+                |writer, offset, value| writer.put_value(offset, element, value),
+            )?,
+        }
+
+        Some(())
+    }
+
+    /// Writes a ZObjectRef. The value is stored separately, and the reference points to it.
+    fn put_object(&mut self, offset: usize, value: &Value) -> Option<()> {
+        let type_name = value.get("$type")?.as_str()?;
+
+        if type_name == "void" {
+            self.put_type(offset, type_name);
+            return Some(());
+        }
+
+        let layout = ValueLayout::from_type_name(type_name)?;
+        let data = self.alloc(layout.size(), layout.alignment());
+
+        self.put_value(data, &layout, value.get("$val")?)?;
+        self.put_type(offset, type_name);
+        self.put_pointer(offset + 8, data);
+
+        Some(())
+    }
+
+    fn put_entity_reference(&mut self, offset: usize, value: &Value) -> Option<()> {
+        self.put_u64(offset, value.get("entityID")?.as_u64()?);
+        self.put_i32(offset + 0x8, as_i32(value.get("externalSceneIndex")?)?);
+        self.put_i32(offset + 0xC, as_i32(value.get("entityIndex")?)?);
+        self.put_string(offset + 0x10, value.get("exposedEntity")?.as_str()?);
+        Some(())
+    }
+
+    fn put_entity_references(&mut self, offset: usize, values: &Value) -> Option<()> {
+        self.put_array_of(
+            offset,
+            values,
+            ENTITY_REFERENCE_SIZE,
+            8,
+            Self::put_entity_reference,
+        )
+    }
+
+    fn put_property(&mut self, offset: usize, value: &Value) -> Option<()> {
+        self.put_u32(offset, as_property_id(value.get("nPropertyID")?)?);
+        self.put_object(offset + 0x8, value.get("value")?)
+    }
+
+    fn put_properties(&mut self, offset: usize, values: &Value) -> Option<()> {
+        self.put_array_of(offset, values, PROPERTY_SIZE, 8, Self::put_property)
+    }
+
+    fn put_pin_connections(&mut self, offset: usize, values: &Value) -> Option<()> {
+        self.put_array_of(
+            offset,
+            values,
+            PIN_CONNECTION_SIZE,
+            8,
+            |writer, offset, value| {
+                writer.put_i32(offset, as_i32(value.get("fromID")?)?);
+                writer.put_i32(offset + 0x4, as_i32(value.get("toID")?)?);
+                writer.put_string(offset + 0x8, value.get("fromPinName")?.as_str()?);
+                writer.put_string(offset + 0x18, value.get("toPinName")?.as_str()?);
+                writer.put_object(offset + 0x28, value.get("constantPinValue")?)
+            },
+        )
+    }
+
+    fn put_external_pin_connections(&mut self, offset: usize, values: &Value) -> Option<()> {
+        self.put_array_of(
+            offset,
+            values,
+            EXTERNAL_PIN_CONNECTION_SIZE,
+            8,
+            |writer, offset, value| {
+                writer.put_entity_reference(offset, value.get("fromEntity")?)?;
+                writer.put_entity_reference(offset + 0x20, value.get("toEntity")?)?;
+                writer.put_string(offset + 0x40, value.get("fromPinName")?.as_str()?);
+                writer.put_string(offset + 0x50, value.get("toPinName")?.as_str()?);
+                writer.put_object(offset + 0x60, value.get("constantPinValue")?)
+            },
+        )
+    }
+
+    /// Lays out the resource: the header, the data, and the relocation and type ID segments.
+    fn finish(self, alignment: u8) -> Vec<u8> {
+        // The data is padded so the segments after it stay 4 byte aligned.
+        let data_size = self.data.len().next_multiple_of(4);
+        let segment_count =
+            (!self.relocations.is_empty()) as u8 + (!self.type_id_offsets.is_empty()) as u8;
+
+        let mut resource = Vec::with_capacity(16 + data_size + 16 + self.relocations.len() * 4);
+
+        resource.extend_from_slice(b"BIN1");
+        resource.extend_from_slice(&[0, alignment, 1, segment_count]);
+        resource.extend_from_slice(&(data_size as u32).to_be_bytes());
+        resource.extend_from_slice(&0u32.to_le_bytes());
+        resource.extend_from_slice(&self.data);
+        resource.resize(16 + data_size, 0);
+
+        let write_segment = |resource: &mut Vec<u8>, segment_type: u32, payload: &[u8]| {
+            resource.extend_from_slice(&segment_type.to_le_bytes());
+            resource.extend_from_slice(&(payload.len() as u32).to_le_bytes());
+            resource.extend_from_slice(payload);
+        };
+
+        if !self.relocations.is_empty() {
+            let mut payload = Vec::with_capacity(4 + self.relocations.len() * 4);
+            payload.extend_from_slice(&(self.relocations.len() as u32).to_le_bytes());
+
+            for offset in &self.relocations {
+                payload.extend_from_slice(&offset.to_le_bytes());
+            }
+
+            write_segment(&mut resource, SEGMENT_RELOCATIONS, &payload);
+        }
+
+        if !self.type_id_offsets.is_empty() {
+            let mut payload = Vec::new();
+            payload.extend_from_slice(&(self.type_id_offsets.len() as u32).to_le_bytes());
+
+            for offset in &self.type_id_offsets {
+                payload.extend_from_slice(&offset.to_le_bytes());
+            }
+
+            payload.extend_from_slice(&(self.type_names.len() as u32).to_le_bytes());
+
+            for (index, type_name) in self.type_names.iter().enumerate() {
+                payload.resize(payload.len().next_multiple_of(4), 0);
+                payload.extend_from_slice(&(index as u32).to_le_bytes());
+                payload.extend_from_slice(&(-1i32).to_le_bytes());
+                payload.extend_from_slice(&(type_name.len() as u32 + 1).to_le_bytes());
+                payload.extend_from_slice(type_name.as_bytes());
+                payload.push(0);
+            }
+
+            write_segment(&mut resource, SEGMENT_TYPE_IDS, &payload);
+        }
+
+        resource
+    }
+}
+
+/// Writes the TEMP resource of an STemplateEntityFactory.
+pub fn write_factory(factory: &Value) -> Option<Vec<u8>> {
+    let mut writer = Writer::new();
+    let root = writer.alloc(0x58, 8);
+
+    writer.put_i32(root, as_i32(factory.get("subType")?)?);
+    writer.put_i32(
+        root + 0x4,
+        as_i32(factory.get("blueprintIndexInResourceHeader")?)?,
+    );
+    writer.put_i32(root + 0x8, as_i32(factory.get("rootEntityIndex")?)?);
+
+    writer.put_array_of(
+        root + 0x10,
+        factory.get("subEntities")?,
+        0x70,
+        8,
+        |writer, offset, sub_entity| {
+            // Platform specific values have an enum in them, which needs ResourceLib's type information.
+            if !as_array(sub_entity.get("platformSpecificPropertyValues")?)?.is_empty() {
+                return None;
+            }
+
+            writer.put_entity_reference(offset, sub_entity.get("logicalParent")?)?;
+            writer.put_i32(
+                offset + 0x20,
+                as_i32(sub_entity.get("entityTypeResourceIndex")?)?,
+            );
+            writer.put_properties(offset + 0x28, sub_entity.get("propertyValues")?)?;
+            writer.put_properties(offset + 0x40, sub_entity.get("postInitPropertyValues")?)
+        },
+    )?;
+
+    writer.put_array_of(
+        root + 0x28,
+        factory.get("propertyOverrides")?,
+        0x38,
+        8,
+        |writer, offset, value| {
+            writer.put_entity_reference(offset, value.get("propertyOwner")?)?;
+            writer.put_property(offset + 0x20, value.get("propertyValue")?)
+        },
+    )?;
+
+    writer.put_i32_array(
+        root + 0x40,
+        factory.get("externalSceneTypeIndicesInResourceHeader")?,
+    )?;
+
+    Some(writer.finish(8))
+}
+
+/// Writes the TBLU resource of an STemplateEntityBlueprint.
+pub fn write_blueprint(blueprint: &Value) -> Option<Vec<u8>> {
+    let mut writer = Writer::new();
+    let root = writer.alloc(0xC8, 8);
+
+    writer.put_i32(root, as_i32(blueprint.get("subType")?)?);
+    writer.put_i32(root + 0x4, as_i32(blueprint.get("rootEntityIndex")?)?);
+
+    writer.put_array_of(
+        root + 0x8,
+        blueprint.get("subEntities")?,
+        0xA8,
+        8,
+        |writer, offset, sub_entity| {
+            writer.put_entity_reference(offset, sub_entity.get("logicalParent")?)?;
+            writer.put_i32(
+                offset + 0x20,
+                as_i32(sub_entity.get("entityTypeResourceIndex")?)?,
+            );
+            writer.put_u64(offset + 0x28, sub_entity.get("entityId")?.as_u64()?);
+            writer.put_bytes(
+                offset + 0x30,
+                &[sub_entity.get("editorOnly")?.as_bool()? as u8],
+            );
+            writer.put_string(offset + 0x38, sub_entity.get("entityName")?.as_str()?);
+
+            writer.put_array_of(
+                offset + 0x48,
+                sub_entity.get("propertyAliases")?,
+                0x28,
+                8,
+                |writer, offset, value| {
+                    writer.put_string(offset, value.get("sAliasName")?.as_str()?);
+                    writer.put_i32(offset + 0x10, as_i32(value.get("entityID")?)?);
+                    writer.put_string(offset + 0x18, value.get("sPropertyName")?.as_str()?);
+                    Some(())
+                },
+            )?;
+
+            writer.put_array_of(
+                offset + 0x60,
+                sub_entity.get("exposedEntities")?,
+                0x30,
+                8,
+                |writer, offset, value| {
+                    writer.put_string(offset, value.get("sName")?.as_str()?);
+                    writer.put_bytes(offset + 0x10, &[value.get("bIsArray")?.as_bool()? as u8]);
+                    writer.put_entity_references(offset + 0x18, value.get("aTargets")?)
+                },
+            )?;
+
+            writer.put_array_of(
+                offset + 0x78,
+                sub_entity.get("exposedInterfaces")?,
+                0x18,
+                8,
+                |writer, offset, value| {
+                    let (name, index) = as_pair(value)?;
+                    writer.put_string(offset, name.as_str()?);
+                    writer.put_i32(offset + 0x10, as_i32(index)?);
+                    Some(())
+                },
+            )?;
+
+            writer.put_array_of(
+                offset + 0x90,
+                sub_entity.get("entitySubsets")?,
+                0x28,
+                8,
+                |writer, offset, value| {
+                    let (name, subset) = as_pair(value)?;
+                    writer.put_string(offset, name.as_str()?);
+                    writer.put_i32_array(offset + 0x10, subset.get("entities")?)
+                },
+            )
+        },
+    )?;
+
+    writer.put_i32_array(
+        root + 0x20,
+        blueprint.get("externalSceneTypeIndicesInResourceHeader")?,
+    )?;
+    writer.put_pin_connections(root + 0x38, blueprint.get("pinConnections")?)?;
+    writer.put_pin_connections(root + 0x50, blueprint.get("inputPinForwardings")?)?;
+    writer.put_pin_connections(root + 0x68, blueprint.get("outputPinForwardings")?)?;
+    writer.put_entity_references(root + 0x80, blueprint.get("overrideDeletes")?)?;
+    writer.put_external_pin_connections(root + 0x98, blueprint.get("pinConnectionOverrides")?)?;
+    writer.put_external_pin_connections(
+        root + 0xB0,
+        blueprint.get("pinConnectionOverrideDeletes")?,
+    )?;
+
+    Some(writer.finish(8))
+}
@@ -1,21 +1,45 @@
+mod bin1;
+
+use std::path::{Path, PathBuf};
+
 use ::safer_ffi::prelude::*;
 use quickentity_rs::convert_to_rt;
 use quickentity_rs::qn_structs::Entity;
+use quickentity_rs::rt_structs::ResourceMeta;
+use rayon::prelude::*;
 use rpkg_rs::WoaVersion;
-use rpkg_rs::resource::partition_manager::PartitionManager;
+use rpkg_rs::resource::pdefs::{GamePaths, PackageDefinitionSource};
+use rpkg_rs::resource::resource_partition::ResourcePartition;
 
-fn read_as_entity(json_data: &[u8]) -> Entity {
-    serde_path_to_error::deserialize(&mut serde_json::Deserializer::from_slice(json_data))
-        .expect("Failed to parse file")
+fn read_as_entity(json_data: &[u8]) -> Option<Entity> {
+    serde_path_to_error::deserialize(&mut serde_json::Deserializer::from_slice(json_data)).ok()
+}
+
+#[derive_ReprC]
+#[repr(C)]
+pub struct QnResourceReference {
+    pub hash: char_p::Box,
+    pub flags: u8,
+}
+
+#[derive_ReprC]
+#[repr(C)]
+pub struct QnResourceMeta {
+    pub hash: char_p::Box,
+    pub references: repr_c::Vec<QnResourceReference>,
 }
 
+/// The factory and blueprint are either BIN1 resources, or RT JSON that ResourceLib has to generate them from if
+/// they contain property types `bin1` can't write. The JSON is empty when the BIN1 resource is set and vice versa.
 #[derive_ReprC]
 #[repr(C)]
 pub struct QnConvertedData {
     pub factory_json: char_p::Box,
-    pub factory_meta_json: char_p::Box,
+    pub factory_bin1: repr_c::Vec<u8>,
+    pub factory_meta: QnResourceMeta,
     pub blueprint_json: char_p::Box,
-    pub blueprint_meta_json: char_p::Box,
+    pub blueprint_bin1: repr_c::Vec<u8>,
+    pub blueprint_meta: QnResourceMeta,
 }
 
 #[derive_ReprC]
@@ -31,66 +55,162 @@ pub struct ResourceChunkMap {
     pub entries: repr_c::Vec<ResourceChunkEntry>,
 }
 
-#[ffi_export]
-pub fn convert_qn_entity(qn_json: char_p::Ref<'_>) -> Option<repr_c::Box<QnConvertedData>> {
+/// A generated factory or blueprint.
+enum ConvertedResource {
+    Bin1(Vec<u8>),
+    Json(String),
+}
+
+impl ConvertedResource {
+    /// Writes the BIN1 resource directly if possible, and falls back to JSON for ResourceLib otherwise.
+    fn new<T: serde::Serialize>(
+        resource: &T,
+        write_bin1: Option<fn(&serde_json::Value) -> Option<Vec<u8>>>,
+    ) -> Option<Self> {
+        if let Some(write_bin1) = write_bin1 {
+            if let Some(bin1) = write_bin1(&serde_json::to_value(resource).ok()?) {
+                return Some(Self::Bin1(bin1));
+            }
+        }
+
+        Some(Self::Json(serde_json::to_string(resource).ok()?))
+    }
+
+    fn into_parts(self) -> Option<(char_p::Box, repr_c::Vec<u8>)> {
+        Some(match self {
+            Self::Bin1(bin1) => (String::new().try_into().ok()?, bin1.into()),
+            Self::Json(json) => (json.try_into().ok()?, Vec::new().into()),
+        })
+    }
+}
+
+/// A converted QN entity before it's moved into its C representation.
+struct ConvertedEntity {
+    factory: ConvertedResource,
+    factory_meta: ResourceMeta,
+    blueprint: ConvertedResource,
+    blueprint_meta: ResourceMeta,
+}
+
+/// Converts a QN entity to RT. Unless `native_bin1` is false, the BIN1 resources are written here directly.
+fn convert_entity(json_data: &[u8], native_bin1: bool) -> Option<ConvertedEntity> {
     // Try to parse the JSON data as a QN entity.
-    let json_data = qn_json.to_bytes();
-    let entity = read_as_entity(json_data);
+    let entity = read_as_entity(json_data)?;
 
     // Convert the QN entity to an RT entity.
     let (factory, factory_meta, blueprint, blueprint_meta) = convert_to_rt(&entity).ok()?;
 
-    // Convert to JSON.
-    let factory_json = serde_json::to_string(&factory).ok()?;
-    let factory_meta_json = serde_json::to_string(&factory_meta).ok()?;
-    let blueprint_json = serde_json::to_string(&blueprint).ok()?;
-    let blueprint_meta_json = serde_json::to_string(&blueprint_meta).ok()?;
+    // The metas are handed over as they are.
+    Some(ConvertedEntity {
+        factory: ConvertedResource::new(&factory, native_bin1.then_some(bin1::write_factory as _))?,
+        factory_meta,
+        blueprint: ConvertedResource::new(
+            &blueprint,
+            native_bin1.then_some(bin1::write_blueprint as _),
+        )?,
+        blueprint_meta,
+    })
+}
 
-    // And then to the C representation.
-    let factory_json_cstr: char_p::Box = factory_json.try_into().ok()?;
-    let factory_meta_json_cstr: char_p::Box = factory_meta_json.try_into().ok()?;
-    let blueprint_json_cstr: char_p::Box = blueprint_json.try_into().ok()?;
-    let blueprint_meta_json_cstr: char_p::Box = blueprint_meta_json.try_into().ok()?;
+fn to_qn_resource_meta(meta: ResourceMeta) -> Option<QnResourceMeta> {
+    let references = meta
+        .hash_reference_data
+        .into_iter()
+        .map(|reference| {
+            Some(QnResourceReference {
+                hash: reference.hash.try_into().ok()?,
+                flags: u8::from_str_radix(&reference.flag, 16).ok()?,
+            })
+        })
+        .collect::<Option<Vec<_>>>()?;
+
+    Some(QnResourceMeta {
+        hash: meta.hash_value.try_into().ok()?,
+        references: references.into(),
+    })
+}
+
+fn to_qn_converted_data(entity: ConvertedEntity) -> Option<repr_c::Box<QnConvertedData>> {
+    let (factory_json, factory_bin1) = entity.factory.into_parts()?;
+    let (blueprint_json, blueprint_bin1) = entity.blueprint.into_parts()?;
 
     Some(
         Box::new(QnConvertedData {
-            factory_json: factory_json_cstr,
-            factory_meta_json: factory_meta_json_cstr,
-            blueprint_json: blueprint_json_cstr,
-            blueprint_meta_json: blueprint_meta_json_cstr,
+            factory_json,
+            factory_bin1,
+            factory_meta: to_qn_resource_meta(entity.factory_meta)?,
+            blueprint_json,
+            blueprint_bin1,
+            blueprint_meta: to_qn_resource_meta(entity.blueprint_meta)?,
         })
         .into(),
     )
 }
 
+#[ffi_export]
+pub fn convert_qn_entity(qn_json: char_p::Ref<'_>) -> Option<repr_c::Box<QnConvertedData>> {
+    to_qn_converted_data(convert_entity(qn_json.to_bytes(), true)?)
+}
+
+/// Converts a QN entity to RT JSON only, leaving all of the BIN1 generation to ResourceLib.
+/// This is how entities used to be loaded, and is only kept to test and benchmark the native BIN1 writer against.
+#[ffi_export]
+pub fn convert_qn_entity_to_json(qn_json: char_p::Ref<'_>) -> Option<repr_c::Box<QnConvertedData>> {
+    to_qn_converted_data(convert_entity(qn_json.to_bytes(), false)?)
+}
+
 #[ffi_export]
 pub fn free_qn_converted_data(data: Option<repr_c::Box<QnConvertedData>>) {
     drop(data);
 }
 
+/// Converts several QN entities at once, spread across all cores.
+/// The result has one element per input, which is null if that entity couldn't be converted.
 #[ffi_export]
-pub fn get_resource_chunk_map(game_path: char_p::Ref<'_>) -> Option<repr_c::Box<ResourceChunkMap>> {
-    let game_path = game_path.to_string();
+pub fn convert_qn_entities(
+    qn_jsons: c_slice::Ref<'_, char_p::Ref<'_>>,
+) -> repr_c::Vec<Option<repr_c::Box<QnConvertedData>>> {
+    let json_data = qn_jsons
+        .as_slice()
+        .iter()
+        .map(|qn_json| qn_json.to_bytes())
+        .collect::<Vec<_>>();
 
-    let mut entries = Vec::new();
+    let entities = json_data
+        .into_par_iter()
+        .map(|json_data| convert_entity(json_data, true))
+        .collect::<Vec<_>>();
 
-    let partition_manager =
-        match PartitionManager::from_game(game_path.into(), WoaVersion::HM3, true) {
-            Ok(x) => x,
-            Err(e) => {
-                println!("Failed to load partition manager: {}", e);
-                return None;
-            }
-        };
-
-    for partition in partition_manager.partitions {
-        for (info, _) in partition.latest_resources() {
-            entries.push(ResourceChunkEntry {
-                rid: (*info.rrid()).into(),
-                chunk_index: partition.partition_info().id.index.try_into().ok()?,
-            });
+    entities
+        .into_iter()
+        .map(|entity| entity.and_then(to_qn_converted_data))
+        .collect::<Vec<_>>()
+        .into()
+}
+
+#[ffi_export]
+pub fn free_qn_converted_data_list(data: repr_c::Vec<Option<repr_c::Box<QnConvertedData>>>) {
+    drop(data);
+}
+
+/// Builds the map of every resource to the chunks that contain it.
+///
+/// The runtime directory and package definition are resolved from thumbs.dat in the retail directory.
+/// The rest of the work happens in `build_resource_chunk_map`.
+#[ffi_export]
+pub fn get_resource_chunk_map(game_path: char_p::Ref<'_>) -> Option<repr_c::Box<ResourceChunkMap>> {
+    let game_paths = match GamePaths::from_retail_directory(PathBuf::from(game_path.to_string())) {
+        Ok(x) => x,
+        Err(e) => {
+            println!("Failed to resolve game paths: {}", e);
+            return None;
         }
-    }
+    };
+
+    let entries = build_resource_chunk_map(
+        &game_paths.runtime_path,
+        &game_paths.package_definition_path,
+    )?;
 
     Some(
         Box::new(ResourceChunkMap {
@@ -100,6 +220,83 @@ pub fn get_resource_chunk_map(game_path: char_p::Ref<'_>) -> Option<repr_c::Box<
     )
 }
 
+/// Builds the map of every resource to the chunks that contain it from a runtime directory.
+///
+/// Only the package definition is read up front. Every partition is then mounted (base package and
+/// patches) and scanned on its own thread. Partitions that can't be mounted are skipped. The entries
+/// are returned sorted by rid; entries with the same rid keep the order of the partitions in the
+/// package definition.
+pub fn build_resource_chunk_map(
+    runtime_path: &Path,
+    package_definition_path: &Path,
+) -> Option<Vec<ResourceChunkEntry>> {
+    let package_definition = match PackageDefinitionSource::from_file(
+        package_definition_path.to_path_buf(),
+        WoaVersion::HM3,
+    ) {
+        Ok(x) => x,
+        Err(e) => {
+            println!("Failed to load package definition: {}", e);
+            return None;
+        }
+    };
+
+    let partition_infos = match package_definition.read() {
+        Ok(x) => x,
+        Err(e) => {
+            println!("Failed to read package definition: {}", e);
+            return None;
+        }
+    };
+
+    let partition_entries = partition_infos
+        .into_par_iter()
+        .filter_map(|partition_info| {
+            let partition_index = partition_info.id.index;
+
+            let chunk_index: u32 = match partition_index.try_into() {
+                Ok(x) => x,
+                Err(e) => {
+                    println!("Skipping partition {}: {}", partition_index, e);
+                    return None;
+                }
+            };
+
+            let mut partition = ResourcePartition::new(partition_info);
+
+            if let Err(e) = partition.mount_resource_packages_in_partition(runtime_path) {
+                println!("Skipping partition {}: {}", partition_index, e);
+                return None;
+            }
+
+            let mut entries = partition
+                .latest_resources()
+                .into_iter()
+                .map(|(info, _)| ResourceChunkEntry {
+                    rid: (*info.rrid()).into(),
+                    chunk_index,
+                })
+                .collect::<Vec<_>>();
+
+            entries.sort_unstable_by_key(|entry| entry.rid);
+
+            Some(entries)
+        })
+        .collect::<Vec<_>>();
+
+    let mut entries = Vec::with_capacity(partition_entries.iter().map(Vec::len).sum());
+
+    for partition in partition_entries {
+        entries.extend(partition);
+    }
+
+    // The per-partition runs are already sorted, and the sort is stable, so this only merges them
+    // while keeping the partition order of duplicate rids.
+    entries.par_sort_by_key(|entry| entry.rid);
+
+    Some(entries)
+}
+
 #[ffi_export]
 pub fn free_resource_chunk_map(map: Option<repr_c::Box<ResourceChunkMap>>) {
     drop(map);
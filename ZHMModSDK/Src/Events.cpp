@@ -4,4 +4,5 @@
 
 std::unordered_set<EventDispatcherBase*>* EventDispatcherRegistry::g_Dispatchers = nullptr;
 
-DEFINE_EVENT(OnConsoleCommand, TArray<ZString>)
\ No newline at end of file
+DEFINE_EVENT(OnConsoleCommand, TArray<ZString>)
+DEFINE_EVENT(OnChunkMountProgress, const SChunkMountProgress&)
\ No newline at end of file
@@ -19,7 +19,7 @@ ZString ZActor::GetActorName() const {
 
         GetID(s_EntityRef);
 
-        ZRepositoryID s_RepoId = s_EntityRef.GetProperty<ZRepositoryID>("RepositoryId").Get();
+        ZRepositoryID s_RepoId = s_EntityRef.GetProperty<ZRepositoryID>(PropertyId<"RepositoryId">).Get();
         auto s_Iterator = s_RepositoryData->find(s_RepoId);
 
         if (s_Iterator != s_RepositoryData->end()) {
@@ -1,7 +1,141 @@
 #include "Glacier/ZEntity.h"
 
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "Functions.h"
 #include "Hooks.h"
+#include "InterfaceCache.h"
+
+namespace {
+    // Scanning a handful of properties is as fast as looking them up, so small types aren't indexed.
+    constexpr size_t c_MinIndexedPropertyCount = 16;
+
+    struct PropertyIndex {
+        const SPropertyData* m_PropertyData;
+        size_t m_PropertyCount;
+
+        // The property ID in the upper and the property index in the lower 32 bits, sorted. If a type has
+        // the same property more than once, the first one comes first, just like with a linear scan.
+        std::vector<uint64_t> m_Keys;
+    };
+
+    using EntityInterfaceCache = InterfaceCache<ZEntityType, STypeID, SInterfaceData>;
+
+    std::shared_mutex g_PropertyIndicesMutex;
+    std::unordered_map<const ZEntityType*, PropertyIndex> g_PropertyIndices;
+
+    SPropertyData* FindPropertyLinear(SPropertyData* p_Properties, const size_t p_Count, const uint32_t p_PropertyId) {
+        for (size_t i = 0; i < p_Count; ++i) {
+            if (p_Properties[i].m_nPropertyID == p_PropertyId) {
+                return &p_Properties[i];
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * Look a property up through an index.
+     * @return The index of the property, or -1 if it isn't in the index.
+     */
+    int64_t FindPropertyIndex(const PropertyIndex& p_Index, const uint32_t p_PropertyId) {
+        const auto s_It = std::ranges::lower_bound(p_Index.m_Keys, static_cast<uint64_t>(p_PropertyId) << 32);
+
+        if (s_It == p_Index.m_Keys.end() || (*s_It >> 32) != p_PropertyId) {
+            return -1;
+        }
+
+        return static_cast<int64_t>(*s_It & UINT32_MAX);
+    }
+}
+
+SPropertyData* ZEntityType::FindProperty(const uint32_t p_PropertyId) const {
+    if (!m_pPropertyData) {
+        return nullptr;
+    }
+
+    SPropertyData* s_Properties = m_pPropertyData->begin();
+    const size_t s_PropertyCount = m_pPropertyData->size();
+
+    if (s_PropertyCount < c_MinIndexedPropertyCount) {
+        return FindPropertyLinear(s_Properties, s_PropertyCount, p_PropertyId);
+    }
+
+    {
+        std::shared_lock s_Lock(g_PropertyIndicesMutex);
+
+        const auto s_It = g_PropertyIndices.find(this);
+
+        // A type whose property array changed since it was indexed is indexed again below.
+        if (s_It != g_PropertyIndices.end() &&
+            s_It->second.m_PropertyData == s_Properties &&
+            s_It->second.m_PropertyCount == s_PropertyCount) {
+            const int64_t s_Index = FindPropertyIndex(s_It->second, p_PropertyId);
+
+            if (s_Index < 0) {
+                return nullptr;
+            }
+
+            // The array can also be changed in place, in which case the property found is a different one.
+            if (s_Properties[s_Index].m_nPropertyID == p_PropertyId) {
+                return &s_Properties[s_Index];
+            }
+        }
+    }
+
+    PropertyIndex s_PropertyIndex {
+        .m_PropertyData = s_Properties,
+        .m_PropertyCount = s_PropertyCount,
+    };
+
+    s_PropertyIndex.m_Keys.reserve(s_PropertyCount);
+
+    for (size_t i = 0; i < s_PropertyCount; ++i) {
+        s_PropertyIndex.m_Keys.push_back(static_cast<uint64_t>(s_Properties[i].m_nPropertyID) << 32 | i);
+    }
+
+    std::ranges::sort(s_PropertyIndex.m_Keys);
+
+    const int64_t s_Index = FindPropertyIndex(s_PropertyIndex, p_PropertyId);
+
+    {
+        std::unique_lock s_Lock(g_PropertyIndicesMutex);
+        g_PropertyIndices.insert_or_assign(this, std::move(s_PropertyIndex));
+    }
+
+    return s_Index >= 0 ? &s_Properties[s_Index] : nullptr;
+}
+
+bool ZEntityType::FindInterfaceOffset(const STypeID* p_TypeID, int64_t& p_Offset) const {
+    if (!m_pInterfaceData) {
+        return false;
+    }
+
+    const SInterfaceData* s_Interfaces = m_pInterfaceData->begin();
+    const int64_t s_InterfaceIndex = EntityInterfaceCache::FindInterfaceIndex(
+        this, p_TypeID, s_Interfaces, static_cast<uint32_t>(m_pInterfaceData->size())
+    );
+
+    if (s_InterfaceIndex < 0) {
+        return false;
+    }
+
+    p_Offset = s_Interfaces[s_InterfaceIndex].m_nInterfaceOffset;
+    return true;
+}
+
+void ZEntityType::ClearInterfaceCache() {
+    EntityInterfaceCache::Clear();
+}
+
+void ZEntityType::ClearPropertyIndices() {
+    std::unique_lock s_Lock(g_PropertyIndicesMutex);
+    g_PropertyIndices.clear();
+}
 
 void ZEntityRef::SetLogicalParent(ZEntityRef entityRef) {
     const auto s_Entity = GetEntity();
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * A small direct-mapped cache of interface lookups per thread, so lookups don't need any locking.
+ * Entries are only valid for the generation they were written in, which changes on every call to Clear().
+ *
+ * TInterfaceData is the element type of the interface arrays of TType and needs an m_Type member that
+ * holds the TTypeID of the interface.
+ */
+template <typename TType, typename TTypeID, typename TInterfaceData>
+class InterfaceCache {
+public:
+    /**
+     * Find the interface with the given type ID in the interface array of a type.
+     * @return The index of the interface in p_Interfaces, or -1 if the type doesn't implement it.
+     */
+    static int64_t FindInterfaceIndex(
+        const TType* p_Type, const TTypeID* p_TypeID, const TInterfaceData* p_Interfaces,
+        const uint32_t p_InterfaceCount
+    ) {
+        const uint32_t s_Generation = m_Generation.load(std::memory_order_relaxed);
+
+        const uint64_t s_Key =
+            reinterpret_cast<uintptr_t>(p_Type) ^ std::rotl(reinterpret_cast<uintptr_t>(p_TypeID), 17);
+        Entry& s_Entry = m_Entries[(s_Key * 0x9e3779b97f4a7c15) >> (64 - c_Bits)];
+
+        // The interface data pointer and count are part of the key, so a new type at the address of a freed one
+        // doesn't hit the entries of the old type. The interface that was found is checked as well, in case the
+        // interface array was changed in place.
+        if (s_Entry.m_Type == p_Type &&
+            s_Entry.m_TypeID == p_TypeID &&
+            s_Entry.m_InterfaceData == p_Interfaces &&
+            s_Entry.m_InterfaceCount == p_InterfaceCount &&
+            s_Entry.m_Generation == s_Generation &&
+            (s_Entry.m_InterfaceIndex < 0 || p_Interfaces[s_Entry.m_InterfaceIndex].m_Type == p_TypeID)) {
+            return s_Entry.m_InterfaceIndex;
+        }
+
+        int64_t s_InterfaceIndex = -1;
+
+        for (uint32_t i = 0; i < p_InterfaceCount; ++i) {
+            if (p_Interfaces[i].m_Type == p_TypeID) {
+                s_InterfaceIndex = i;
+                break;
+            }
+        }
+
+        s_Entry = Entry {
+            .m_Type = p_Type,
+            .m_TypeID = p_TypeID,
+            .m_InterfaceData = p_Interfaces,
+            .m_InterfaceCount = p_InterfaceCount,
+            .m_Generation = s_Generation,
+            .m_InterfaceIndex = s_InterfaceIndex,
+        };
+
+        return s_InterfaceIndex;
+    }
+
+    /**
+     * Invalidate the entries of every thread at once.
+     */
+    static void Clear() {
+        m_Generation.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    struct Entry {
+        const TType* m_Type;
+        const TTypeID* m_TypeID;
+        const TInterfaceData* m_InterfaceData;
+        uint32_t m_InterfaceCount;
+        uint32_t m_Generation;
+        int64_t m_InterfaceIndex; // -1 if the type doesn't implement the interface.
+    };
+
+    static constexpr size_t c_Bits = 8;
+    static constexpr size_t c_Size = size_t(1) << c_Bits;
+
+    inline static std::atomic<uint32_t> m_Generation = 1;
+    inline static thread_local std::array<Entry, c_Size> m_Entries {};
+};
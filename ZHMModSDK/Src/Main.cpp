@@ -20,6 +20,9 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpReserved) {
         CreateThread(nullptr, 0, StartupProc, nullptr, 0, nullptr);
     }
     else if (fdwReason == DLL_PROCESS_DETACH) {
+        // The settings flusher only writes after a delay and the SDK is destroyed on another thread, neither of
+        // which gets to finish while the process is exiting. So pending settings are written out here first.
+        ModSDK::FlushModSettings();
         ModSDK::DestroyInstance();
     }
 
@@ -28,6 +28,8 @@ ModLoader::ModLoader() {}
 
 ModLoader::~ModLoader() {
     Hooks::Engine_Init->RemoveDetoursWithContext(this);
+
+    // This also writes the pending settings changes of every mod.
     UnloadAllMods();
 }
 
@@ -321,7 +323,7 @@ void ModLoader::LoadMod(const std::string& p_Name, bool p_LiveLoad) {
         LoadedMod s_Mod {};
         s_Mod.Module = s_Module;
         s_Mod.PluginInterface = s_PluginInterface;
-        s_Mod.Settings = new ModSettings(p_Name, s_ExeDir / "mods");
+        s_Mod.Settings = new ModSettings(p_Name, s_ExeDir / "mods", m_SettingsFlusher);
 
         m_LoadedMods[s_Name] = s_Mod;
         m_ModList.push_back(s_PluginInterface);
@@ -355,6 +357,9 @@ void ModLoader::UnloadMod(const std::string& p_Name) {
     ModSDK::GetInstance()->OnModUnloading(s_Name, s_ModMapIt->second.PluginInterface);
 
     delete s_ModMapIt->second.PluginInterface;
+
+    // Mods can still change their settings while they're being destroyed, so this happens afterwards.
+    s_ModMapIt->second.Settings->Flush();
     delete s_ModMapIt->second.Settings;
     FreeLibrary(s_ModMapIt->second.Module);
 
@@ -423,6 +428,14 @@ IPluginInterface* ModLoader::GetModByName(const std::string& p_Name) {
     return it->second.PluginInterface;
 }
 
+void ModLoader::FlushAllSettings() {
+    std::shared_lock s_Lock(m_Mutex);
+
+    for (auto& [s_Name, s_Mod] : m_LoadedMods) {
+        s_Mod.Settings->Flush();
+    }
+}
+
 ModSettings* ModLoader::GetModSettings(IPluginInterface* p_PluginInterface) {
     std::shared_lock s_Lock(m_Mutex);
 
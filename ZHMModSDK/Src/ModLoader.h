@@ -36,6 +36,11 @@ public:
     IPluginInterface* GetModByName(const std::string& p_Name);
     ModSettings* GetModSettings(IPluginInterface* p_PluginInterface);
 
+    /**
+     * Write the pending settings changes of every loaded mod right away, on the calling thread.
+     */
+    void FlushAllSettings();
+
     std::vector<IPluginInterface*> GetLoadedMods() const {
         return m_ModList;
     }
@@ -63,4 +68,7 @@ private:
     std::vector<IPluginInterface*> m_ModList;
     std::unordered_map<std::string, LoadedMod> m_LoadedMods;
     std::shared_mutex m_Mutex;
+
+    // Writes the settings of all loaded mods in the background.
+    ModSettingsFlusher m_SettingsFlusher;
 };
\ No newline at end of file
@@ -10,6 +10,8 @@
 #include "Logging.h"
 #include "IPluginInterface.h"
 #include "PinRegistry.h"
+#include "RepositoryIndex.h"
+#include "TaskScheduler.h"
 #include "Util/ProcessUtils.h"
 #include "Util/HashingUtils.h"
 #include "Util/StringUtils.h"
@@ -51,6 +53,9 @@
 #include "zhmmodsdk_rs.h"
 #include "Glacier/ZPlayerRegistry.h"
 #include "Glacier/ZServerProxyRoute.h"
+#include "Glacier/ZGameLoopManager.h"
+#include "Glacier/ZDelegate.h"
+#include "Glacier/CompileReflection.h"
 
 // Needed for TaskDialogIndirect
 #pragma comment(linker,"\"/manifestdependency:type='win32' name='Microsoft.Windows.Common-Controls' version='6.0.0.0' processorArchitecture='*' publicKeyToken='6595b64144ccf1df' language='*'\"")
@@ -125,6 +130,13 @@ void ModSDK::DestroyInstance() {
     WaitForSingleObject(s_ExitThread, INFINITE);
 }
 
+void ModSDK::FlushModSettings() {
+    if (g_Instance == nullptr || !g_Instance->m_ModLoader)
+        return;
+
+    g_Instance->m_ModLoader->FlushAllSettings();
+}
+
 ModSDK::ModSDK() {
     g_Instance = this;
 
@@ -138,6 +150,11 @@ ModSDK::ModSDK() {
     #endif
 
     m_ModLoader = std::make_shared<ModLoader>();
+    m_TaskScheduler = std::make_shared<TaskScheduler>();
+
+    if (m_MainThreadTaskBudgetMs) {
+        m_TaskScheduler->SetFrameBudget(*m_MainThreadTaskBudgetMs);
+    }
 
     m_UIConsole = std::make_shared<UI::Console>();
     m_UIMainMenu = std::make_shared<UI::MainMenu>();
@@ -159,6 +176,12 @@ ModSDK::ModSDK() {
 }
 
 ModSDK::~ModSDK() {
+    if (m_FrameUpdateRegistered) {
+        const ZMemberDelegate<ModSDK, void(const SGameUpdateEvent&)> s_Delegate(this, &ModSDK::OnFrameUpdate);
+        Globals::GameLoopManager->UnregisterFrameUpdate(s_Delegate, 0, EUpdateMode::eUpdateAlways);
+    }
+
+    m_TaskScheduler->Clear();
     m_ModLoader.reset();
 
     HookRegistry::ClearDetoursWithContext(this);
@@ -325,6 +348,15 @@ void ModSDK::LoadConfiguration() {
             m_EnableSentry = s_Value == "true" || s_Value == "1";
         }
 
+        if (s_Mod.second.has("main_thread_task_budget_ms") && !s_Mod.second.get("main_thread_task_budget_ms").empty()) {
+            try {
+                m_MainThreadTaskBudgetMs = std::stod(s_Mod.second.get("main_thread_task_budget_ms"));
+            }
+            catch (const std::exception&) {
+                Logger::Error("Could not parse main_thread_task_budget_ms value from mod.ini. Using default value.");
+            }
+        }
+
         if (s_Mod.second.has("auto_load_scene")) {
             const auto s_Value = s_Mod.second.get("auto_load_scene");
             m_AutoLoadScene = s_Value;
@@ -893,6 +925,14 @@ void ModSDK::OnDrawMenu() const {
     m_ModLoader->UnlockRead();
 }
 
+void ModSDK::OnFrameUpdate(const SGameUpdateEvent& p_UpdateEvent) {
+    m_MainThreadId.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+    UpdateRepositoryIndex();
+
+    m_TaskScheduler->ProcessTasks();
+}
+
 void ModSDK::OnDrawUI(bool p_HasFocus) {
     m_UIConsole->Draw(p_HasFocus);
     m_UIMainMenu->Draw(p_HasFocus);
@@ -1021,6 +1061,7 @@ void ModSDK::OnModLoaded(const std::string& p_Name, IPluginInterface* p_Mod, boo
 }
 
 void ModSDK::OnModUnloading(const std::string& p_Name, IPluginInterface* p_Mod) {
+    m_TaskScheduler->RemoveTasksForOwner(p_Mod);
     p_Mod->CleanupUI();
 }
 
@@ -1039,6 +1080,12 @@ void ModSDK::OnEngineInit() {
         m_ImguiRenderer->OnEngineInit();
     }
 
+    if (!m_FrameUpdateRegistered) {
+        const ZMemberDelegate<ModSDK, void(const SGameUpdateEvent&)> s_Delegate(this, &ModSDK::OnFrameUpdate);
+        Globals::GameLoopManager->RegisterFrameUpdate(s_Delegate, 0, EUpdateMode::eUpdateAlways);
+        m_FrameUpdateRegistered = true;
+    }
+
     /*if (Globals::ZProfileServerPageProxyBase_m_aRouteMap) {
         for (auto s_Pair : *Globals::ZProfileServerPageProxyBase_m_aRouteMap) {
             Logger::Debug("Route map: {} -> {}", s_Pair->first.c_str(), s_Pair->second->m_sUrl);
@@ -1307,13 +1354,19 @@ ImPlotContext* ModSDK::GetImPlotContext() {
 }
 
 bool ModSDK::GetPinName(int32_t p_PinId, ZString& p_Name) {
-    std::string s_Name;
-    if (TryGetPinName(p_PinId, s_Name)) {
-        p_Name = s_Name;
-        return true;
+    std::string_view s_Name;
+
+    if (!TryGetPinName(p_PinId, s_Name)) {
+        return false;
     }
 
-    return false;
+    // Pin names live in static storage, so the string can just point to them instead of allocating a copy.
+    p_Name = ZString(s_Name);
+    return true;
+}
+
+bool ModSDK::GetPinId(const ZString& p_Name, int32_t& p_PinId) {
+    return TryGetPinId(p_Name.ToStringView(), p_PinId);
 }
 
 bool ModSDK::WorldToScreen(const SVector3& p_WorldPos, SVector2& p_Out) {
@@ -1477,14 +1530,7 @@ int64_t ModSDK::GetPluginSettingInt(
         return p_DefaultValue;
     }
 
-    const auto s_Value = s_Settings->GetSetting(p_Section.c_str(), p_Name.c_str(), std::to_string(p_DefaultValue));
-
-    try {
-        return std::stoll(s_Value);
-    }
-    catch (const std::exception&) {
-        return p_DefaultValue;
-    }
+    return s_Settings->GetHandle(p_Section.c_str(), p_Name.c_str())->GetInt(p_DefaultValue);
 }
 
 uint64_t ModSDK::GetPluginSettingUInt(
@@ -1503,14 +1549,7 @@ uint64_t ModSDK::GetPluginSettingUInt(
         return p_DefaultValue;
     }
 
-    const auto s_Value = s_Settings->GetSetting(p_Section.c_str(), p_Name.c_str(), std::to_string(p_DefaultValue));
-
-    try {
-        return std::stoull(s_Value);
-    }
-    catch (const std::exception&) {
-        return p_DefaultValue;
-    }
+    return s_Settings->GetHandle(p_Section.c_str(), p_Name.c_str())->GetUInt(p_DefaultValue);
 }
 
 double ModSDK::GetPluginSettingDouble(
@@ -1529,14 +1568,7 @@ double ModSDK::GetPluginSettingDouble(
         return p_DefaultValue;
     }
 
-    const auto s_Value = s_Settings->GetSetting(p_Section.c_str(), p_Name.c_str(), std::to_string(p_DefaultValue));
-
-    try {
-        return std::stod(s_Value);
-    }
-    catch (const std::exception&) {
-        return p_DefaultValue;
-    }
+    return s_Settings->GetHandle(p_Section.c_str(), p_Name.c_str())->GetDouble(p_DefaultValue);
 }
 
 bool ModSDK::GetPluginSettingBool(
@@ -1555,17 +1587,7 @@ bool ModSDK::GetPluginSettingBool(
         return p_DefaultValue;
     }
 
-    const auto s_Value = s_Settings->GetSetting(p_Section.c_str(), p_Name.c_str(), p_DefaultValue ? "true" : "false");
-
-    if (s_Value == "true" || s_Value == "1" || s_Value == "yes" || s_Value == "on" || s_Value == "y") {
-        return true;
-    }
-    else if (s_Value == "false" || s_Value == "0" || s_Value == "no" || s_Value == "off" || s_Value == "n") {
-        return false;
-    }
-    else {
-        return p_DefaultValue;
-    }
+    return s_Settings->GetHandle(p_Section.c_str(), p_Name.c_str())->GetBool(p_DefaultValue);
 }
 
 bool ModSDK::HasPluginSetting(IPluginInterface* p_Plugin, const ZString& p_Section, const ZString& p_Name) {
@@ -1610,6 +1632,24 @@ void ModSDK::ReloadPluginSettings(IPluginInterface* p_Plugin) {
     s_Settings->Reload();
 }
 
+const PluginSettingHandle* ModSDK::GetPluginSettingHandle(
+    IPluginInterface* p_Plugin,
+    const ZString& p_Section,
+    const ZString& p_Name
+) {
+    if (!p_Plugin) {
+        return nullptr;
+    }
+
+    auto s_Settings = m_ModLoader->GetModSettings(p_Plugin);
+
+    if (!s_Settings) {
+        return nullptr;
+    }
+
+    return s_Settings->GetHandle(p_Section.c_str(), p_Name.c_str());
+}
+
 TEntityRef<ZHitman5> ModSDK::GetLocalPlayer() {
     if (!Globals::PlayerRegistry) {
         return {};
@@ -1676,6 +1716,73 @@ bool ModSDK::CreateWICTextureFromFile(
     return m_ImguiRenderer->CreateWICTextureFromFile(p_FilePath, p_OutTexture, p_OutImGuiTexture);
 }
 
+void ModSDK::QueueMainThreadTask(IPluginInterface* p_Plugin, MainThreadTask&& p_Task, ETaskPriority p_Priority) {
+    m_TaskScheduler->Queue(p_Plugin, std::move(p_Task), p_Priority);
+}
+
+std::shared_ptr<const RepositoryIndex> ModSDK::GetRepositoryIndex() {
+    auto s_RepositoryIndex = m_RepositoryIndex.load(std::memory_order_acquire);
+
+    // Mods can ask for the index before the first frame update after the repository was loaded (e.g. from a scene
+    // load hook). Build it right away in that case instead of returning nothing, if we're on the main thread.
+    if (!s_RepositoryIndex && m_MainThreadId.load(std::memory_order_relaxed) == std::this_thread::get_id()) {
+        UpdateRepositoryIndex();
+        s_RepositoryIndex = m_RepositoryIndex.load(std::memory_order_acquire);
+    }
+
+    return s_RepositoryIndex;
+}
+
+bool ModSDK::SetRepositoryAmmoConfig(const ZRepositoryID& p_Id, const ZDynamicObject& p_Value) {
+    if (m_MainThreadId.load(std::memory_order_relaxed) != std::this_thread::get_id()) {
+        Logger::Error("Repository entries can only be changed on the main thread.");
+        return false;
+    }
+
+    const auto s_RepositoryIndex = GetRepositoryIndex();
+
+    if (!s_RepositoryIndex) {
+        return false;
+    }
+
+    const uint32_t s_Index = s_RepositoryIndex->Find(p_Id);
+
+    if (s_Index == RepositoryIndex::c_InvalidIndex || !s_RepositoryIndex->m_AmmoConfigs[s_Index]) {
+        return false;
+    }
+
+    s_RepositoryIndex->m_AmmoConfigs[s_Index]->value = p_Value;
+
+    return true;
+}
+
+void ModSDK::UpdateRepositoryIndex() {
+    if (m_RepositoryResource.m_nResourceIndex.val == -1) {
+        const auto s_ID = ResId<"[assembly:/repository/pro.repo].pc_repo">;
+
+        Globals::ResourceManager->GetResourcePtr(m_RepositoryResource, s_ID, 0);
+    }
+
+    if (m_RepositoryResource.GetResourceInfo().status != RESOURCE_STATUS_VALID) {
+        return;
+    }
+
+    // We keep a reference to the repository, so this only changes if the resource itself was reloaded.
+    void* s_RepositoryData = m_RepositoryResource.GetResourceData();
+
+    if (s_RepositoryData == m_IndexedRepositoryData) {
+        return;
+    }
+
+    auto s_RepositoryIndex = std::make_shared<RepositoryIndex>();
+    s_RepositoryIndex->Build(s_RepositoryData);
+
+    Logger::Debug("Indexed {} repository entries.", s_RepositoryIndex->GetEntryCount());
+
+    m_IndexedRepositoryData = s_RepositoryData;
+    m_RepositoryIndex.store(std::move(s_RepositoryIndex), std::memory_order_release);
+}
+
 void ModSDK::AllocateZString(ZString* p_Target, const char* p_Str, uint32_t p_Size) {
     if (Globals::Hitman5Module->IsEngineInitialized()) {
         // If engine is initialized, allocate the normal way.
@@ -1834,6 +1941,8 @@ DEFINE_DETOUR_WITH_CONTEXT(
         m_DirectXTKRenderer->ClearDepthBuffer();
     }
 
+    m_MountedChunksDirty.store(true, std::memory_order_release);
+
     static bool s_BypassedOnce = false;
 
     if ((p_Parameters.m_SceneResource == "assembly:/_PRO/Scenes/Frontend/MainMenu.entity" ||
@@ -1849,8 +1958,17 @@ DEFINE_DETOUR_WITH_CONTEXT(
 DEFINE_DETOUR_WITH_CONTEXT(ModSDK, void, OnClearScene, ZEntitySceneContext* th, bool p_FullyUnloadScene) {
     if (m_DirectXTKRenderer) {
         m_DirectXTKRenderer->ClearDepthBuffer();
+
+        // Labels of the old scene (entity names, indices, ...) won't be drawn again.
+        m_DirectXTKRenderer->ClearTextLayoutCache();
     }
 
+    // Scene changes mount and unmount chunks without going through the SDK.
+    m_MountedChunksDirty.store(true, std::memory_order_release);
+
+    ZEntityType::ClearPropertyIndices();
+    ZEntityType::ClearInterfaceCache();
+
     return {HookAction::Continue()};
 }
 
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <ini.h>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 
 #include "IModSDK.h"
@@ -11,6 +14,8 @@
 #include "Glacier/ZEntity.h"
 
 struct ResourceMem;
+struct QnResourceMeta;
+struct QnConvertedData;
 
 namespace Rendering {
     class D3D12Hooks;
@@ -30,8 +35,11 @@ namespace UI {
 
 class IRenderer;
 class IPluginInterface;
+class TaskScheduler;
 class ModLoader;
 class DebugConsole;
+class ResourceChunkIndex;
+class RepositoryIndex;
 struct IDXGISwapChain3;
 
 class ModSDK : public IModSDK {
@@ -42,6 +50,12 @@ public:
     static ModSDK* GetInstance();
     static void DestroyInstance();
 
+    /**
+     * Write the pending settings changes of all loaded mods on the calling thread, without waiting for
+     * any other thread.
+     */
+    static void FlushModSettings();
+
 public:
     ModSDK();
     ~ModSDK();
@@ -69,6 +83,8 @@ public:
     void OnDraw3D() const;
     void OnDepthDraw3D() const;
     void OnDrawMenu() const;
+    void OnFrameUpdate(const SGameUpdateEvent& p_UpdateEvent);
+    void UpdateRepositoryIndex();
 
 public:
     void SetSwapChain(Rendering::D3D12SwapChain* p_SwapChain);
@@ -80,6 +96,7 @@ public:
 
 public:
     std::shared_ptr<ModLoader> GetModLoader() const { return m_ModLoader; }
+    std::shared_ptr<TaskScheduler> GetTaskScheduler() const { return m_TaskScheduler; }
 
     #if _DEBUG
     std::shared_ptr<DebugConsole> GetDebugConsole() const { return m_DebugConsole; }
@@ -205,6 +222,19 @@ public:
         ImGuiTexture& p_OutImGuiTexture
     ) override;
 
+    void QueueMainThreadTask(IPluginInterface* p_Plugin, MainThreadTask&& p_Task, ETaskPriority p_Priority) override;
+
+    std::shared_ptr<const RepositoryIndex> GetRepositoryIndex() override;
+
+    const PluginSettingHandle* GetPluginSettingHandle(
+        IPluginInterface* p_Plugin, const ZString& p_Section, const ZString& p_Name
+    ) override;
+
+    bool GetPinId(const ZString& p_Name, int32_t& p_PinId) override;
+
+    uint64_t GetGameBuildFingerprint() override;
+    bool SetRepositoryAmmoConfig(const ZRepositoryID& p_Id, const ZDynamicObject& p_Value) override;
+
     #pragma endregion
 
     void AllocateZString(ZString* p_Target, const char* p_Str, uint32_t p_Size);
@@ -262,17 +292,38 @@ public:
         TResourcePtr<ZTemplateEntityFactory>& p_FactoryOut
     ) override;
 
+    bool LoadQnEntities(
+        std::span<const ZString> p_Jsons,
+        std::span<TResourcePtr<ZTemplateEntityBlueprintFactory>> p_BlueprintFactoriesOut,
+        std::span<TResourcePtr<ZTemplateEntityFactory>> p_FactoriesOut
+    ) override;
+
     bool IsChunkMounted(uint32_t p_ChunkIndex) override;
+    int32_t GetMountedChunkPatchLevel(uint32_t p_ChunkIndex) override;
+    std::vector<uint32_t> GetMountedChunkIndices() override;
     void MountChunk(uint32_t p_ChunkIndex) override;
     void UnmountChunk(uint32_t p_ChunkIndex, bool p_RemountChunksBelow) override;
-    const TArray<uint32_t>& GetChunkIndicesForRuntimeResourceId(const ZRuntimeResourceID& id) override;
+    TArray<uint32_t> GetChunkIndicesForRuntimeResourceId(const ZRuntimeResourceID& id) override;
 
 private:
     std::tuple<ZResourceIndex, ZRuntimeResourceID> LoadResourceFromBIN1(
-        ResourceMem* p_ResourceMem, std::string_view p_MetaJson, std::function<void(ZResourcePending*)> p_Install
+        ResourceMem* p_ResourceMem, const QnResourceMeta& p_Meta, std::function<void(ZResourcePending*)> p_Install
+    );
+
+    bool LoadQnConvertedData(
+        const QnConvertedData& p_QnData,
+        TResourcePtr<ZTemplateEntityBlueprintFactory>& p_BlueprintFactoryOut,
+        TResourcePtr<ZTemplateEntityFactory>& p_FactoryOut
     );
 
     void LoadResourceChunkMap();
+    std::shared_ptr<const MountedChunks> GetMountedChunks();
+
+    /**
+     * Mount several chunks and their parents, skipping ones that are already mounted.
+     * Progress is reported through Events::OnChunkMountProgress.
+     */
+    void MountChunks(std::span<const uint32_t> p_ChunkIndices);
 
     #pragma endregion
 
@@ -297,10 +348,40 @@ private:
     bool m_IsGameStateLoggingEnabled = false;
     bool m_IsSceneLoadingLoggingEnabled = false;
     bool m_IsScaleformLoggingEnabled = false;
-
-    std::unordered_map<ZRuntimeResourceID, TArray<uint32_t>> m_ResourceIdToChunkMap;
+    std::optional<double> m_MainThreadTaskBudgetMs;
+
+    // Loaded on first use from whichever thread needs it first. Once loaded, the index is never modified again,
+    // so lookups don't need to hold the mutex.
+    std::shared_ptr<ResourceChunkIndex> m_ResourceChunkIndex {};
+    std::mutex m_ResourceChunkIndexMutex;
+
+    // Mounted chunks as a bitset, plus the highest mounted patch level of each chunk (-1 if not mounted).
+    // The engine mounts chunks on its own too, so this is rebuilt from the mounted packages of the resource
+    // container whenever that list changes size or a mount / unmount path marks it as dirty.
+    struct MountedChunks {
+        std::vector<uint64_t> m_Chunks;
+        std::vector<int32_t> m_PatchLevels;
+        std::vector<uint32_t> m_MountOrder;
+        size_t m_PackageCount = 0;
+    };
+
+    // Chunks are queried from the render thread as well as the main thread, so every rebuild publishes a new
+    // immutable snapshot. Readers never lock unless the snapshot is out of date, and rebuilds are serialized.
+    std::atomic<std::shared_ptr<const MountedChunks>> m_MountedChunks;
+    std::atomic<bool> m_MountedChunksDirty {true};
+    std::mutex m_MountedChunksMutex;
+
+    // Shared index of pro.repo. Built on the main thread once the repository is loaded, and kept across scenes
+    // since we hold a reference to the resource. Mods read it from other threads too, so it's published through an
+    // atomic pointer and never modified after that. The resource is only touched from the main thread.
+    std::atomic<std::shared_ptr<const RepositoryIndex>> m_RepositoryIndex;
+    ZResourcePtr m_RepositoryResource {};
+    void* m_IndexedRepositoryData = nullptr; // Resource data the current index was built from.
+    std::atomic<std::thread::id> m_MainThreadId {}; // Set on every frame update.
 
     std::shared_ptr<ModLoader> m_ModLoader {};
+    std::shared_ptr<TaskScheduler> m_TaskScheduler {};
+    bool m_FrameUpdateRegistered = false;
 
     #if _DEBUG
     std::shared_ptr<DebugConsole> m_DebugConsole {};
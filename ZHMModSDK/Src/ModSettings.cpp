@@ -1,60 +1,195 @@
 #include "ModSettings.h"
 
+#include <algorithm>
+#include <cctype>
+#include <charconv>
 #include <filesystem>
 #include <utility>
 #include <ini.h>
 
-ModSettings::ModSettings(std::string p_ModName, std::filesystem::path p_ModDirectory) :
+#include "Logging.h"
+
+ModSettingsFlusher::~ModSettingsFlusher() {
+    {
+        std::unique_lock s_Lock(m_Mutex);
+        m_Stop = true;
+    }
+
+    m_Condition.notify_all();
+
+    if (m_Thread.joinable()) {
+        m_Thread.join();
+    }
+}
+
+void ModSettingsFlusher::Schedule(ModSettings* p_Settings) {
+    {
+        std::unique_lock s_Lock(m_Mutex);
+
+        if (m_Stop) {
+            return;
+        }
+
+        m_Deadlines[p_Settings] = std::chrono::steady_clock::now() + c_FlushDelay;
+
+        if (!m_Thread.joinable()) {
+            m_Thread = std::thread(&ModSettingsFlusher::FlushThread, this);
+        }
+    }
+
+    m_Condition.notify_all();
+}
+
+void ModSettingsFlusher::Cancel(ModSettings* p_Settings) {
+    std::unique_lock s_Lock(m_Mutex);
+
+    m_Deadlines.erase(p_Settings);
+    m_Condition.wait(s_Lock, [this, p_Settings]() { return m_FlushingSettings != p_Settings; });
+}
+
+void ModSettingsFlusher::FlushThread() {
+    std::unique_lock s_Lock(m_Mutex);
+
+    while (!m_Stop) {
+        if (m_Deadlines.empty()) {
+            m_Condition.wait(s_Lock);
+            continue;
+        }
+
+        const auto s_Next = std::min_element(
+            m_Deadlines.begin(), m_Deadlines.end(), [](const auto& p_A, const auto& p_B) {
+                return p_A.second < p_B.second;
+            }
+        );
+
+        // Every change pushes the deadline back, so this waits until the settings haven't changed for a while.
+        // The deadline is copied because the entry can be removed while waiting.
+        const auto s_Deadline = s_Next->second;
+
+        if (std::chrono::steady_clock::now() < s_Deadline) {
+            m_Condition.wait_until(s_Lock, s_Deadline);
+            continue;
+        }
+
+        ModSettings* s_Settings = s_Next->first;
+        m_Deadlines.erase(s_Next);
+        m_FlushingSettings = s_Settings;
+
+        s_Lock.unlock();
+        const bool s_Written = s_Settings->Flush();
+        s_Lock.lock();
+
+        m_FlushingSettings = nullptr;
+
+        // Changes made during the write have already scheduled another one.
+        if (!s_Written && !m_Stop) {
+            m_Deadlines.try_emplace(s_Settings, std::chrono::steady_clock::now() + c_RetryDelay);
+        }
+
+        m_Condition.notify_all();
+    }
+}
+
+ModSettings::ModSettings(
+    std::string p_ModName, std::filesystem::path p_ModDirectory, ModSettingsFlusher& p_Flusher
+) :
     m_ModName(std::move(p_ModName)),
-    m_ModDirectory(std::move(p_ModDirectory)) {
+    m_ModDirectory(std::move(p_ModDirectory)),
+    m_Flusher(p_Flusher) {
     Reload();
 }
 
 ModSettings::~ModSettings() {
-    Save();
+    m_Flusher.Cancel(this);
+    Flush();
+}
+
+std::filesystem::path ModSettings::GetSettingsIniPath() const {
+    return m_ModDirectory / (m_ModName + ".ini");
 }
 
 void ModSettings::Reload() {
+    std::unique_lock s_WriteLock(m_WriteMutex);
+
+    // Changes that haven't been written yet would otherwise be lost.
+    WritePendingChanges();
+
     std::unique_lock<std::shared_mutex> s_Lock(m_SettingsMutex);
 
     m_Settings.clear();
 
-    std::filesystem::path s_SettingsIniPath = m_ModDirectory / (m_ModName + ".ini");
+    std::filesystem::path s_SettingsIniPath = GetSettingsIniPath();
 
-    if (!std::filesystem::exists(s_SettingsIniPath)) {
-        return;
-    }
+    if (std::filesystem::exists(s_SettingsIniPath)) {
+        mINI::INIFile s_File(s_SettingsIniPath.string());
 
-    mINI::INIFile s_File(s_SettingsIniPath.string());
+        mINI::INIStructure s_Ini;
 
-    mINI::INIStructure s_Ini;
+        s_File.read(s_Ini);
 
-    s_File.read(s_Ini);
+        for (auto const& it : s_Ini) {
+            auto const& s_SectionName = it.first;
+            auto const& s_SectionItems = it.second;
 
-    for (auto const& it : s_Ini) {
-        auto const& s_SectionName = it.first;
-        auto const& s_SectionItems = it.second;
+            std::unordered_map<std::string, std::string> s_Section;
 
-        std::unordered_map<std::string, std::string> s_Section;
+            for (auto const& it2 : s_SectionItems) {
+                s_Section[it2.first] = it2.second;
+            }
 
-        for (auto const& it2 : s_SectionItems) {
-            s_Section[it2.first] = it2.second;
+            m_Settings[s_SectionName] = s_Section;
         }
+    }
 
-        m_Settings[s_SectionName] = s_Section;
+    // What's in memory now matches the file.
+    m_WrittenRevision = m_Revision;
+
+    for (auto const& [s_SectionName, s_SectionHandles] : m_Handles) {
+        for (auto const& [s_Name, s_Handle] : s_SectionHandles) {
+            s_Handle->Store(ParseValue(FindSetting(s_SectionName, s_Name)));
+        }
     }
 }
 
-void ModSettings::Save() {
-    std::unique_lock<std::shared_mutex> s_Lock(m_SettingsMutex);
+bool ModSettings::Flush() {
+    std::unique_lock s_WriteLock(m_WriteMutex);
+    return WritePendingChanges();
+}
+
+bool ModSettings::WritePendingChanges() {
+    SettingsMap s_Settings;
+    uint64_t s_Revision;
+
+    {
+        std::shared_lock<std::shared_mutex> s_Lock(m_SettingsMutex);
+
+        if (m_Revision == m_WrittenRevision) {
+            return true;
+        }
+
+        s_Settings = m_Settings;
+        s_Revision = m_Revision;
+    }
+
+    if (!Write(s_Settings)) {
+        Logger::Warn("Could not save settings of mod '{}'.", m_ModName);
+        return false;
+    }
+
+    // Only what was in the snapshot is on disk; later changes stay pending.
+    m_WrittenRevision = s_Revision;
 
-    std::filesystem::path s_SettingsIniPath = m_ModDirectory / (m_ModName + ".ini");
+    return true;
+}
 
-    mINI::INIFile s_File(s_SettingsIniPath.string());
+bool ModSettings::Write(const SettingsMap& p_Settings) const {
+    const std::filesystem::path s_SettingsIniPath = GetSettingsIniPath();
+    std::filesystem::path s_TemporaryPath = s_SettingsIniPath;
+    s_TemporaryPath += ".tmp";
 
     mINI::INIStructure s_Ini;
 
-    for (auto const& it : m_Settings) {
+    for (auto const& it : p_Settings) {
         auto const& s_SectionName = it.first;
         auto const& s_SectionItems = it.second;
 
@@ -67,7 +202,21 @@ void ModSettings::Save() {
         s_Ini.set(s_SectionName, s_Section);
     }
 
-    s_File.generate(s_Ini, true);
+    mINI::INIFile s_File(s_TemporaryPath.string());
+
+    if (!s_File.generate(s_Ini, true)) {
+        return false;
+    }
+
+    std::error_code s_ErrorCode;
+    std::filesystem::rename(s_TemporaryPath, s_SettingsIniPath, s_ErrorCode);
+
+    if (s_ErrorCode) {
+        std::filesystem::remove(s_TemporaryPath, s_ErrorCode);
+        return false;
+    }
+
+    return true;
 }
 
 bool ModSettings::HasSetting(const std::string& p_Section, const std::string& p_Name) {
@@ -100,14 +249,22 @@ void ModSettings::SetSetting(const std::string& p_Section, const std::string& p_
     {
         std::unique_lock<std::shared_mutex> s_Lock(m_SettingsMutex);
 
-        if (m_Settings.find(p_Section) == m_Settings.end()) {
-            m_Settings[p_Section] = std::unordered_map<std::string, std::string>();
+        auto [s_SettingIt, s_Inserted] = m_Settings[p_Section].try_emplace(p_Name, p_Value);
+
+        if (!s_Inserted) {
+            // Mods often write back the value they just read, which doesn't need to touch the disk.
+            if (s_SettingIt->second == p_Value) {
+                return;
+            }
+
+            s_SettingIt->second = p_Value;
         }
 
-        m_Settings[p_Section][p_Name] = p_Value;
+        ++m_Revision;
+        UpdateHandle(p_Section, p_Name);
     }
 
-    Save();
+    m_Flusher.Schedule(this);
 }
 
 void ModSettings::RemoveSetting(const std::string& p_Section, const std::string& p_Name) {
@@ -123,7 +280,127 @@ void ModSettings::RemoveSetting(const std::string& p_Section, const std::string&
         }
 
         m_Settings[p_Section].erase(p_Name);
+
+        ++m_Revision;
+        UpdateHandle(p_Section, p_Name);
+    }
+
+    m_Flusher.Schedule(this);
+}
+
+const PluginSettingHandle* ModSettings::GetHandle(const std::string& p_Section, const std::string& p_Name) {
+    {
+        std::shared_lock<std::shared_mutex> s_Lock(m_SettingsMutex);
+
+        const auto s_SectionIt = m_Handles.find(p_Section);
+
+        if (s_SectionIt != m_Handles.end()) {
+            const auto s_HandleIt = s_SectionIt->second.find(p_Name);
+
+            if (s_HandleIt != s_SectionIt->second.end()) {
+                return s_HandleIt->second.get();
+            }
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> s_Lock(m_SettingsMutex);
+
+    auto& s_Handle = m_Handles[p_Section][p_Name];
+
+    // Another thread might have created it in the meantime.
+    if (!s_Handle) {
+        s_Handle = std::make_unique<PluginSettingHandle>();
+        s_Handle->Store(ParseValue(FindSetting(p_Section, p_Name)));
+    }
+
+    return s_Handle.get();
+}
+
+const std::string* ModSettings::FindSetting(const std::string& p_Section, const std::string& p_Name) const {
+    const auto s_SectionIt = m_Settings.find(p_Section);
+
+    if (s_SectionIt == m_Settings.end()) {
+        return nullptr;
+    }
+
+    const auto s_SettingIt = s_SectionIt->second.find(p_Name);
+
+    if (s_SettingIt == s_SectionIt->second.end()) {
+        return nullptr;
+    }
+
+    return &s_SettingIt->second;
+}
+
+void ModSettings::UpdateHandle(const std::string& p_Section, const std::string& p_Name) {
+    const auto s_SectionIt = m_Handles.find(p_Section);
+
+    if (s_SectionIt == m_Handles.end()) {
+        return;
+    }
+
+    const auto s_HandleIt = s_SectionIt->second.find(p_Name);
+
+    if (s_HandleIt == s_SectionIt->second.end()) {
+        return;
+    }
+
+    s_HandleIt->second->Store(ParseValue(FindSetting(p_Section, p_Name)));
+}
+
+PluginSettingHandle::Value ModSettings::ParseValue(const std::string* p_Value) {
+    PluginSettingHandle::Value s_Value {};
+
+    if (!p_Value) {
+        return s_Value;
+    }
+
+    s_Value.m_Flags |= PluginSettingHandle::c_ExistsFlag;
+
+    // Mirror std::stoll and friends, which skip leading whitespace, accept a leading plus sign,
+    // and ignore anything after the number.
+    std::string_view s_Number = *p_Value;
+
+    while (!s_Number.empty() && std::isspace(static_cast<unsigned char>(s_Number.front()))) {
+        s_Number.remove_prefix(1);
     }
 
-    Save();
-}
\ No newline at end of file
+    if (s_Number.starts_with('+') && !s_Number.substr(1).starts_with('-')) {
+        s_Number.remove_prefix(1);
+    }
+
+    const char* s_Begin = s_Number.data();
+    const char* s_End = s_Number.data() + s_Number.size();
+
+    if (std::from_chars(s_Begin, s_End, s_Value.m_Int).ec == std::errc()) {
+        s_Value.m_Flags |= PluginSettingHandle::c_IntFlag;
+    }
+
+    // Like std::stoull, negative values wrap around.
+    if (s_Number.starts_with('-')) {
+        if (std::from_chars(s_Begin + 1, s_End, s_Value.m_UInt).ec == std::errc()) {
+            s_Value.m_UInt = 0 - s_Value.m_UInt;
+            s_Value.m_Flags |= PluginSettingHandle::c_UIntFlag;
+        }
+    }
+    else if (std::from_chars(s_Begin, s_End, s_Value.m_UInt).ec == std::errc()) {
+        s_Value.m_Flags |= PluginSettingHandle::c_UIntFlag;
+    }
+
+    if (std::from_chars(s_Begin, s_End, s_Value.m_Double).ec == std::errc()) {
+        s_Value.m_Flags |= PluginSettingHandle::c_DoubleFlag;
+    }
+
+    const std::string& s_String = *p_Value;
+
+    if (s_String == "true" || s_String == "1" || s_String == "yes" || s_String == "on" || s_String == "y") {
+        s_Value.m_Bool = true;
+        s_Value.m_Flags |= PluginSettingHandle::c_BoolFlag;
+    }
+    else if (s_String == "false" || s_String == "0" || s_String == "no" || s_String == "off" || s_String == "n") {
+        s_Value.m_Bool = false;
+        s_Value.m_Flags |= PluginSettingHandle::c_BoolFlag;
+    }
+
+    return s_Value;
+}
@@ -1,26 +1,119 @@
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <filesystem>
 #include <shared_mutex>
 
+#include "PluginSettingHandle.h"
+
+class ModSettings;
+
+/**
+ * Writes changed mod settings to disk from a single background thread shared by all mods.
+ *
+ * Every change pushes the write of that mod's settings back by c_FlushDelay, so a burst of changes (like a mod
+ * updating a setting for every ticked checkbox) results in a single write. Writes that fail are retried after
+ * c_RetryDelay.
+ */
+class ModSettingsFlusher {
+public:
+    ~ModSettingsFlusher();
+
+public:
+    /**
+     * Write the given settings once they haven't changed for c_FlushDelay.
+     */
+    void Schedule(ModSettings* p_Settings);
+
+    /**
+     * Stop tracking the given settings, waiting for a write of them that is in progress to finish.
+     */
+    void Cancel(ModSettings* p_Settings);
+
+private:
+    static constexpr std::chrono::milliseconds c_FlushDelay {500};
+    static constexpr std::chrono::seconds c_RetryDelay {5};
+
+    void FlushThread();
+
+private:
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::thread m_Thread;
+    std::unordered_map<ModSettings*, std::chrono::steady_clock::time_point> m_Deadlines;
+    ModSettings* m_FlushingSettings = nullptr;
+    bool m_Stop = false;
+};
+
+/**
+ * The settings of a single mod, stored in mods/<ModName>.ini.
+ *
+ * Changes only update the in-memory map and are written to disk later by the ModSettingsFlusher. The file is
+ * written to a temporary path first and then moved into place, so it's never left half-written.
+ */
 class ModSettings {
 public:
-    ModSettings(std::string p_ModName, std::filesystem::path p_ModDirectory);
+    ModSettings(std::string p_ModName, std::filesystem::path p_ModDirectory, ModSettingsFlusher& p_Flusher);
     ~ModSettings();
 
 public:
+    /**
+     * Reload the settings from disk. Pending changes are written out first.
+     */
     void Reload();
-    void Save();
+
+    /**
+     * Write pending changes to disk right away, if there are any.
+     * @return False if the settings couldn't be written. They stay pending in that case.
+     */
+    bool Flush();
+
     bool HasSetting(const std::string& p_Section, const std::string& p_Name);
     std::string GetSetting(const std::string& p_Section, const std::string& p_Name, const std::string& p_DefaultValue);
     void SetSetting(const std::string& p_Section, const std::string& p_Name, const std::string& p_Value);
     void RemoveSetting(const std::string& p_Section, const std::string& p_Name);
 
+    /**
+     * Get a handle that always holds the parsed value of a setting. The handle is created on first use
+     * and updated whenever the setting changes, so reading through it never parses anything.
+     * @return The handle, which stays valid until these settings are destroyed.
+     */
+    const PluginSettingHandle* GetHandle(const std::string& p_Section, const std::string& p_Name);
+
+private:
+    using SettingsMap = std::unordered_map<std::string, std::unordered_map<std::string, std::string>>;
+    using HandleMap = std::unordered_map<
+        std::string, std::unordered_map<std::string, std::unique_ptr<PluginSettingHandle>>
+    >;
+
+    std::filesystem::path GetSettingsIniPath() const;
+    bool WritePendingChanges();
+    bool Write(const SettingsMap& p_Settings) const;
+
+    // These expect the settings mutex to be locked exclusively.
+    const std::string* FindSetting(const std::string& p_Section, const std::string& p_Name) const;
+    void UpdateHandle(const std::string& p_Section, const std::string& p_Name);
+    static PluginSettingHandle::Value ParseValue(const std::string* p_Value);
+
 private:
     std::string m_ModName;
     std::filesystem::path m_ModDirectory;
-    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_Settings;
+    ModSettingsFlusher& m_Flusher;
+    SettingsMap m_Settings;
+    HandleMap m_Handles;
     std::shared_mutex m_SettingsMutex;
-};
\ No newline at end of file
+
+    // Bumped on every change, under the settings mutex. The settings are dirty while it differs from
+    // the revision that was last written.
+    uint64_t m_Revision = 0;
+
+    // Serializes writes and reloads, and guards the written revision.
+    std::mutex m_WriteMutex;
+    uint64_t m_WrittenRevision = 0;
+};
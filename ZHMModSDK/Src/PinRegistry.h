@@ -1,5 +1,20 @@
 #pragma once
 
-#include "Glacier/ZPrimitives.h"
+#include <cstdint>
+#include <string_view>
 
-bool TryGetPinName(int32_t p_PinId, std::string& p_Name);
\ No newline at end of file
+/**
+ * Get the name of a pin.
+ * @param p_PinId The ID of the pin.
+ * @param p_Name Receives the name. It points to static storage, so it stays valid forever.
+ * @return False if the pin is unknown.
+ */
+bool TryGetPinName(int32_t p_PinId, std::string_view& p_Name);
+
+/**
+ * Get the ID of a pin from its name.
+ * @param p_Name The name of the pin (case-sensitive).
+ * @param p_PinId Receives the ID.
+ * @return False if the pin is unknown.
+ */
+bool TryGetPinId(std::string_view p_Name, int32_t& p_PinId);
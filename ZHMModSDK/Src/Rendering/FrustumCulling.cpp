@@ -0,0 +1,426 @@
+#include "FrustumCulling.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include <immintrin.h>
+#include <intrin.h>
+
+namespace {
+    struct Sse {
+        using Vec = __m128;
+        static constexpr size_t c_Width = 4;
+
+        static Vec Load(const float* p_Data) { return _mm_loadu_ps(p_Data); }
+        static Vec Set1(const float p_Value) { return _mm_set1_ps(p_Value); }
+        static Vec Zero() { return _mm_setzero_ps(); }
+        static Vec Add(const Vec p_A, const Vec p_B) { return _mm_add_ps(p_A, p_B); }
+        static Vec Sub(const Vec p_A, const Vec p_B) { return _mm_sub_ps(p_A, p_B); }
+        static Vec Mul(const Vec p_A, const Vec p_B) { return _mm_mul_ps(p_A, p_B); }
+        static Vec Or(const Vec p_A, const Vec p_B) { return _mm_or_ps(p_A, p_B); }
+        static Vec Abs(const Vec p_A) { return _mm_andnot_ps(_mm_set1_ps(-0.f), p_A); }
+        static Vec CmpGt(const Vec p_A, const Vec p_B) { return _mm_cmpgt_ps(p_A, p_B); }
+        static uint32_t MoveMask(const Vec p_A) { return static_cast<uint32_t>(_mm_movemask_ps(p_A)); }
+    };
+
+    struct Avx {
+        using Vec = __m256;
+        static constexpr size_t c_Width = 8;
+
+        static Vec Load(const float* p_Data) { return _mm256_loadu_ps(p_Data); }
+        static Vec Set1(const float p_Value) { return _mm256_set1_ps(p_Value); }
+        static Vec Zero() { return _mm256_setzero_ps(); }
+        static Vec Add(const Vec p_A, const Vec p_B) { return _mm256_add_ps(p_A, p_B); }
+        static Vec Sub(const Vec p_A, const Vec p_B) { return _mm256_sub_ps(p_A, p_B); }
+        static Vec Mul(const Vec p_A, const Vec p_B) { return _mm256_mul_ps(p_A, p_B); }
+        static Vec Or(const Vec p_A, const Vec p_B) { return _mm256_or_ps(p_A, p_B); }
+        static Vec Abs(const Vec p_A) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), p_A); }
+        static Vec CmpGt(const Vec p_A, const Vec p_B) { return _mm256_cmp_ps(p_A, p_B, _CMP_GT_OQ); }
+        static uint32_t MoveMask(const Vec p_A) { return static_cast<uint32_t>(_mm256_movemask_ps(p_A)); }
+    };
+
+    template <typename TSimd>
+    struct Kernels {
+        using Vec = typename TSimd::Vec;
+        static constexpr size_t c_Width = TSimd::c_Width;
+
+        struct Planes {
+            Vec x[FrustumCulling::c_PlaneCount];
+            Vec y[FrustumCulling::c_PlaneCount];
+            Vec z[FrustumCulling::c_PlaneCount];
+            Vec w[FrustumCulling::c_PlaneCount];
+            Vec absX[FrustumCulling::c_PlaneCount];
+            Vec absY[FrustumCulling::c_PlaneCount];
+            Vec absZ[FrustumCulling::c_PlaneCount];
+        };
+
+        static void BroadcastPlanes(const float* p_Planes, Planes& p_Out) {
+            for (size_t i = 0; i < FrustumCulling::c_PlaneCount; ++i) {
+                p_Out.x[i] = TSimd::Set1(p_Planes[i * 4 + 0]);
+                p_Out.y[i] = TSimd::Set1(p_Planes[i * 4 + 1]);
+                p_Out.z[i] = TSimd::Set1(p_Planes[i * 4 + 2]);
+                p_Out.w[i] = TSimd::Set1(p_Planes[i * 4 + 3]);
+                p_Out.absX[i] = TSimd::Abs(p_Out.x[i]);
+                p_Out.absY[i] = TSimd::Abs(p_Out.y[i]);
+                p_Out.absZ[i] = TSimd::Abs(p_Out.z[i]);
+            }
+        }
+
+        // Load a full vector of values starting at p_Index, padding with zeros past the end of the array.
+        static Vec Load(const float* p_Data, const size_t p_Index, const size_t p_Count) {
+            if (p_Index + c_Width <= p_Count) {
+                return TSimd::Load(p_Data + p_Index);
+            }
+
+            float s_Padded[c_Width] = {};
+            std::copy(p_Data + p_Index, p_Data + p_Count, s_Padded);
+
+            return TSimd::Load(s_Padded);
+        }
+
+        static void StoreVisibility(
+            uint64_t* p_Visibility, const size_t p_Index, const size_t p_Count, const Vec p_Outside
+        ) {
+            const size_t s_Valid = std::min(c_Width, p_Count - p_Index);
+            const uint64_t s_Mask = ~TSimd::MoveMask(p_Outside) & ((1u << s_Valid) - 1);
+
+            // Vector widths divide 64, so a block never straddles two words.
+            p_Visibility[p_Index / 64] |= s_Mask << (p_Index % 64);
+        }
+
+        // Evaluated in the same order as the scalar tests so both give identical results.
+        static Vec PlaneDistance(const Planes& p_Planes, const size_t p_Plane, const Vec p_X, const Vec p_Y, const Vec p_Z) {
+            return TSimd::Add(
+                TSimd::Add(
+                    TSimd::Add(TSimd::Mul(p_Planes.x[p_Plane], p_X), TSimd::Mul(p_Planes.y[p_Plane], p_Y)),
+                    TSimd::Mul(p_Planes.z[p_Plane], p_Z)
+                ),
+                p_Planes.w[p_Plane]
+            );
+        }
+
+        static void CullPoints(
+            const float* p_Planes, const FrustumCullPoints& p_Points, const size_t p_Count, uint64_t* p_Visibility
+        ) {
+            Planes s_Planes;
+            BroadcastPlanes(p_Planes, s_Planes);
+
+            for (size_t i = 0; i < p_Count; i += c_Width) {
+                const Vec s_X = Load(p_Points.x, i, p_Count);
+                const Vec s_Y = Load(p_Points.y, i, p_Count);
+                const Vec s_Z = Load(p_Points.z, i, p_Count);
+
+                Vec s_Outside = TSimd::Zero();
+
+                for (size_t j = 0; j < FrustumCulling::c_PlaneCount; ++j) {
+                    s_Outside = TSimd::Or(s_Outside, TSimd::CmpGt(PlaneDistance(s_Planes, j, s_X, s_Y, s_Z), TSimd::Zero()));
+                }
+
+                StoreVisibility(p_Visibility, i, p_Count, s_Outside);
+            }
+        }
+
+        static void CullAABBs(
+            const float* p_Planes, const FrustumCullAABBs& p_AABBs, const size_t p_Count, uint64_t* p_Visibility
+        ) {
+            Planes s_Planes;
+            BroadcastPlanes(p_Planes, s_Planes);
+
+            const Vec s_Half = TSimd::Set1(0.5f);
+
+            for (size_t i = 0; i < p_Count; i += c_Width) {
+                const Vec s_MinX = Load(p_AABBs.minX, i, p_Count);
+                const Vec s_MinY = Load(p_AABBs.minY, i, p_Count);
+                const Vec s_MinZ = Load(p_AABBs.minZ, i, p_Count);
+                const Vec s_MaxX = Load(p_AABBs.maxX, i, p_Count);
+                const Vec s_MaxY = Load(p_AABBs.maxY, i, p_Count);
+                const Vec s_MaxZ = Load(p_AABBs.maxZ, i, p_Count);
+
+                const Vec s_CenterX = TSimd::Mul(TSimd::Add(s_MinX, s_MaxX), s_Half);
+                const Vec s_CenterY = TSimd::Mul(TSimd::Add(s_MinY, s_MaxY), s_Half);
+                const Vec s_CenterZ = TSimd::Mul(TSimd::Add(s_MinZ, s_MaxZ), s_Half);
+
+                const Vec s_HalfSizeX = TSimd::Mul(TSimd::Sub(s_MaxX, s_MinX), s_Half);
+                const Vec s_HalfSizeY = TSimd::Mul(TSimd::Sub(s_MaxY, s_MinY), s_Half);
+                const Vec s_HalfSizeZ = TSimd::Mul(TSimd::Sub(s_MaxZ, s_MinZ), s_Half);
+
+                Vec s_Outside = TSimd::Zero();
+
+                for (size_t j = 0; j < FrustumCulling::c_PlaneCount; ++j) {
+                    const Vec s_Distance = PlaneDistance(s_Planes, j, s_CenterX, s_CenterY, s_CenterZ);
+                    const Vec s_Radius = TSimd::Add(
+                        TSimd::Add(TSimd::Mul(s_Planes.absX[j], s_HalfSizeX), TSimd::Mul(s_Planes.absY[j], s_HalfSizeY)),
+                        TSimd::Mul(s_Planes.absZ[j], s_HalfSizeZ)
+                    );
+
+                    s_Outside = TSimd::Or(s_Outside, TSimd::CmpGt(TSimd::Sub(s_Distance, s_Radius), TSimd::Zero()));
+                }
+
+                StoreVisibility(p_Visibility, i, p_Count, s_Outside);
+            }
+        }
+
+        static void CullOBBs(
+            const float* p_Planes, const FrustumCullOBBs& p_OBBs, const size_t p_Count, uint64_t* p_Visibility
+        ) {
+            Planes s_Planes;
+            BroadcastPlanes(p_Planes, s_Planes);
+
+            for (size_t i = 0; i < p_Count; i += c_Width) {
+                const Vec s_CenterX = Load(p_OBBs.centerX, i, p_Count);
+                const Vec s_CenterY = Load(p_OBBs.centerY, i, p_Count);
+                const Vec s_CenterZ = Load(p_OBBs.centerZ, i, p_Count);
+
+                const Vec s_HalfSize[3] = {
+                    Load(p_OBBs.halfSizeX, i, p_Count),
+                    Load(p_OBBs.halfSizeY, i, p_Count),
+                    Load(p_OBBs.halfSizeZ, i, p_Count),
+                };
+
+                Vec s_Axes[3][3];
+
+                for (size_t a = 0; a < 3; ++a) {
+                    for (size_t c = 0; c < 3; ++c) {
+                        s_Axes[a][c] = Load(p_OBBs.axes[a][c], i, p_Count);
+                    }
+                }
+
+                Vec s_Outside = TSimd::Zero();
+
+                for (size_t j = 0; j < FrustumCulling::c_PlaneCount; ++j) {
+                    const Vec s_Distance = PlaneDistance(s_Planes, j, s_CenterX, s_CenterY, s_CenterZ);
+
+                    Vec s_Radius = TSimd::Zero();
+
+                    for (size_t a = 0; a < 3; ++a) {
+                        const Vec s_Projection = TSimd::Add(
+                            TSimd::Add(TSimd::Mul(s_Planes.x[j], s_Axes[a][0]), TSimd::Mul(s_Planes.y[j], s_Axes[a][1])),
+                            TSimd::Mul(s_Planes.z[j], s_Axes[a][2])
+                        );
+
+                        s_Radius = TSimd::Add(s_Radius, TSimd::Mul(TSimd::Abs(s_Projection), s_HalfSize[a]));
+                    }
+
+                    s_Outside = TSimd::Or(s_Outside, TSimd::CmpGt(TSimd::Sub(s_Distance, s_Radius), TSimd::Zero()));
+                }
+
+                StoreVisibility(p_Visibility, i, p_Count, s_Outside);
+            }
+        }
+    };
+
+    void ClearVisibility(uint64_t* p_Visibility, const size_t p_Count) {
+        std::fill_n(p_Visibility, FrustumCulling::GetVisibilityMaskSize(p_Count), 0ull);
+    }
+
+    std::atomic<bool> g_IsAvxEnabled = FrustumCulling::IsAvxSupported();
+}
+
+namespace FrustumCulling {
+    static EContainment Classify(const float p_PositiveExtentSum, const float p_NegativeExtentSum) {
+        if (p_NegativeExtentSum > 0.f) {
+            return EContainment::Outside;
+        }
+
+        constexpr float epsilon = 1.f / 4096.f;
+
+        return p_PositiveExtentSum <= epsilon ? EContainment::Inside : EContainment::Intersecting;
+    }
+
+    EContainment ClassifyPoint(const float* p_Planes, const float p_X, const float p_Y, const float p_Z) {
+        float positiveExtentSum = 0.f;
+        float negativeExtentSum = 0.f;
+
+        for (size_t i = 0; i < c_PlaneCount; ++i) {
+            const float* plane = p_Planes + i * 4;
+
+            const float distance =
+                    plane[0] * p_X +
+                    plane[1] * p_Y +
+                    plane[2] * p_Z +
+                    plane[3];
+
+            positiveExtentSum += std::max(distance, 0.0f);
+            negativeExtentSum += std::max(distance, 0.0f);
+        }
+
+        return Classify(positiveExtentSum, negativeExtentSum);
+    }
+
+    EContainment ClassifyAABB(const float* p_Planes, const float* p_Min, const float* p_Max) {
+        float positiveExtentSum = 0.f;
+        float negativeExtentSum = 0.f;
+
+        float center[3];
+        float halfSize[3];
+
+        for (size_t i = 0; i < 3; ++i) {
+            center[i] = (p_Min[i] + p_Max[i]) * 0.5f;
+            halfSize[i] = (p_Max[i] - p_Min[i]) * 0.5f;
+        }
+
+        for (size_t i = 0; i < c_PlaneCount; ++i) {
+            const float* plane = p_Planes + i * 4;
+
+            const float distance =
+                    plane[0] * center[0] +
+                    plane[1] * center[1] +
+                    plane[2] * center[2] +
+                    plane[3];
+
+            const float radius =
+                    std::fabs(plane[0]) * halfSize[0] +
+                    std::fabs(plane[1]) * halfSize[1] +
+                    std::fabs(plane[2]) * halfSize[2];
+
+            positiveExtentSum += std::max(distance + radius, 0.0f);
+            negativeExtentSum += std::max(distance - radius, 0.0f);
+        }
+
+        return Classify(positiveExtentSum, negativeExtentSum);
+    }
+
+    EContainment ClassifyOBB(
+        const float* p_Planes, const float* p_Center, const float* p_HalfSize, const float (&p_Axes)[3][3]
+    ) {
+        float positiveExtentSum = 0.f;
+        float negativeExtentSum = 0.f;
+
+        for (size_t i = 0; i < c_PlaneCount; ++i) {
+            const float* plane = p_Planes + i * 4;
+
+            const float distance =
+                    plane[0] * p_Center[0] +
+                    plane[1] * p_Center[1] +
+                    plane[2] * p_Center[2] +
+                    plane[3];
+
+            float radius = 0.f;
+
+            for (size_t axis = 0; axis < 3; ++axis) {
+                const float projection =
+                        plane[0] * p_Axes[axis][0] +
+                        plane[1] * p_Axes[axis][1] +
+                        plane[2] * p_Axes[axis][2];
+
+                radius += std::fabs(projection) * p_HalfSize[axis];
+            }
+
+            positiveExtentSum += std::max(distance + radius, 0.0f);
+            negativeExtentSum += std::max(distance - radius, 0.0f);
+        }
+
+        return Classify(positiveExtentSum, negativeExtentSum);
+    }
+
+    void CullPoints(
+        const float* p_Planes, const FrustumCullPoints& p_Points, const size_t p_Count, uint64_t* p_Visibility
+    ) {
+        ClearVisibility(p_Visibility, p_Count);
+
+        if (IsAvxEnabled()) {
+            Kernels<Avx>::CullPoints(p_Planes, p_Points, p_Count, p_Visibility);
+        }
+        else {
+            Kernels<Sse>::CullPoints(p_Planes, p_Points, p_Count, p_Visibility);
+        }
+    }
+
+    uint32_t CullPoints4(const float* p_Planes, const float* p_Points, const size_t p_Stride, const size_t p_Count) {
+        alignas(16) float s_X[4] = {};
+        alignas(16) float s_Y[4] = {};
+        alignas(16) float s_Z[4] = {};
+
+        const auto* s_Bytes = reinterpret_cast<const uint8_t*>(p_Points);
+
+        for (size_t i = 0; i < p_Count; ++i) {
+            const auto* s_Point = reinterpret_cast<const float*>(s_Bytes + i * p_Stride);
+
+            s_X[i] = s_Point[0];
+            s_Y[i] = s_Point[1];
+            s_Z[i] = s_Point[2];
+        }
+
+        const __m128 s_PointsX = _mm_load_ps(s_X);
+        const __m128 s_PointsY = _mm_load_ps(s_Y);
+        const __m128 s_PointsZ = _mm_load_ps(s_Z);
+        const __m128 s_Zero = _mm_setzero_ps();
+
+        // A point is outside the frustum if it's in front of any of its planes.
+        __m128 s_Outside = s_Zero;
+
+        for (size_t i = 0; i < c_PlaneCount; ++i) {
+            const float* s_Plane = p_Planes + i * 4;
+
+            // Same evaluation order as ClassifyPoint, so results match the scalar test exactly.
+            const __m128 s_Distance = _mm_add_ps(
+                _mm_add_ps(
+                    _mm_add_ps(
+                        _mm_mul_ps(_mm_set1_ps(s_Plane[0]), s_PointsX), _mm_mul_ps(_mm_set1_ps(s_Plane[1]), s_PointsY)
+                    ),
+                    _mm_mul_ps(_mm_set1_ps(s_Plane[2]), s_PointsZ)
+                ),
+                _mm_set1_ps(s_Plane[3])
+            );
+
+            s_Outside = _mm_or_ps(s_Outside, _mm_cmpgt_ps(s_Distance, s_Zero));
+        }
+
+        const uint32_t s_CountMask = (1u << p_Count) - 1;
+
+        return ~static_cast<uint32_t>(_mm_movemask_ps(s_Outside)) & s_CountMask;
+    }
+
+    void CullAABBs(
+        const float* p_Planes, const FrustumCullAABBs& p_AABBs, const size_t p_Count, uint64_t* p_Visibility
+    ) {
+        ClearVisibility(p_Visibility, p_Count);
+
+        if (IsAvxEnabled()) {
+            Kernels<Avx>::CullAABBs(p_Planes, p_AABBs, p_Count, p_Visibility);
+        }
+        else {
+            Kernels<Sse>::CullAABBs(p_Planes, p_AABBs, p_Count, p_Visibility);
+        }
+    }
+
+    void CullOBBs(const float* p_Planes, const FrustumCullOBBs& p_OBBs, const size_t p_Count, uint64_t* p_Visibility) {
+        ClearVisibility(p_Visibility, p_Count);
+
+        if (IsAvxEnabled()) {
+            Kernels<Avx>::CullOBBs(p_Planes, p_OBBs, p_Count, p_Visibility);
+        }
+        else {
+            Kernels<Sse>::CullOBBs(p_Planes, p_OBBs, p_Count, p_Visibility);
+        }
+    }
+
+    bool IsAvxSupported() {
+        static const bool s_IsSupported = []() {
+            int s_CpuInfo[4] = {};
+
+            __cpuid(s_CpuInfo, 1);
+
+            const bool s_HasOsXSave = (s_CpuInfo[2] & (1 << 27)) != 0;
+            const bool s_HasAvx = (s_CpuInfo[2] & (1 << 28)) != 0;
+
+            if (!s_HasOsXSave || !s_HasAvx) {
+                return false;
+            }
+
+            // Make sure the OS saves the YMM registers on context switches.
+            return (_xgetbv(0) & 0x6) == 0x6;
+        }();
+
+        return s_IsSupported;
+    }
+
+    void SetAvxEnabled(const bool p_Enabled) {
+        g_IsAvxEnabled = p_Enabled && IsAvxSupported();
+    }
+
+    bool IsAvxEnabled() {
+        return g_IsAvxEnabled.load(std::memory_order_relaxed);
+    }
+}
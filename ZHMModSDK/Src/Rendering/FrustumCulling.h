@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Structure-of-arrays views used for batch frustum culling.
+ * Every array must hold at least as many values as the number of primitives being tested.
+ */
+struct FrustumCullPoints {
+    const float* x;
+    const float* y;
+    const float* z;
+};
+
+struct FrustumCullAABBs {
+    const float* minX;
+    const float* minY;
+    const float* minZ;
+    const float* maxX;
+    const float* maxY;
+    const float* maxZ;
+};
+
+struct FrustumCullOBBs {
+    // World space center of each box.
+    const float* centerX;
+    const float* centerY;
+    const float* centerZ;
+
+    // Half size of each box along its own axes.
+    const float* halfSizeX;
+    const float* halfSizeY;
+    const float* halfSizeZ;
+
+    // World space axes of each box, indexed as axes[axis][component].
+    // For example, axes[0][2] holds the Z components of the X axes.
+    const float* axes[3][3];
+};
+
+/**
+ * Frustum culling tests. The planes are passed as 6 consecutive (x, y, z, w) tuples. A primitive is outside
+ * if it's entirely in front of any plane.
+ *
+ * The batch kernels test 4 (SSE) or 8 (AVX, when supported by the CPU) primitives against each plane at once
+ * and give the same results as the scalar tests. Visibility is written as a bitmask with one bit per primitive,
+ * so p_Visibility must hold at least (p_Count + 63) / 64 values.
+ */
+namespace FrustumCulling {
+    constexpr size_t c_PlaneCount = 6;
+
+    enum class EContainment {
+        Outside,
+        Intersecting,
+        Inside
+    };
+
+    constexpr size_t GetVisibilityMaskSize(const size_t p_Count) {
+        return (p_Count + 63) / 64;
+    }
+
+    EContainment ClassifyPoint(const float* p_Planes, float p_X, float p_Y, float p_Z);
+    EContainment ClassifyAABB(const float* p_Planes, const float* p_Min, const float* p_Max);
+
+    /**
+     * @param p_Center The world space center of the box.
+     * @param p_HalfSize The half size of the box along its own axes.
+     * @param p_Axes The world space axes of the box, indexed as p_Axes[axis][component].
+     */
+    EContainment ClassifyOBB(
+        const float* p_Planes, const float* p_Center, const float* p_HalfSize, const float (&p_Axes)[3][3]
+    );
+
+    void CullPoints(const float* p_Planes, const FrustumCullPoints& p_Points, size_t p_Count, uint64_t* p_Visibility);
+    void CullAABBs(const float* p_Planes, const FrustumCullAABBs& p_AABBs, size_t p_Count, uint64_t* p_Visibility);
+    void CullOBBs(const float* p_Planes, const FrustumCullOBBs& p_OBBs, size_t p_Count, uint64_t* p_Visibility);
+
+    /**
+     * Test up to 4 points that are p_Stride bytes apart, each starting with its x, y and z, against the planes at
+     * once. Returns a bitmask with bit N set if point N is inside. Backs ViewFrustum::ContainsPoints4.
+     */
+    uint32_t CullPoints4(const float* p_Planes, const float* p_Points, size_t p_Stride, size_t p_Count);
+
+    bool IsAvxSupported();
+
+    /**
+     * The AVX kernels are used whenever the CPU supports them. Tests and benchmarks can turn them off
+     * to run the SSE kernels instead.
+     */
+    void SetAvxEnabled(bool p_Enabled);
+    bool IsAvxEnabled();
+}
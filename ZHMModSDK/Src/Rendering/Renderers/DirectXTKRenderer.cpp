@@ -28,6 +28,8 @@
 #include "Glacier/ZGameLoopManager.h"
 #include "Glacier/MDF_FONT.h"
 
+#include <bit>
+
 using namespace Rendering::Renderers;
 
 DirectXTKRenderer::DirectXTKRenderer() {}
@@ -72,6 +74,12 @@ void DirectXTKRenderer::Draw() {
     m_LineBatch->End();
     m_TextBatch->End();
 
+    if (m_TextLayoutCacheClearRequested.exchange(false, std::memory_order_acq_rel)) {
+        m_TextLayoutCache.Clear();
+    }
+
+    m_TextLayoutCache.EndFrame();
+
     ID3D12DescriptorHeap* s_Heaps[] = {m_ResourceDescriptors->Heap()};
 
     m_CommandList->SetDescriptorHeaps(static_cast<UINT>(std::size(s_Heaps)), s_Heaps);
@@ -247,6 +255,8 @@ void DirectXTKRenderer::OnPresent(IDXGISwapChain3* p_SwapChain) {
         return;
     }
 
+    ReleaseRetiredStaticMeshes();
+
     // Get context of next frame to render.
     auto& s_FrameCtx = m_FrameContext[++m_FrameCounter % m_FrameContext.size()];
 
@@ -542,6 +552,9 @@ bool DirectXTKRenderer::SetupRenderer(IDXGISwapChain3* p_SwapChain) {
 
         MDF_FONT::Initialize();
 
+        // Layouts hold texture coordinates into the font atlas that was just rebuilt.
+        m_TextLayoutCache.Clear();
+
         m_CommonStates = std::make_unique<DirectX::CommonStates>(s_Device.Ref);
 
         m_TextEffect->SetTexture(
@@ -1397,34 +1410,19 @@ void DirectXTKRenderer::DrawText3D(
         return;
     }
 
-    int s_TextLength = 0;
-
-    while (p_Text[s_TextLength] && s_TextLength < 255) {
-        s_TextLength++;
-    }
+    const auto& s_Layout = m_TextLayoutCache.GetLayout(p_Text, p_HorizontalAlignment);
 
-    int s_PrintableCharacterCount = 0;
-    const char* p = p_Text;
-
-    while (*p) {
-        uint32_t cp = MDF_FONT::DecodeUTF8(p);
-
-        if (MDF_FONT::HasGlyph(cp)) {
-            ++s_PrintableCharacterCount;
-        }
+    if (s_Layout.m_Glyphs.empty()) {
+        return;
     }
 
-    MDF_FONT::STextBoundingBox s_TextBoundingBox;
-
-    MDF_FONT::CalcBoundingBox(s_TextBoundingBox, p_Text);
-
     float s_OffsetY = 0.f;
 
     if (p_VerticalAlignment == TextAlignment::Middle) {
-        s_OffsetY = -(s_TextBoundingBox.m_fMaxY - s_TextBoundingBox.m_fMinY) * 0.5f;
+        s_OffsetY = -s_Layout.m_Height * 0.5f;
     }
     else if (p_VerticalAlignment == TextAlignment::Bottom) {
-        s_OffsetY = -(s_TextBoundingBox.m_fMaxY - s_TextBoundingBox.m_fMinY);
+        s_OffsetY = -s_Layout.m_Height;
     }
 
     const float4 s_Translate = float4(0.f, s_OffsetY * p_Scale, 0.f, 1.f);
@@ -1439,93 +1437,84 @@ void DirectXTKRenderer::DrawText3D(
 
     s_FinalTransform = s_FinalTransform.AffineMultiply(s_OffsetMatrix);
 
-    std::vector<Triangle> s_Triangles;
+    DrawTextLayout3D(s_Layout, s_FinalTransform, p_Color);
+}
 
-    s_Triangles.reserve(2 * s_PrintableCharacterCount);
+void DirectXTKRenderer::DrawTextLayout3D(
+    const TextLayoutCache::TextLayout& p_Layout, const SMatrix& p_Transform, const SVector4& p_Color
+) {
+    // Each glyph is emitted as two triangles. We split very long texts into multiple
+    // submissions so we never go over the vertex limit of a single batch.
+    constexpr size_t c_VerticesPerGlyph = 6;
+    constexpr size_t c_MaxGlyphsPerSubmission = 512;
 
-    std::istringstream s_InputStringStream(p_Text);
-    std::string s_Line;
-    int s_LineIndex = 0;
+    // Glyphs are transformed up front so the ones outside of the view frustum can be skipped before
+    // reserving space in the batch. Like with DrawTriangle3D, a glyph is only culled if all of its corners are outside.
+    m_TextGlyphCorners.clear();
+    m_VisibleTextGlyphs.clear();
 
-    while (std::getline(s_InputStringStream, s_Line))
-    {
-        MDF_FONT::STextBoundingBox s_TextBoundingBox2;
+    for (size_t i = 0; i < p_Layout.m_Glyphs.size(); ++i) {
+        const float* s_Positions = p_Layout.m_Glyphs[i].m_Positions;
 
-        MDF_FONT::CalcBoundingBox(s_TextBoundingBox2, s_Line.c_str());
+        // Glyphs are laid out on the local XZ plane.
+        SVector3 s_Corners[4];
 
-        float s_OffsetX = 0.f;
+        for (size_t j = 0; j < 4; ++j) {
+            const float4 s_Corner = p_Transform.WVectorTransform(
+                float4(s_Positions[j * 2], 0.f, s_Positions[j * 2 + 1], 1.f)
+            );
 
-        if (p_HorizontalAlignment == TextAlignment::Center) {
-            s_OffsetX = -(s_TextBoundingBox2.m_fMaxX - s_TextBoundingBox2.m_fMinX) * 0.5f;
+            s_Corners[j] = SVector3(s_Corner.x, s_Corner.y, s_Corner.z);
         }
-        else if (p_HorizontalAlignment == TextAlignment::Right) {
-            s_OffsetX = -(s_TextBoundingBox2.m_fMaxX - s_TextBoundingBox2.m_fMinX);
-        }
-
-        float s_PenX = s_OffsetX;
-        float s_PenY = -(s_LineIndex * MDF_FONT::g_LineHeight);
 
-        const char* p = s_Line.c_str();
-
-        while (*p) {
-            uint32_t s_Codepoint = MDF_FONT::DecodeUTF8(p);
+        if (m_IsFrustumCullingEnabled && m_ViewFrustum.ContainsPoints4(s_Corners, sizeof(SVector3), 4) == 0) {
+            continue;
+        }
 
-            if (s_Codepoint == ' ') {
-                s_PenX += MDF_FONT::GetAdvanceWidth(s_Codepoint);
-                continue;
-            }
+        m_VisibleTextGlyphs.push_back(static_cast<uint32_t>(i));
+        m_TextGlyphCorners.insert(m_TextGlyphCorners.end(), std::begin(s_Corners), std::end(s_Corners));
+    }
 
-            if (!MDF_FONT::HasGlyph(s_Codepoint)) {
-                continue;
-            }
+    const DirectX::SimpleMath::Vector4 s_Color(p_Color.x, p_Color.y, p_Color.z, p_Color.w);
 
-            float s_Vertices[8];
-            float s_TextureCoordinates[8];
+    for (size_t s_First = 0; s_First < m_VisibleTextGlyphs.size(); s_First += c_MaxGlyphsPerSubmission) {
+        const size_t s_GlyphCount = std::min(c_MaxGlyphsPerSubmission, m_VisibleTextGlyphs.size() - s_First);
 
-            MDF_FONT::RenderQuad(s_Codepoint, 1.0f, s_PenX, s_PenY, s_Vertices, s_TextureCoordinates);
+        DirectX::VertexPositionColorTexture* s_MappedVertices;
 
-            float4 s_BottomLeft = float4(s_Vertices[0], 0.f, s_Vertices[1], 1.f);
-            float4 s_BottomRight = float4(s_Vertices[2], 0.f, s_Vertices[3], 1.f);
-            float4 s_TopRight = float4(s_Vertices[4], 0.f, s_Vertices[5], 1.f);
-            float4 s_TopLeft = float4(s_Vertices[6], 0.f, s_Vertices[7], 1.f);
+        m_TextBatch->Draw(
+            D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST, false, nullptr, 0, s_GlyphCount * c_VerticesPerGlyph,
+            reinterpret_cast<void**>(&s_MappedVertices)
+        );
 
-            s_BottomLeft = s_FinalTransform.WVectorTransform(s_BottomLeft);
-            s_BottomRight = s_FinalTransform.WVectorTransform(s_BottomRight);
-            s_TopRight = s_FinalTransform.WVectorTransform(s_TopRight);
-            s_TopLeft = s_FinalTransform.WVectorTransform(s_TopLeft);
+        for (size_t i = 0; i < s_GlyphCount; ++i) {
+            const auto& s_Glyph = p_Layout.m_Glyphs[m_VisibleTextGlyphs[s_First + i]];
+            const float* s_TextureCoordinates = s_Glyph.m_TextureCoordinates;
+            const SVector3* s_GlyphCorners = &m_TextGlyphCorners[(s_First + i) * 4];
 
-            Triangle& s_Triangle1 = s_Triangles.emplace_back();
-            Triangle& s_Triangle2 = s_Triangles.emplace_back();
+            DirectX::SimpleMath::Vector3 s_Corners[4];
 
-            s_Triangle1.vertexPosition1 = {s_BottomLeft.x, s_BottomLeft.y, s_BottomLeft.z};
-            s_Triangle1.vertexPosition2 = {s_BottomRight.x, s_BottomRight.y, s_BottomRight.z};
-            s_Triangle1.vertexPosition3 = {s_TopLeft.x, s_TopLeft.y, s_TopLeft.z};
+            for (size_t j = 0; j < 4; ++j) {
+                s_Corners[j] = DirectX::SimpleMath::Vector3(
+                    s_GlyphCorners[j].x, s_GlyphCorners[j].y, s_GlyphCorners[j].z
+                );
+            }
 
-            s_Triangle2.vertexPosition1 = {s_BottomRight.x, s_BottomRight.y, s_BottomRight.z};
-            s_Triangle2.vertexPosition2 = {s_TopRight.x, s_TopRight.y, s_TopRight.z};
-            s_Triangle2.vertexPosition3 = {s_TopLeft.x, s_TopLeft.y, s_TopLeft.z};
+            const DirectX::SimpleMath::Vector2 s_BottomLeftUV(s_TextureCoordinates[0], s_TextureCoordinates[1]);
+            const DirectX::SimpleMath::Vector2 s_BottomRightUV(s_TextureCoordinates[2], s_TextureCoordinates[3]);
+            const DirectX::SimpleMath::Vector2 s_TopRightUV(s_TextureCoordinates[4], s_TextureCoordinates[5]);
+            const DirectX::SimpleMath::Vector2 s_TopLeftUV(s_TextureCoordinates[6], s_TextureCoordinates[7]);
 
-            s_Triangle1.vertexColor1 = s_Triangle1.vertexColor2 = s_Triangle1.vertexColor3 = p_Color;
-            s_Triangle2.vertexColor1 = s_Triangle2.vertexColor2 = s_Triangle2.vertexColor3 = p_Color;
+            auto* s_Vertices = s_MappedVertices + i * c_VerticesPerGlyph;
 
-            s_Triangle1.textureCoordinates1 = { s_TextureCoordinates[0], s_TextureCoordinates[1] };
-            s_Triangle1.textureCoordinates2 = { s_TextureCoordinates[2], s_TextureCoordinates[3] };
-            s_Triangle1.textureCoordinates3 = { s_TextureCoordinates[6], s_TextureCoordinates[7] };
+            s_Vertices[0] = DirectX::VertexPositionColorTexture(s_Corners[0], s_Color, s_BottomLeftUV);
+            s_Vertices[1] = DirectX::VertexPositionColorTexture(s_Corners[1], s_Color, s_BottomRightUV);
+            s_Vertices[2] = DirectX::VertexPositionColorTexture(s_Corners[3], s_Color, s_TopLeftUV);
 
-            s_Triangle2.textureCoordinates1 = { s_TextureCoordinates[2], s_TextureCoordinates[3] };
-            s_Triangle2.textureCoordinates2 = { s_TextureCoordinates[4], s_TextureCoordinates[5] };
-            s_Triangle2.textureCoordinates3 = { s_TextureCoordinates[6], s_TextureCoordinates[7] };
+            s_Vertices[3] = DirectX::VertexPositionColorTexture(s_Corners[1], s_Color, s_BottomRightUV);
+            s_Vertices[4] = DirectX::VertexPositionColorTexture(s_Corners[2], s_Color, s_TopRightUV);
+            s_Vertices[5] = DirectX::VertexPositionColorTexture(s_Corners[3], s_Color, s_TopLeftUV);
         }
-
-        s_LineIndex++;
-    }
-
-    for (auto& s_Triangle : s_Triangles) {
-        DrawTriangle3D(
-            s_Triangle.vertexPosition1, s_Triangle.vertexColor1, s_Triangle.textureCoordinates1,
-            s_Triangle.vertexPosition2, s_Triangle.vertexColor2, s_Triangle.textureCoordinates2,
-            s_Triangle.vertexPosition3, s_Triangle.vertexColor3, s_Triangle.textureCoordinates3
-        );
     }
 }
 
@@ -1625,6 +1614,470 @@ void DirectXTKRenderer::DrawMesh(
     m_CommandList->DrawIndexedInstanced(s_IndexCount, 1, 0, 0, 0);
 }
 
+template <typename T>
+size_t DirectXTKRenderer::CullPrimitiveBlocks(const size_t p_Count, uint8_t* p_Masks, T&& p_CullBlock) const {
+    size_t s_VisibleCount = 0;
+
+    for (size_t i = 0; i < p_Count; i += 4) {
+        const size_t s_BlockCount = std::min<size_t>(4, p_Count - i);
+        const uint32_t s_Mask = m_IsFrustumCullingEnabled
+                                    ? p_CullBlock(i, s_BlockCount)
+                                    : (1u << s_BlockCount) - 1;
+
+        p_Masks[i / 4] = static_cast<uint8_t>(s_Mask);
+        s_VisibleCount += std::popcount(s_Mask);
+    }
+
+    return s_VisibleCount;
+}
+
+// Number of primitives we cull and submit at once. Needs to stay below the vertex limit of the primitive batches.
+static constexpr size_t c_BulkPrimitiveChunkSize = 1024;
+
+void DirectXTKRenderer::DrawLines3D(std::span<const Line> p_Lines) {
+    uint8_t s_Masks[c_BulkPrimitiveChunkSize / 4];
+
+    for (size_t s_ChunkStart = 0; s_ChunkStart < p_Lines.size(); s_ChunkStart += c_BulkPrimitiveChunkSize) {
+        const auto s_Chunk = p_Lines.subspan(
+            s_ChunkStart, std::min(c_BulkPrimitiveChunkSize, p_Lines.size() - s_ChunkStart)
+        );
+
+        // A line is visible if either of its endpoints is inside the frustum.
+        const size_t s_VisibleCount = CullPrimitiveBlocks(
+            s_Chunk.size(), s_Masks, [&](const size_t p_First, const size_t p_Count) {
+                return m_ViewFrustum.ContainsPoints4(&s_Chunk[p_First].start, sizeof(Line), p_Count) |
+                    m_ViewFrustum.ContainsPoints4(&s_Chunk[p_First].end, sizeof(Line), p_Count);
+            }
+        );
+
+        if (s_VisibleCount == 0) {
+            continue;
+        }
+
+        void* s_MappedVertices = nullptr;
+        m_LineBatch->Draw(D3D_PRIMITIVE_TOPOLOGY_LINELIST, false, nullptr, 0, s_VisibleCount * 2, &s_MappedVertices);
+
+        auto* s_Vertex = static_cast<DirectX::VertexPositionColor*>(s_MappedVertices);
+
+        for (size_t i = 0; i < s_Chunk.size(); ++i) {
+            if (!(s_Masks[i / 4] & (1u << (i % 4)))) {
+                continue;
+            }
+
+            const Line& s_Line = s_Chunk[i];
+
+            *s_Vertex++ = DirectX::VertexPositionColor(
+                DirectX::SimpleMath::Vector3(s_Line.start.x, s_Line.start.y, s_Line.start.z),
+                DirectX::SimpleMath::Vector4(
+                    s_Line.startColor.x, s_Line.startColor.y, s_Line.startColor.z, s_Line.startColor.w
+                )
+            );
+            *s_Vertex++ = DirectX::VertexPositionColor(
+                DirectX::SimpleMath::Vector3(s_Line.end.x, s_Line.end.y, s_Line.end.z),
+                DirectX::SimpleMath::Vector4(
+                    s_Line.endColor.x, s_Line.endColor.y, s_Line.endColor.z, s_Line.endColor.w
+                )
+            );
+        }
+    }
+}
+
+void DirectXTKRenderer::DrawTriangles3D(std::span<const Triangle> p_Triangles) {
+    uint8_t s_Masks[c_BulkPrimitiveChunkSize / 4];
+
+    for (size_t s_ChunkStart = 0; s_ChunkStart < p_Triangles.size(); s_ChunkStart += c_BulkPrimitiveChunkSize) {
+        const auto s_Chunk = p_Triangles.subspan(
+            s_ChunkStart, std::min(c_BulkPrimitiveChunkSize, p_Triangles.size() - s_ChunkStart)
+        );
+
+        // A triangle is visible if any of its vertices is inside the frustum.
+        const size_t s_VisibleCount = CullPrimitiveBlocks(
+            s_Chunk.size(), s_Masks, [&](const size_t p_First, const size_t p_Count) {
+                const Triangle& s_First = s_Chunk[p_First];
+
+                return m_ViewFrustum.ContainsPoints4(&s_First.vertexPosition1, sizeof(Triangle), p_Count) |
+                    m_ViewFrustum.ContainsPoints4(&s_First.vertexPosition2, sizeof(Triangle), p_Count) |
+                    m_ViewFrustum.ContainsPoints4(&s_First.vertexPosition3, sizeof(Triangle), p_Count);
+            }
+        );
+
+        if (s_VisibleCount == 0) {
+            continue;
+        }
+
+        void* s_MappedVertices = nullptr;
+        m_TriangleBatch->Draw(
+            D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST, false, nullptr, 0, s_VisibleCount * 3, &s_MappedVertices
+        );
+
+        auto* s_Vertex = static_cast<DirectX::VertexPositionColor*>(s_MappedVertices);
+
+        for (size_t i = 0; i < s_Chunk.size(); ++i) {
+            if (!(s_Masks[i / 4] & (1u << (i % 4)))) {
+                continue;
+            }
+
+            const Triangle& s_Triangle = s_Chunk[i];
+
+            *s_Vertex++ = DirectX::VertexPositionColor(
+                DirectX::SimpleMath::Vector3(
+                    s_Triangle.vertexPosition1.x, s_Triangle.vertexPosition1.y, s_Triangle.vertexPosition1.z
+                ),
+                DirectX::SimpleMath::Vector4(
+                    s_Triangle.vertexColor1.x, s_Triangle.vertexColor1.y,
+                    s_Triangle.vertexColor1.z, s_Triangle.vertexColor1.w
+                )
+            );
+            *s_Vertex++ = DirectX::VertexPositionColor(
+                DirectX::SimpleMath::Vector3(
+                    s_Triangle.vertexPosition2.x, s_Triangle.vertexPosition2.y, s_Triangle.vertexPosition2.z
+                ),
+                DirectX::SimpleMath::Vector4(
+                    s_Triangle.vertexColor2.x, s_Triangle.vertexColor2.y,
+                    s_Triangle.vertexColor2.z, s_Triangle.vertexColor2.w
+                )
+            );
+            *s_Vertex++ = DirectX::VertexPositionColor(
+                DirectX::SimpleMath::Vector3(
+                    s_Triangle.vertexPosition3.x, s_Triangle.vertexPosition3.y, s_Triangle.vertexPosition3.z
+                ),
+                DirectX::SimpleMath::Vector4(
+                    s_Triangle.vertexColor3.x, s_Triangle.vertexColor3.y,
+                    s_Triangle.vertexColor3.z, s_Triangle.vertexColor3.w
+                )
+            );
+        }
+    }
+}
+
+void DirectXTKRenderer::DrawIndexedTriangles3D(
+    std::span<const ColoredVertex> p_Vertices, std::span<const uint32_t> p_Indices
+) {
+    const size_t s_TriangleCount = p_Indices.size() / 3;
+    const auto s_TriangleIndices = p_Indices.first(s_TriangleCount * 3);
+
+    // The indices are used to read p_Vertices without further checks, so they're all validated up front.
+    if (!s_TriangleIndices.empty() && *std::ranges::max_element(s_TriangleIndices) >= p_Vertices.size()) {
+        Logger::Error("Could not draw indexed triangles: index out of range.");
+        return;
+    }
+
+    uint8_t s_Masks[c_BulkPrimitiveChunkSize / 4];
+
+    for (size_t s_ChunkStart = 0; s_ChunkStart < s_TriangleCount; s_ChunkStart += c_BulkPrimitiveChunkSize) {
+        const size_t s_ChunkSize = std::min(c_BulkPrimitiveChunkSize, s_TriangleCount - s_ChunkStart);
+        const uint32_t* s_ChunkIndices = p_Indices.data() + s_ChunkStart * 3;
+
+        const size_t s_VisibleCount = CullPrimitiveBlocks(
+            s_ChunkSize, s_Masks, [&](const size_t p_First, const size_t p_Count) {
+                // Gather the corners of the block so they can be tested together.
+                SVector3 s_Corners[3][4];
+
+                for (size_t i = 0; i < p_Count; ++i) {
+                    for (size_t j = 0; j < 3; ++j) {
+                        s_Corners[j][i] = p_Vertices[s_ChunkIndices[(p_First + i) * 3 + j]].position;
+                    }
+                }
+
+                return m_ViewFrustum.ContainsPoints4(s_Corners[0], sizeof(SVector3), p_Count) |
+                    m_ViewFrustum.ContainsPoints4(s_Corners[1], sizeof(SVector3), p_Count) |
+                    m_ViewFrustum.ContainsPoints4(s_Corners[2], sizeof(SVector3), p_Count);
+            }
+        );
+
+        if (s_VisibleCount == 0) {
+            continue;
+        }
+
+        void* s_MappedVertices = nullptr;
+        m_TriangleBatch->Draw(
+            D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST, false, nullptr, 0, s_VisibleCount * 3, &s_MappedVertices
+        );
+
+        auto* s_Vertex = static_cast<DirectX::VertexPositionColor*>(s_MappedVertices);
+
+        for (size_t i = 0; i < s_ChunkSize; ++i) {
+            if (!(s_Masks[i / 4] & (1u << (i % 4)))) {
+                continue;
+            }
+
+            for (size_t j = 0; j < 3; ++j) {
+                const ColoredVertex& s_Source = p_Vertices[s_ChunkIndices[i * 3 + j]];
+
+                *s_Vertex++ = DirectX::VertexPositionColor(
+                    DirectX::SimpleMath::Vector3(s_Source.position.x, s_Source.position.y, s_Source.position.z),
+                    DirectX::SimpleMath::Vector4(
+                        s_Source.color.x, s_Source.color.y, s_Source.color.z, s_Source.color.w
+                    )
+                );
+            }
+        }
+    }
+}
+
+StaticMeshHandle DirectXTKRenderer::CreateStaticMesh(
+    std::span<const ColoredVertex> p_Vertices, std::span<const uint32_t> p_Indices, const StaticMeshTopology p_Topology
+) {
+    if (p_Vertices.empty() || p_Indices.empty()) {
+        return StaticMeshHandle::Invalid;
+    }
+
+    auto s_Mesh = std::make_unique<StaticMesh>();
+    s_Mesh->m_Topology = p_Topology;
+
+    const uint32_t s_IndicesPerPrimitive = p_Topology == StaticMeshTopology::Lines ? 2 : 3;
+
+    if (!s_Mesh->m_Chunks.Build(p_Vertices, p_Indices, s_IndicesPerPrimitive, s_Mesh->m_Indices)) {
+        Logger::Error("Could not create static mesh: index out of range.");
+        return StaticMeshHandle::Invalid;
+    }
+
+    s_Mesh->m_Vertices.reserve(p_Vertices.size());
+
+    for (const ColoredVertex& s_Vertex : p_Vertices) {
+        s_Mesh->m_Vertices.emplace_back(
+            DirectX::SimpleMath::Vector3(s_Vertex.position.x, s_Vertex.position.y, s_Vertex.position.z),
+            DirectX::SimpleMath::Vector4(s_Vertex.color.x, s_Vertex.color.y, s_Vertex.color.z, s_Vertex.color.w)
+        );
+    }
+
+    s_Mesh->m_VertexCount = static_cast<uint32_t>(s_Mesh->m_Vertices.size());
+    s_Mesh->m_IndexCount = static_cast<uint32_t>(s_Mesh->m_Indices.size());
+
+    std::scoped_lock s_Lock(m_StaticMeshMutex);
+
+    const uint32_t s_Id = m_NextStaticMeshId++;
+    m_StaticMeshes.emplace(s_Id, std::move(s_Mesh));
+
+    return static_cast<StaticMeshHandle>(s_Id);
+}
+
+void DirectXTKRenderer::UpdateStaticMeshColors(
+    const StaticMeshHandle p_Mesh, const size_t p_FirstVertex, std::span<const SVector4> p_Colors
+) {
+    std::scoped_lock s_Lock(m_StaticMeshMutex);
+
+    const auto s_Iterator = m_StaticMeshes.find(static_cast<uint32_t>(p_Mesh));
+
+    if (s_Iterator == m_StaticMeshes.end()) {
+        return;
+    }
+
+    StaticMesh& s_Mesh = *s_Iterator->second;
+
+    if (p_FirstVertex >= s_Mesh.m_VertexCount) {
+        return;
+    }
+
+    const size_t s_Count = std::min(p_Colors.size(), s_Mesh.m_VertexCount - p_FirstVertex);
+
+    // Frames that are still in flight may be reading the current vertex buffer, so only the CPU copy is changed
+    // here. The next draw copies it into the next vertex buffer of the mesh.
+    for (size_t i = 0; i < s_Count; ++i) {
+        const SVector4& s_Color = p_Colors[i];
+        s_Mesh.m_Vertices[p_FirstVertex + i].color = DirectX::XMFLOAT4(s_Color.x, s_Color.y, s_Color.z, s_Color.w);
+    }
+
+    s_Mesh.m_VerticesDirty = true;
+}
+
+void DirectXTKRenderer::DrawStaticMesh(const StaticMeshHandle p_Mesh) {
+    std::scoped_lock s_Lock(m_StaticMeshMutex);
+
+    const auto s_Iterator = m_StaticMeshes.find(static_cast<uint32_t>(p_Mesh));
+
+    if (s_Iterator == m_StaticMeshes.end()) {
+        return;
+    }
+
+    StaticMesh& s_Mesh = *s_Iterator->second;
+
+    if (s_Mesh.m_VerticesDirty || !s_Mesh.m_VertexBuffers[s_Mesh.m_CurrentVertexBuffer].m_Buffer) {
+        UploadStaticMesh(s_Mesh);
+    }
+
+    StaticMeshVertexBuffer& s_VertexBuffer = s_Mesh.m_VertexBuffers[s_Mesh.m_CurrentVertexBuffer];
+
+    if (!s_VertexBuffer.m_Buffer) {
+        return;
+    }
+
+    const size_t s_ChunkCount = s_Mesh.m_Chunks.GetChunks().size();
+
+    if (m_IsFrustumCullingEnabled) {
+        m_StaticMeshChunkVisibility.resize(FrustumCulling::GetVisibilityMaskSize(s_ChunkCount));
+        m_ViewFrustum.ContainsAABBs(
+            s_Mesh.m_Chunks.GetChunkBounds(), s_ChunkCount, m_StaticMeshChunkVisibility.data()
+        );
+    }
+    else {
+        m_StaticMeshChunkVisibility.assign(FrustumCulling::GetVisibilityMaskSize(s_ChunkCount), ~0ull);
+    }
+
+    s_Mesh.m_Chunks.GetVisibleRanges(m_StaticMeshChunkVisibility.data(), m_StaticMeshDrawRanges);
+
+    if (m_StaticMeshDrawRanges.empty()) {
+        return;
+    }
+
+    if (s_Mesh.m_Topology == StaticMeshTopology::Lines) {
+        m_LineEffect->Apply(m_CommandList);
+        m_CommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_LINELIST);
+    }
+    else {
+        m_TriangleEffect->Apply(m_CommandList);
+        m_CommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    }
+
+    D3D12_VERTEX_BUFFER_VIEW s_VertexBufferView;
+    s_VertexBufferView.BufferLocation = s_VertexBuffer.m_Buffer->GetGPUVirtualAddress();
+    s_VertexBufferView.SizeInBytes = s_Mesh.m_VertexCount * sizeof(DirectX::VertexPositionColor);
+    s_VertexBufferView.StrideInBytes = sizeof(DirectX::VertexPositionColor);
+
+    D3D12_INDEX_BUFFER_VIEW s_IndexBufferView;
+    s_IndexBufferView.BufferLocation = s_Mesh.m_IndexBuffer->GetGPUVirtualAddress();
+    s_IndexBufferView.SizeInBytes = s_Mesh.m_IndexCount * sizeof(uint32_t);
+    s_IndexBufferView.Format = DXGI_FORMAT_R32_UINT;
+
+    m_CommandList->IASetVertexBuffers(0, 1, &s_VertexBufferView);
+    m_CommandList->IASetIndexBuffer(&s_IndexBufferView);
+
+    for (const auto& s_Range : m_StaticMeshDrawRanges) {
+        m_CommandList->DrawIndexedInstanced(s_Range.m_IndexCount, 1, s_Range.m_FirstIndex, 0, 0);
+    }
+
+    // The frame that is currently being recorded will be signaled with the next fence value.
+    s_VertexBuffer.m_LastUsedFenceValue = m_FenceValue + 1;
+}
+
+void DirectXTKRenderer::DestroyStaticMesh(const StaticMeshHandle p_Mesh) {
+    std::scoped_lock s_Lock(m_StaticMeshMutex);
+
+    const auto s_Iterator = m_StaticMeshes.find(static_cast<uint32_t>(p_Mesh));
+
+    if (s_Iterator == m_StaticMeshes.end()) {
+        return;
+    }
+
+    // The frame that is currently being recorded will be signaled with the next fence value,
+    // so the mesh can only be released once that one has completed.
+    m_RetiredStaticMeshes.emplace_back(m_FenceValue + 1, std::move(s_Iterator->second));
+    m_StaticMeshes.erase(s_Iterator);
+}
+
+bool DirectXTKRenderer::UploadStaticMesh(StaticMesh& p_Mesh) {
+    // The buffers live in an upload heap. Debug geometry is small enough that reading it over PCIe is fine,
+    // and it saves us from any copy queue work.
+    if (!p_Mesh.m_IndexBuffer) {
+        p_Mesh.m_IndexBuffer = CreateStaticMeshBuffer(
+            p_Mesh.m_Indices.data(), p_Mesh.m_Indices.size() * sizeof(uint32_t), "ZHMModSDK Static Mesh Index Buffer"
+        );
+
+        if (!p_Mesh.m_IndexBuffer) {
+            return false;
+        }
+
+        p_Mesh.m_Indices.clear();
+        p_Mesh.m_Indices.shrink_to_fit();
+    }
+
+    size_t s_NextVertexBuffer = p_Mesh.m_CurrentVertexBuffer;
+
+    if (p_Mesh.m_VertexBuffers[s_NextVertexBuffer].m_Buffer) {
+        s_NextVertexBuffer = (s_NextVertexBuffer + 1) % p_Mesh.m_VertexBuffers.size();
+
+        // Frames in flight might still be reading the next buffer. The mesh keeps its old colors until a later
+        // draw finds the buffer free.
+        if (p_Mesh.m_VertexBuffers[s_NextVertexBuffer].m_LastUsedFenceValue > m_Fence->GetCompletedValue()) {
+            return false;
+        }
+    }
+
+    StaticMeshVertexBuffer& s_VertexBuffer = p_Mesh.m_VertexBuffers[s_NextVertexBuffer];
+    const size_t s_VertexDataSize = p_Mesh.m_Vertices.size() * sizeof(DirectX::VertexPositionColor);
+
+    if (s_VertexBuffer.m_Buffer) {
+        memcpy(s_VertexBuffer.m_MappedData, p_Mesh.m_Vertices.data(), s_VertexDataSize);
+    }
+    else {
+        s_VertexBuffer.m_Buffer = CreateStaticMeshBuffer(
+            p_Mesh.m_Vertices.data(), s_VertexDataSize, "ZHMModSDK Static Mesh Vertex Buffer",
+            &s_VertexBuffer.m_MappedData
+        );
+
+        if (!s_VertexBuffer.m_Buffer) {
+            return false;
+        }
+    }
+
+    p_Mesh.m_CurrentVertexBuffer = s_NextVertexBuffer;
+    p_Mesh.m_VerticesDirty = false;
+
+    return true;
+}
+
+ScopedD3DRef<ID3D12Resource> DirectXTKRenderer::CreateStaticMeshBuffer(
+    const void* p_Data, const size_t p_Size, const char* p_Name, void** p_MappedData
+) {
+    ScopedD3DRef<ID3D12Device> s_Device;
+
+    if (m_SwapChain->GetDevice(REF_IID_PPV_ARGS(s_Device)) != S_OK) {
+        return {};
+    }
+
+    const CD3DX12_HEAP_PROPERTIES s_HeapProperties(D3D12_HEAP_TYPE_UPLOAD);
+    const CD3DX12_RESOURCE_DESC s_BufferDesc = CD3DX12_RESOURCE_DESC::Buffer(p_Size);
+    const CD3DX12_RANGE s_ReadRange(0, 0);
+
+    ScopedD3DRef<ID3D12Resource> s_Buffer;
+
+    if (FAILED(
+        s_Device->CreateCommittedResource(
+            &s_HeapProperties, D3D12_HEAP_FLAG_NONE, &s_BufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ,
+            nullptr, IID_PPV_ARGS(s_Buffer.ReleaseAndGetPtr())
+        )
+    )) {
+        Logger::Error("Could not create buffer for static mesh.");
+        return {};
+    }
+
+    void* s_MappedData = nullptr;
+
+    if (FAILED(s_Buffer->Map(0, &s_ReadRange, &s_MappedData))) {
+        Logger::Error("Could not map buffer for static mesh.");
+        return {};
+    }
+
+    memcpy(s_MappedData, p_Data, p_Size);
+
+    if (p_MappedData) {
+        *p_MappedData = s_MappedData;
+    }
+    else {
+        s_Buffer->Unmap(0, nullptr);
+    }
+
+    D3D_SET_OBJECT_NAME_A(s_Buffer, p_Name);
+
+    return s_Buffer;
+}
+
+void DirectXTKRenderer::ReleaseRetiredStaticMeshes() {
+    std::scoped_lock s_Lock(m_StaticMeshMutex);
+
+    if (m_RetiredStaticMeshes.empty()) {
+        return;
+    }
+
+    const uint64_t s_CompletedFenceValue = m_Fence->GetCompletedValue();
+
+    std::erase_if(
+        m_RetiredStaticMeshes, [s_CompletedFenceValue](const auto& p_Pair) {
+            return p_Pair.first <= s_CompletedFenceValue;
+        }
+    );
+}
+
 bool DirectXTKRenderer::IsPointInsideViewFrustum(const SVector3& p_Point) const {
     return m_ViewFrustum.ContainsPoint(p_Point);
 }
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <directx/d3d12.h>
 #include <dxgi1_4.h>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include <GraphicsMemory.h>
 
@@ -19,6 +23,8 @@
 
 #include "../DebugEffect.h"
 #include "Rendering/ViewFrustum.h"
+#include "Rendering/TextLayoutCache.h"
+#include "Rendering/StaticMeshChunks.h"
 #include "../CustomPrimitiveBatch.h"
 
 class SGameUpdateEvent;
@@ -31,6 +37,39 @@ namespace Rendering::Renderers {
             volatile uint64_t FenceValue = 0;
         };
 
+        struct StaticMeshVertexBuffer {
+            ScopedD3DRef<ID3D12Resource> m_Buffer;
+
+            // Upload heap buffers can stay mapped for their whole lifetime.
+            void* m_MappedData = nullptr;
+
+            // Fence value of the last frame that draws from this buffer.
+            uint64_t m_LastUsedFenceValue = 0;
+        };
+
+        struct StaticMesh {
+            static constexpr size_t c_VertexBufferCount = 3;
+
+            StaticMeshTopology m_Topology = StaticMeshTopology::Triangles;
+            StaticMeshChunks m_Chunks;
+            uint32_t m_VertexCount = 0;
+            uint32_t m_IndexCount = 0;
+
+            // CPU copies of the geometry. The indices are released once the mesh has been uploaded. The vertices
+            // are kept, since color updates are applied to them and then copied into the next vertex buffer.
+            std::vector<DirectX::VertexPositionColor> m_Vertices;
+            std::vector<uint32_t> m_Indices;
+
+            // A small ring of vertex buffers. Color updates are copied into the next one once the GPU is done with
+            // it, so changing colors never allocates after the ring has been filled.
+            std::array<StaticMeshVertexBuffer, c_VertexBufferCount> m_VertexBuffers;
+            size_t m_CurrentVertexBuffer = 0;
+            ScopedD3DRef<ID3D12Resource> m_IndexBuffer;
+
+            // Set when the colors have changed since the vertex buffer was uploaded.
+            bool m_VerticesDirty = false;
+        };
+
         enum class Descriptors : int {
             FontRegular,
             FontBold,
@@ -70,6 +109,12 @@ namespace Rendering::Renderers {
         void SetDepthBuffer(ID3D12Resource* p_DepthResource) { m_DepthBufferResource = p_DepthResource; }
         void ClearDepthBuffer() { m_DepthBufferResource = nullptr; }
 
+        /**
+         * Drop all cached text layouts. Safe to call from any thread,
+         * the cache is cleared at the end of the next frame.
+         */
+        void ClearTextLayoutCache() { m_TextLayoutCacheClearRequested.store(true, std::memory_order_release); }
+
     private:
         void OnFrameUpdate(const SGameUpdateEvent& p_UpdateEvent);
         bool SetupRenderer(IDXGISwapChain3* p_SwapChain);
@@ -84,6 +129,26 @@ namespace Rendering::Renderers {
         bool CreateFontDistanceFieldTexture();
 
         void DrawText2D(const Text2D& p_Text2D);
+        void DrawTextLayout3D(
+            const TextLayoutCache::TextLayout& p_Layout, const SMatrix& p_Transform, const SVector4& p_Color
+        );
+
+        /**
+         * Cull primitives in blocks of 4 and store one visibility bitmask per block.
+         * @param p_Count The number of primitives.
+         * @param p_Masks Output array, must hold at least (p_Count + 3) / 4 masks.
+         * @param p_CullBlock Callable taking (first primitive index, primitive count) and returning the visibility
+         *                    bitmask for that block.
+         * @return The number of visible primitives.
+         */
+        template <typename T>
+        size_t CullPrimitiveBlocks(size_t p_Count, uint8_t* p_Masks, T&& p_CullBlock) const;
+
+        bool UploadStaticMesh(StaticMesh& p_Mesh);
+        ScopedD3DRef<ID3D12Resource> CreateStaticMeshBuffer(
+            const void* p_Data, size_t p_Size, const char* p_Name, void** p_MappedData = nullptr
+        );
+        void ReleaseRetiredStaticMeshes();
 
     public:
         bool WorldToScreen(const SVector3& p_WorldPos, SVector2& p_Out) override;
@@ -154,6 +219,22 @@ namespace Rendering::Renderers {
             const SVector4& p_MaterialColor
         ) override;
 
+        void DrawLines3D(std::span<const Line> p_Lines) override;
+        void DrawTriangles3D(std::span<const Triangle> p_Triangles) override;
+        void DrawIndexedTriangles3D(
+            std::span<const ColoredVertex> p_Vertices, std::span<const uint32_t> p_Indices
+        ) override;
+
+        StaticMeshHandle CreateStaticMesh(
+            std::span<const ColoredVertex> p_Vertices, std::span<const uint32_t> p_Indices,
+            StaticMeshTopology p_Topology = StaticMeshTopology::Triangles
+        ) override;
+        void UpdateStaticMeshColors(
+            StaticMeshHandle p_Mesh, size_t p_FirstVertex, std::span<const SVector4> p_Colors
+        ) override;
+        void DrawStaticMesh(StaticMeshHandle p_Mesh) override;
+        void DestroyStaticMesh(StaticMeshHandle p_Mesh) override;
+
         bool IsPointInsideViewFrustum(const SVector3& p_Point) const override;
         bool IsAABBInsideViewFrustum(
             const SVector3& p_Min, const SVector3& p_Max, const SMatrix& p_Transform
@@ -210,6 +291,22 @@ namespace Rendering::Renderers {
         std::unique_ptr<CustomPrimitiveBatch<DirectX::VertexPositionColor>> m_LineBatch {};
         std::unique_ptr<CustomPrimitiveBatch<DirectX::VertexPositionColorTexture>> m_TextBatch {};
         std::vector<Text2D> m_Text2DBuffer;
+        TextLayoutCache m_TextLayoutCache;
+        std::atomic<bool> m_TextLayoutCacheClearRequested = false;
+
+        // Transformed corners of the glyphs of a single text that passed frustum culling, and the glyphs they
+        // belong to. Kept around so drawing text doesn't allocate.
+        std::vector<SVector3> m_TextGlyphCorners;
+        std::vector<uint32_t> m_VisibleTextGlyphs;
+
+        std::mutex m_StaticMeshMutex;
+        std::unordered_map<uint32_t, std::unique_ptr<StaticMesh>> m_StaticMeshes;
+        uint32_t m_NextStaticMeshId = 1;
+
+        // Destroyed meshes, with the fence value of the last frame that could still be using them.
+        std::vector<std::pair<uint64_t, std::unique_ptr<StaticMesh>>> m_RetiredStaticMeshes;
+        std::vector<StaticMeshChunks::DrawRange> m_StaticMeshDrawRanges;
+        std::vector<uint64_t> m_StaticMeshChunkVisibility;
 
         DirectX::SimpleMath::Matrix m_World {};
         DirectX::SimpleMath::Matrix m_View {};
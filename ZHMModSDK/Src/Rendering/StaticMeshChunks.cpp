@@ -0,0 +1,181 @@
+#include "StaticMeshChunks.h"
+
+#include <algorithm>
+#include <limits>
+
+bool StaticMeshChunks::Build(
+    std::span<const ColoredVertex> p_Vertices, std::span<const uint32_t> p_Indices,
+    const uint32_t p_IndicesPerPrimitive, std::vector<uint32_t>& p_SortedIndices
+) {
+    m_Chunks.clear();
+    m_ChunkBounds.clear();
+    p_SortedIndices.clear();
+
+    const size_t s_PrimitiveCount = p_Indices.size() / p_IndicesPerPrimitive;
+
+    if (s_PrimitiveCount == 0) {
+        return true;
+    }
+
+    for (size_t i = 0; i < s_PrimitiveCount * p_IndicesPerPrimitive; ++i) {
+        if (p_Indices[i] >= p_Vertices.size()) {
+            return false;
+        }
+    }
+
+    // Compute the centroid of every primitive and the bounds of all centroids.
+    std::vector<SVector3> s_Centroids(s_PrimitiveCount);
+
+    constexpr float s_Max = std::numeric_limits<float>::max();
+    SVector3 s_BoundsMin(s_Max, s_Max, s_Max);
+    SVector3 s_BoundsMax(-s_Max, -s_Max, -s_Max);
+
+    for (size_t i = 0; i < s_PrimitiveCount; ++i) {
+        SVector3 s_Centroid(0.f, 0.f, 0.f);
+
+        for (uint32_t j = 0; j < p_IndicesPerPrimitive; ++j) {
+            const SVector3& s_Position = p_Vertices[p_Indices[i * p_IndicesPerPrimitive + j]].position;
+
+            s_Centroid.x += s_Position.x;
+            s_Centroid.y += s_Position.y;
+            s_Centroid.z += s_Position.z;
+        }
+
+        s_Centroid.x /= static_cast<float>(p_IndicesPerPrimitive);
+        s_Centroid.y /= static_cast<float>(p_IndicesPerPrimitive);
+        s_Centroid.z /= static_cast<float>(p_IndicesPerPrimitive);
+
+        s_BoundsMin.x = std::min(s_BoundsMin.x, s_Centroid.x);
+        s_BoundsMin.y = std::min(s_BoundsMin.y, s_Centroid.y);
+        s_BoundsMin.z = std::min(s_BoundsMin.z, s_Centroid.z);
+
+        s_BoundsMax.x = std::max(s_BoundsMax.x, s_Centroid.x);
+        s_BoundsMax.y = std::max(s_BoundsMax.y, s_Centroid.y);
+        s_BoundsMax.z = std::max(s_BoundsMax.z, s_Centroid.z);
+
+        s_Centroids[i] = s_Centroid;
+    }
+
+    const SVector3 s_Extents(
+        std::max(s_BoundsMax.x - s_BoundsMin.x, 1e-6f),
+        std::max(s_BoundsMax.y - s_BoundsMin.y, 1e-6f),
+        std::max(s_BoundsMax.z - s_BoundsMin.z, 1e-6f)
+    );
+
+    // Sort the primitives along the Morton curve so spatially close primitives end up next to each other.
+    std::vector<std::pair<uint32_t, uint32_t>> s_SortKeys(s_PrimitiveCount);
+
+    for (size_t i = 0; i < s_PrimitiveCount; ++i) {
+        s_SortKeys[i] = {
+            MortonCode(
+                (s_Centroids[i].x - s_BoundsMin.x) / s_Extents.x,
+                (s_Centroids[i].y - s_BoundsMin.y) / s_Extents.y,
+                (s_Centroids[i].z - s_BoundsMin.z) / s_Extents.z
+            ),
+            static_cast<uint32_t>(i)
+        };
+    }
+
+    std::sort(s_SortKeys.begin(), s_SortKeys.end());
+
+    p_SortedIndices.reserve(s_PrimitiveCount * p_IndicesPerPrimitive);
+    m_Chunks.reserve((s_PrimitiveCount + c_PrimitivesPerChunk - 1) / c_PrimitivesPerChunk);
+
+    for (size_t s_ChunkStart = 0; s_ChunkStart < s_PrimitiveCount; s_ChunkStart += c_PrimitivesPerChunk) {
+        const size_t s_ChunkEnd = std::min<size_t>(s_ChunkStart + c_PrimitivesPerChunk, s_PrimitiveCount);
+
+        Chunk& s_Chunk = m_Chunks.emplace_back();
+        s_Chunk.m_FirstIndex = static_cast<uint32_t>(p_SortedIndices.size());
+        s_Chunk.m_Min = SVector3(s_Max, s_Max, s_Max);
+        s_Chunk.m_Max = SVector3(-s_Max, -s_Max, -s_Max);
+
+        for (size_t i = s_ChunkStart; i < s_ChunkEnd; ++i) {
+            const uint32_t s_Primitive = s_SortKeys[i].second;
+
+            for (uint32_t j = 0; j < p_IndicesPerPrimitive; ++j) {
+                const uint32_t s_Index = p_Indices[s_Primitive * p_IndicesPerPrimitive + j];
+                const SVector3& s_Position = p_Vertices[s_Index].position;
+
+                s_Chunk.m_Min.x = std::min(s_Chunk.m_Min.x, s_Position.x);
+                s_Chunk.m_Min.y = std::min(s_Chunk.m_Min.y, s_Position.y);
+                s_Chunk.m_Min.z = std::min(s_Chunk.m_Min.z, s_Position.z);
+
+                s_Chunk.m_Max.x = std::max(s_Chunk.m_Max.x, s_Position.x);
+                s_Chunk.m_Max.y = std::max(s_Chunk.m_Max.y, s_Position.y);
+                s_Chunk.m_Max.z = std::max(s_Chunk.m_Max.z, s_Position.z);
+
+                p_SortedIndices.push_back(s_Index);
+            }
+        }
+
+        s_Chunk.m_IndexCount = static_cast<uint32_t>(p_SortedIndices.size()) - s_Chunk.m_FirstIndex;
+    }
+
+    const size_t s_ChunkCount = m_Chunks.size();
+    m_ChunkBounds.resize(s_ChunkCount * 6);
+
+    for (size_t i = 0; i < s_ChunkCount; ++i) {
+        m_ChunkBounds[s_ChunkCount * 0 + i] = m_Chunks[i].m_Min.x;
+        m_ChunkBounds[s_ChunkCount * 1 + i] = m_Chunks[i].m_Min.y;
+        m_ChunkBounds[s_ChunkCount * 2 + i] = m_Chunks[i].m_Min.z;
+        m_ChunkBounds[s_ChunkCount * 3 + i] = m_Chunks[i].m_Max.x;
+        m_ChunkBounds[s_ChunkCount * 4 + i] = m_Chunks[i].m_Max.y;
+        m_ChunkBounds[s_ChunkCount * 5 + i] = m_Chunks[i].m_Max.z;
+    }
+
+    return true;
+}
+
+void StaticMeshChunks::GetVisibleRanges(const uint64_t* p_Visibility, std::vector<DrawRange>& p_Ranges) const {
+    p_Ranges.clear();
+
+    for (size_t i = 0; i < m_Chunks.size(); ++i) {
+        if (!(p_Visibility[i / 64] & (1ull << (i % 64)))) {
+            continue;
+        }
+
+        const Chunk& s_Chunk = m_Chunks[i];
+
+        if (!p_Ranges.empty() &&
+            p_Ranges.back().m_FirstIndex + p_Ranges.back().m_IndexCount == s_Chunk.m_FirstIndex) {
+            p_Ranges.back().m_IndexCount += s_Chunk.m_IndexCount;
+        }
+        else {
+            p_Ranges.push_back({s_Chunk.m_FirstIndex, s_Chunk.m_IndexCount});
+        }
+    }
+}
+
+FrustumCullAABBs StaticMeshChunks::GetChunkBounds() const {
+    const size_t s_ChunkCount = m_Chunks.size();
+    const float* s_Bounds = m_ChunkBounds.data();
+
+    return {
+        s_Bounds,
+        s_Bounds + s_ChunkCount,
+        s_Bounds + s_ChunkCount * 2,
+        s_Bounds + s_ChunkCount * 3,
+        s_Bounds + s_ChunkCount * 4,
+        s_Bounds + s_ChunkCount * 5,
+    };
+}
+
+uint32_t StaticMeshChunks::MortonCode(const float p_X, const float p_Y, const float p_Z) {
+    // Spread the lower 10 bits of a value out so there are two zero bits between each of them.
+    const auto s_ExpandBits = [](uint32_t p_Value) {
+        p_Value = (p_Value * 0x00010001u) & 0xFF0000FFu;
+        p_Value = (p_Value * 0x00000101u) & 0x0F00F00Fu;
+        p_Value = (p_Value * 0x00000011u) & 0xC30C30C3u;
+        p_Value = (p_Value * 0x00000005u) & 0x49249249u;
+
+        return p_Value;
+    };
+
+    const auto s_Quantize = [](const float p_Value) {
+        return static_cast<uint32_t>(std::clamp(p_Value * 1024.f, 0.f, 1023.f));
+    };
+
+    return (s_ExpandBits(s_Quantize(p_X)) << 2) |
+        (s_ExpandBits(s_Quantize(p_Y)) << 1) |
+        s_ExpandBits(s_Quantize(p_Z));
+}
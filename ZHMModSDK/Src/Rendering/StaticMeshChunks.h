@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "IRenderer.h"
+#include "FrustumCulling.h"
+
+/**
+ * Splits the primitives of a static mesh into spatially coherent chunks with precomputed bounds,
+ * so that large meshes can be culled chunk by chunk instead of primitive by primitive.
+ *
+ * Primitives are sorted along a Morton curve through the bounds of the mesh, which keeps
+ * primitives that are close to each other in the same chunk. This class only deals with CPU-side
+ * data and doesn't need a GPU; the renderer owns the actual vertex and index buffers.
+ */
+class StaticMeshChunks {
+public:
+    struct Chunk {
+        uint32_t m_FirstIndex;
+        uint32_t m_IndexCount;
+        SVector3 m_Min;
+        SVector3 m_Max;
+    };
+
+    struct DrawRange {
+        uint32_t m_FirstIndex;
+        uint32_t m_IndexCount;
+    };
+
+    static constexpr uint32_t c_PrimitivesPerChunk = 512;
+
+public:
+    /**
+     * Sort the primitives of a mesh into chunks.
+     * @param p_Vertices The vertices of the mesh.
+     * @param p_Indices The indices of the mesh. Incomplete primitives at the end are ignored.
+     * @param p_IndicesPerPrimitive 3 for triangle lists, 2 for line lists.
+     * @param p_SortedIndices Receives the indices reordered so that every chunk covers a contiguous range.
+     * @return False if any index is out of range of the vertices, true otherwise.
+     */
+    bool Build(
+        std::span<const ColoredVertex> p_Vertices, std::span<const uint32_t> p_Indices,
+        uint32_t p_IndicesPerPrimitive, std::vector<uint32_t>& p_SortedIndices
+    );
+
+    /**
+     * Collect the index ranges of all visible chunks. Consecutive visible chunks are merged into a single range.
+     * @param p_Visibility One bit per chunk that is set if the chunk is visible, laid out like the output of
+     *                     the batch culling in FrustumCulling.h.
+     * @param p_Ranges Receives the ranges. Existing contents are cleared.
+     */
+    void GetVisibleRanges(const uint64_t* p_Visibility, std::vector<DrawRange>& p_Ranges) const;
+
+    /**
+     * The bounds of all chunks as structure-of-arrays, so they can be culled in a single batch.
+     */
+    FrustumCullAABBs GetChunkBounds() const;
+
+    const std::vector<Chunk>& GetChunks() const {
+        return m_Chunks;
+    }
+
+private:
+    static uint32_t MortonCode(float p_X, float p_Y, float p_Z);
+
+private:
+    std::vector<Chunk> m_Chunks;
+
+    // Chunk bounds split by component: all min x values, then all min y values and so on.
+    std::vector<float> m_ChunkBounds;
+};
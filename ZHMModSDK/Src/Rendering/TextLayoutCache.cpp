@@ -0,0 +1,100 @@
+#include "TextLayoutCache.h"
+
+#include "Glacier/MDF_FONT.h"
+
+const TextLayoutCache::TextLayout& TextLayoutCache::GetLayout(
+    std::string_view p_Text, TextAlignment p_HorizontalAlignment
+) {
+    auto s_Iterator = m_Layouts.find(LayoutKeyView {p_Text, p_HorizontalAlignment});
+
+    if (s_Iterator == m_Layouts.end()) {
+        s_Iterator = m_Layouts.emplace(LayoutKey {std::string(p_Text), p_HorizontalAlignment}, TextLayout {}).first;
+        BuildLayout(p_Text, p_HorizontalAlignment, s_Iterator->second);
+    }
+
+    s_Iterator->second.m_LastUsedFrame = m_CurrentFrame;
+
+    return s_Iterator->second;
+}
+
+void TextLayoutCache::EndFrame() {
+    ++m_CurrentFrame;
+
+    if (m_Layouts.size() <= c_MaxCachedLayouts) {
+        return;
+    }
+
+    std::erase_if(
+        m_Layouts, [this](const auto& p_Pair) {
+            return m_CurrentFrame - p_Pair.second.m_LastUsedFrame > c_EvictionFrameCount;
+        }
+    );
+}
+
+void TextLayoutCache::Clear() {
+    m_Layouts.clear();
+}
+
+void TextLayoutCache::BuildLayout(
+    std::string_view p_Text, TextAlignment p_HorizontalAlignment, TextLayout& p_Layout
+) {
+    // MDF_FONT works with null-terminated strings, so we need our own copy.
+    const std::string s_Text(p_Text);
+
+    MDF_FONT::STextBoundingBox s_TextBoundingBox;
+    MDF_FONT::CalcBoundingBox(s_TextBoundingBox, s_Text.c_str());
+
+    p_Layout.m_Height = s_TextBoundingBox.m_fMaxY - s_TextBoundingBox.m_fMinY;
+    p_Layout.m_Glyphs.reserve(s_Text.size());
+
+    std::string s_Line;
+    size_t s_LineStart = 0;
+    int s_LineIndex = 0;
+
+    while (s_LineStart < s_Text.size()) {
+        size_t s_LineEnd = s_Text.find('\n', s_LineStart);
+
+        if (s_LineEnd == std::string::npos) {
+            s_LineEnd = s_Text.size();
+        }
+
+        s_Line.assign(s_Text, s_LineStart, s_LineEnd - s_LineStart);
+        s_LineStart = s_LineEnd + 1;
+
+        MDF_FONT::STextBoundingBox s_LineBoundingBox;
+        MDF_FONT::CalcBoundingBox(s_LineBoundingBox, s_Line.c_str());
+
+        float s_OffsetX = 0.f;
+
+        if (p_HorizontalAlignment == TextAlignment::Center) {
+            s_OffsetX = -(s_LineBoundingBox.m_fMaxX - s_LineBoundingBox.m_fMinX) * 0.5f;
+        }
+        else if (p_HorizontalAlignment == TextAlignment::Right) {
+            s_OffsetX = -(s_LineBoundingBox.m_fMaxX - s_LineBoundingBox.m_fMinX);
+        }
+
+        float s_PenX = s_OffsetX;
+        const float s_PenY = -(s_LineIndex * MDF_FONT::g_LineHeight);
+
+        const char* p = s_Line.c_str();
+
+        while (*p) {
+            const uint32_t s_Codepoint = MDF_FONT::DecodeUTF8(p);
+
+            if (s_Codepoint == ' ') {
+                s_PenX += MDF_FONT::GetAdvanceWidth(s_Codepoint);
+                continue;
+            }
+
+            if (!MDF_FONT::HasGlyph(s_Codepoint)) {
+                continue;
+            }
+
+            GlyphQuad& s_Quad = p_Layout.m_Glyphs.emplace_back();
+
+            MDF_FONT::RenderQuad(s_Codepoint, 1.0f, s_PenX, s_PenY, s_Quad.m_Positions, s_Quad.m_TextureCoordinates);
+        }
+
+        s_LineIndex++;
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "IRenderer.h"
+
+/**
+ * Caches the glyph layout of 3D text, so labels that are drawn every frame only get laid out once.
+ *
+ * Layouts are stored in local text space (before alignment offsets, scaling and the world transform
+ * are applied), which means the same layout can be reused for any position, scale, or color.
+ * Layouts that haven't been used for a while are evicted when the cache grows too large.
+ */
+class TextLayoutCache {
+public:
+    struct GlyphQuad {
+        // Vertex order: bottom-left, bottom-right, top-right, top-left.
+        float m_Positions[8];
+        float m_TextureCoordinates[8];
+    };
+
+    struct TextLayout {
+        std::vector<GlyphQuad> m_Glyphs;
+
+        // Height of the bounding box of the whole text, used for vertical alignment.
+        float m_Height = 0.f;
+        uint64_t m_LastUsedFrame = 0;
+    };
+
+public:
+    const TextLayout& GetLayout(std::string_view p_Text, TextAlignment p_HorizontalAlignment);
+
+    /**
+     * Advance the frame counter and evict layouts that haven't been used recently.
+     * Should be called once per rendered frame.
+     */
+    void EndFrame();
+
+    void Clear();
+
+private:
+    struct LayoutKey {
+        std::string m_Text;
+        TextAlignment m_HorizontalAlignment;
+    };
+
+    struct LayoutKeyView {
+        std::string_view m_Text;
+        TextAlignment m_HorizontalAlignment;
+    };
+
+    struct LayoutKeyHash {
+        using is_transparent = void;
+
+        size_t operator()(const LayoutKey& p_Key) const {
+            return (*this)(LayoutKeyView {p_Key.m_Text, p_Key.m_HorizontalAlignment});
+        }
+
+        size_t operator()(const LayoutKeyView& p_Key) const {
+            return std::hash<std::string_view>()(p_Key.m_Text) ^
+                (static_cast<size_t>(p_Key.m_HorizontalAlignment) * 0x9E3779B97F4A7C15ull);
+        }
+    };
+
+    struct LayoutKeyEqual {
+        using is_transparent = void;
+
+        template <typename A, typename B>
+        bool operator()(const A& p_Left, const B& p_Right) const {
+            return p_Left.m_HorizontalAlignment == p_Right.m_HorizontalAlignment &&
+                std::string_view(p_Left.m_Text) == std::string_view(p_Right.m_Text);
+        }
+    };
+
+    static void BuildLayout(std::string_view p_Text, TextAlignment p_HorizontalAlignment, TextLayout& p_Layout);
+
+private:
+    // Start evicting once we have more than this many layouts cached.
+    static constexpr size_t c_MaxCachedLayouts = 8192;
+
+    // Layouts that haven't been drawn for this many frames can be evicted.
+    static constexpr uint64_t c_EvictionFrameCount = 120;
+
+    std::unordered_map<LayoutKey, TextLayout, LayoutKeyHash, LayoutKeyEqual> m_Layouts;
+    uint64_t m_CurrentFrame = 0;
+};
@@ -88,15 +88,48 @@ void ViewFrustum::MatrixCreateClipPlanesNormalized(float4* p_Planes, const SMatr
 }
 
 bool ViewFrustum::ContainsPoint(const SVector3& p_Point) const {
-    return CheckPointInsidePlanes(p_Point) != ECheckInsideFlag::CHECK_INSIDE_FULLY_OUTSIDE;
+    return FrustumCulling::ClassifyPoint(GetPlanes(), p_Point.x, p_Point.y, p_Point.z) !=
+        FrustumCulling::EContainment::Outside;
 }
 
 bool ViewFrustum::ContainsAABB(const AABB& p_AABB) const {
-    return CheckAABBInsidePlanes(p_AABB) != ECheckInsideFlag::CHECK_INSIDE_FULLY_OUTSIDE;
+    const float s_Min[3] = {p_AABB.min.x, p_AABB.min.y, p_AABB.min.z};
+    const float s_Max[3] = {p_AABB.max.x, p_AABB.max.y, p_AABB.max.z};
+
+    return FrustumCulling::ClassifyAABB(GetPlanes(), s_Min, s_Max) != FrustumCulling::EContainment::Outside;
 }
 
 bool ViewFrustum::ContainsOBB(const SMatrix& p_Transform, const float4& p_Center, const float4& p_HalfSize) const {
-    return CheckOBBInsidePlanes(p_Transform, p_Center, p_HalfSize) != ECheckInsideFlag::CHECK_INSIDE_FULLY_OUTSIDE;
+    const float4 s_WorldCenter = p_Transform.WVectorTransform(p_Center);
+
+    const float s_Center[3] = {s_WorldCenter.x, s_WorldCenter.y, s_WorldCenter.z};
+    const float s_HalfSize[3] = {p_HalfSize.x, p_HalfSize.y, p_HalfSize.z};
+    const float s_Axes[3][3] = {
+        {p_Transform.XAxis.x, p_Transform.XAxis.y, p_Transform.XAxis.z},
+        {p_Transform.YAxis.x, p_Transform.YAxis.y, p_Transform.YAxis.z},
+        {p_Transform.ZAxis.x, p_Transform.ZAxis.y, p_Transform.ZAxis.z},
+    };
+
+    return FrustumCulling::ClassifyOBB(GetPlanes(), s_Center, s_HalfSize, s_Axes) !=
+        FrustumCulling::EContainment::Outside;
+}
+
+uint32_t ViewFrustum::ContainsPoints4(const SVector3* p_Points, const size_t p_Stride, const size_t p_Count) const {
+    return FrustumCulling::CullPoints4(GetPlanes(), &p_Points->x, p_Stride, p_Count);
+}
+
+void ViewFrustum::ContainsPoints(
+    const FrustumCullPoints& p_Points, const size_t p_Count, uint64_t* p_Visibility
+) const {
+    FrustumCulling::CullPoints(GetPlanes(), p_Points, p_Count, p_Visibility);
+}
+
+void ViewFrustum::ContainsAABBs(const FrustumCullAABBs& p_AABBs, const size_t p_Count, uint64_t* p_Visibility) const {
+    FrustumCulling::CullAABBs(GetPlanes(), p_AABBs, p_Count, p_Visibility);
+}
+
+void ViewFrustum::ContainsOBBs(const FrustumCullOBBs& p_OBBs, const size_t p_Count, uint64_t* p_Visibility) const {
+    FrustumCulling::CullOBBs(GetPlanes(), p_OBBs, p_Count, p_Visibility);
 }
 
 void ViewFrustum::SetDistanceCullingEnabled(const bool p_Enabled) {
@@ -114,106 +147,3 @@ void ViewFrustum::SetMaxDrawDistance(const float p_MaxDrawDistance) {
 float ViewFrustum::GetMaxDrawDistance() const {
     return m_MaxDrawDistance;
 }
-
-ViewFrustum::ECheckInsideFlag ViewFrustum::CheckPointInsidePlanes(const SVector3& p_Point) const {
-    float positiveExtentSum = 0.f;
-    float negativeExtentSum = 0.f;
-
-    for (const auto& plane : m_Planes) {
-        const SVector3 normal(plane.x, plane.y, plane.z);
-
-        const float distance =
-                normal.x * p_Point.x +
-                normal.y * p_Point.y +
-                normal.z * p_Point.z +
-                plane.w;
-
-        positiveExtentSum += std::max(distance, 0.0f);
-        negativeExtentSum += std::max(distance, 0.0f);
-    }
-
-    if (negativeExtentSum > 0.f) {
-        return ECheckInsideFlag::CHECK_INSIDE_FULLY_OUTSIDE;
-    }
-
-    constexpr float epsilon = 1.f / 4096.f;
-
-    return positiveExtentSum <= epsilon
-               ? ECheckInsideFlag::CHECK_INSIDE_FULLY_INSIDE
-               : ECheckInsideFlag::CHECK_INSIDE_PARTIALLY_INSIDE;
-}
-
-ViewFrustum::ECheckInsideFlag ViewFrustum::CheckAABBInsidePlanes(const AABB& p_AABB) const {
-    float positiveExtentSum = 0.f;
-    float negativeExtentSum = 0.f;
-
-    const SVector3 center = (p_AABB.min + p_AABB.max) * 0.5f;
-    const SVector3 halfSize = (p_AABB.max - p_AABB.min) * 0.5f;
-
-    for (const auto& plane : m_Planes) {
-        const SVector3 normal(plane.x, plane.y, plane.z);
-
-        const float distance =
-                normal.x * center.x +
-                normal.y * center.y +
-                normal.z * center.z +
-                plane.w;
-
-        const float radius =
-                std::fabs(normal.x) * halfSize.x +
-                std::fabs(normal.y) * halfSize.y +
-                std::fabs(normal.z) * halfSize.z;
-
-        positiveExtentSum += std::max(distance + radius, 0.0f);
-        negativeExtentSum += std::max(distance - radius, 0.0f);
-    }
-
-    if (negativeExtentSum > 0.f) {
-        return ECheckInsideFlag::CHECK_INSIDE_FULLY_OUTSIDE;
-    }
-
-    constexpr float epsilon = 1.f / 4096.f;
-
-    return positiveExtentSum <= epsilon
-               ? ECheckInsideFlag::CHECK_INSIDE_FULLY_INSIDE
-               : ECheckInsideFlag::CHECK_INSIDE_PARTIALLY_INSIDE;
-}
-
-ViewFrustum::ECheckInsideFlag ViewFrustum::CheckOBBInsidePlanes(
-    const SMatrix& p_ObjectInternal, const float4& p_LocalCenter, const float4& p_LocalSize
-) const {
-    const float4 worldCenter = p_ObjectInternal.WVectorTransform(p_LocalCenter);
-
-    const SVector3 axisX(p_ObjectInternal.XAxis.x, p_ObjectInternal.XAxis.y, p_ObjectInternal.XAxis.z);
-    const SVector3 axisY(p_ObjectInternal.YAxis.x, p_ObjectInternal.YAxis.y, p_ObjectInternal.YAxis.z);
-    const SVector3 axisZ(p_ObjectInternal.ZAxis.x, p_ObjectInternal.ZAxis.y, p_ObjectInternal.ZAxis.z);
-
-    float positiveExtentSum = 0.f;
-    float negativeExtentSum = 0.f;
-
-    for (const auto& plane : m_Planes) {
-        const SVector3 normal(plane.x, plane.y, plane.z);
-
-        const float distance = normal.x * worldCenter.x +
-                normal.y * worldCenter.y +
-                normal.z * worldCenter.z +
-                plane.w;
-
-        const float radius = std::fabs(normal * axisX) * p_LocalSize.x +
-                std::fabs(normal * axisY) * p_LocalSize.y +
-                std::fabs(normal * axisZ) * p_LocalSize.z;
-
-        positiveExtentSum += std::max(distance + radius, 0.0f);
-        negativeExtentSum += std::max(distance - radius, 0.0f);
-    }
-
-    if (negativeExtentSum > 0.f) {
-        return ECheckInsideFlag::CHECK_INSIDE_FULLY_OUTSIDE;
-    }
-
-    constexpr float epsilon = 1.f / 4096.f;
-
-    return positiveExtentSum <= epsilon
-               ? ECheckInsideFlag::CHECK_INSIDE_FULLY_INSIDE
-               : ECheckInsideFlag::CHECK_INSIDE_PARTIALLY_INSIDE;
-}
\ No newline at end of file
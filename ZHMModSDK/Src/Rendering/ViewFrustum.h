@@ -6,6 +6,7 @@
 
 #include "Common.h"
 #include "IRenderer.h"
+#include "FrustumCulling.h"
 
 class ZHMSDK_API ViewFrustum {
 public:
@@ -14,6 +15,26 @@ public:
     bool ContainsAABB(const AABB& p_AABB) const;
     bool ContainsOBB(const SMatrix& p_Transform, const float4& p_Center, const float4& p_HalfSize) const;
 
+    /**
+     * Test up to 4 points against the frustum at once.
+     * @param p_Points Pointer to the first point. Every following point is read p_Stride bytes after the previous one,
+     *                 so points can be tested directly inside arrays of larger structs.
+     * @param p_Stride The distance in bytes between two consecutive points.
+     * @param p_Count The number of points to test (at most 4).
+     * @return A bitmask where bit N is set if point N is inside the frustum.
+     */
+    uint32_t ContainsPoints4(const SVector3* p_Points, size_t p_Stride, size_t p_Count) const;
+
+    /**
+     * Batch versions of ContainsPoint, ContainsAABB and ContainsOBB for large numbers of primitives.
+     * Inputs are structure-of-arrays views, see FrustumCulling.h for details.
+     * @param p_Visibility Receives one bit per primitive that is set if the primitive is inside the frustum.
+     *                     Must hold at least FrustumCulling::GetVisibilityMaskSize(p_Count) values.
+     */
+    void ContainsPoints(const FrustumCullPoints& p_Points, size_t p_Count, uint64_t* p_Visibility) const;
+    void ContainsAABBs(const FrustumCullAABBs& p_AABBs, size_t p_Count, uint64_t* p_Visibility) const;
+    void ContainsOBBs(const FrustumCullOBBs& p_OBBs, size_t p_Count, uint64_t* p_Visibility) const;
+
     void SetDistanceCullingEnabled(const bool p_Enabled);
     bool IsDistanceCullingEnabled() const;
 
@@ -21,13 +42,6 @@ public:
     float GetMaxDrawDistance() const;
 
 private:
-    enum class ECheckInsideFlag {
-        CHECK_INSIDE_FULLY_OUTSIDE,
-        CHECK_INSIDE_PARTIALLY_INSIDE,
-        CHECK_INSIDE_FULLY_INSIDE,
-        CHECK_INSIDE_UNKNOWN
-    };
-
     SMatrix MatrixPerspectiveFovRH(
         const float p_FovYDeg, const float p_AspectWByH, const float p_NearZ, const float p_FarZ
     );
@@ -35,11 +49,10 @@ private:
     void MatrixCreateClipPlanes(float4* p_Planes, const SMatrix& p_ViewProjection);
     void MatrixCreateClipPlanesNormalized(float4* p_Planes, const SMatrix& p_ViewProjection);
 
-    ECheckInsideFlag CheckPointInsidePlanes(const SVector3& p_Point) const;
-    ECheckInsideFlag CheckAABBInsidePlanes(const AABB& p_AABB) const;
-    ECheckInsideFlag CheckOBBInsidePlanes(
-        const SMatrix& p_ObjectInternal, const float4& p_LocalCenter, const float4& p_LocalSize
-    ) const;
+    // The planes as 6 consecutive (x, y, z, w) tuples, the way FrustumCulling takes them.
+    const float* GetPlanes() const {
+        return reinterpret_cast<const float*>(m_Planes);
+    }
 
     bool m_IsDistanceCullingEnabled = false;
     float m_MaxDrawDistance = 50.f;
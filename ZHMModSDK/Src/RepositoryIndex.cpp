@@ -0,0 +1,284 @@
+#include "RepositoryIndex.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <format>
+
+#include "Glacier/THashMap.h"
+#include "Glacier/ZObject.h"
+
+namespace {
+    enum class ERepositoryKey : uint8_t {
+        Unknown,
+        Id,
+        Title,
+        CommonName,
+        Name,
+        ItemType,
+        PrimaryConfiguration,
+        InventoryCategoryIcon,
+        HeroDisguiseAvailable,
+        IsHitmanSuit,
+        AmmoConfig,
+    };
+
+    constexpr std::array<std::pair<std::string_view, ERepositoryKey>, 10> c_RepositoryKeys = {{
+        {"ID_", ERepositoryKey::Id},
+        {"Title", ERepositoryKey::Title},
+        {"CommonName", ERepositoryKey::CommonName},
+        {"Name", ERepositoryKey::Name},
+        {"ItemType", ERepositoryKey::ItemType},
+        {"PrimaryConfiguration", ERepositoryKey::PrimaryConfiguration},
+        {"InventoryCategoryIcon", ERepositoryKey::InventoryCategoryIcon},
+        {"HeroDisguiseAvailable", ERepositoryKey::HeroDisguiseAvailable},
+        {"IsHitmanSuit", ERepositoryKey::IsHitmanSuit},
+        {"AmmoConfig", ERepositoryKey::AmmoConfig},
+    }};
+
+    // Comparing string views checks the sizes first, so most keys we're not interested in are rejected
+    // without touching their string data.
+    ERepositoryKey GetRepositoryKey(const ZString& p_Key) {
+        const std::string_view s_Key = p_Key.ToStringView();
+
+        for (const auto& [s_Name, s_RepositoryKey] : c_RepositoryKeys) {
+            if (s_Name == s_Key) {
+                return s_RepositoryKey;
+            }
+        }
+
+        return ERepositoryKey::Unknown;
+    }
+
+    std::string FormatDisplayName(const ZString& p_Name, const ZString& p_Id) {
+        if (p_Name.IsEmpty()) {
+            return std::format("<unnamed> [{}]", p_Id.c_str());
+        }
+
+        return std::format("{} [{}]", p_Name.c_str(), p_Id.c_str());
+    }
+}
+
+void RepositoryIndex::Build(void* p_RepositoryData) {
+    Clear();
+
+    if (!p_RepositoryData) {
+        return;
+    }
+
+    const auto s_RepositoryData = static_cast<THashMap<
+        ZRepositoryID, ZDynamicObject, TDefaultHashMapPolicy<ZRepositoryID>>*>(p_RepositoryData);
+
+    const size_t s_EntryCount = s_RepositoryData->size();
+
+    m_Ids.reserve(s_EntryCount);
+    m_Titles.reserve(s_EntryCount);
+    m_CommonNames.reserve(s_EntryCount);
+    m_Names.reserve(s_EntryCount);
+    m_DisplayNames.reserve(s_EntryCount);
+    m_CategoryIds.reserve(s_EntryCount);
+    m_Flags.reserve(s_EntryCount);
+    m_AmmoConfigs.reserve(s_EntryCount);
+    m_IdToIndex.reserve(s_EntryCount * 2);
+
+    // Category 0 is used for entries without an InventoryCategoryIcon.
+    InternCategory("");
+
+    for (auto& [s_RepositoryKey, s_DynamicObject] : *s_RepositoryData) {
+        auto* s_Entries = s_DynamicObject.As<TArray<SDynamicObjectKeyValuePair>>();
+
+        if (!s_Entries) {
+            continue;
+        }
+
+        ZString s_Id, s_Title, s_CommonName, s_Name;
+        const ZRepositoryID* s_IdValue = nullptr;
+        std::string_view s_InventoryCategoryIcon;
+        SDynamicObjectKeyValuePair* s_AmmoConfig = nullptr;
+        uint8_t s_Flags = 0;
+
+        for (auto& s_Entry : *s_Entries) {
+            switch (GetRepositoryKey(s_Entry.sKey)) {
+                case ERepositoryKey::Id:
+                    if (const auto s_String = s_Entry.value.As<ZString>()) {
+                        s_Id = *s_String;
+                    }
+                    else {
+                        s_IdValue = s_Entry.value.As<ZRepositoryID>();
+                    }
+                    break;
+                case ERepositoryKey::Title:
+                    if (const auto s_String = s_Entry.value.As<ZString>()) {
+                        s_Title = *s_String;
+                    }
+                    break;
+                case ERepositoryKey::CommonName:
+                    if (const auto s_String = s_Entry.value.As<ZString>()) {
+                        s_CommonName = *s_String;
+                    }
+                    break;
+                case ERepositoryKey::Name:
+                    if (const auto s_String = s_Entry.value.As<ZString>()) {
+                        s_Name = *s_String;
+                    }
+                    break;
+                case ERepositoryKey::ItemType:
+                    s_Flags |= c_ItemFlag;
+                    break;
+                case ERepositoryKey::PrimaryConfiguration:
+                    s_Flags |= c_WeaponFlag;
+                    break;
+                case ERepositoryKey::InventoryCategoryIcon:
+                    if (const auto s_String = s_Entry.value.As<ZString>()) {
+                        s_InventoryCategoryIcon = s_String->ToStringView();
+                    }
+                    break;
+                case ERepositoryKey::HeroDisguiseAvailable:
+                    if (const auto s_Value = s_Entry.value.As<bool>(); s_Value && *s_Value) {
+                        s_Flags |= c_HeroDisguiseFlag;
+                    }
+                    break;
+                case ERepositoryKey::IsHitmanSuit:
+                    s_Flags |= c_OutfitFlag;
+
+                    if (const auto s_Value = s_Entry.value.As<bool>(); s_Value && *s_Value) {
+                        s_Flags |= c_HitmanSuitFlag;
+                    }
+                    break;
+                case ERepositoryKey::AmmoConfig:
+                    s_AmmoConfig = &s_Entry;
+                    break;
+                case ERepositoryKey::Unknown:
+                    break;
+            }
+        }
+
+        if (s_Id.IsEmpty() && s_IdValue) {
+            s_Id = s_IdValue->ToString();
+        }
+
+        // Entries without an ID_ can still be looked up by their key, but aren't listed as items or outfits.
+        if (s_Id.IsEmpty()) {
+            s_Flags &= ~(c_ItemFlag | c_WeaponFlag | c_OutfitFlag);
+        }
+
+        const auto s_Index = static_cast<uint32_t>(m_Ids.size());
+        const ZRepositoryID s_RepositoryId = s_Id.IsEmpty() ? s_RepositoryKey : ZRepositoryID(s_Id);
+
+        std::string s_DisplayName;
+
+        if (s_Flags & c_ItemFlag) {
+            const ZString& s_ItemName = !s_Title.IsEmpty()
+                ? s_Title
+                : !s_CommonName.IsEmpty()
+                ? s_CommonName
+                : s_Name;
+
+            s_DisplayName = FormatDisplayName(s_ItemName, s_Id);
+        }
+        else if (s_Flags & c_OutfitFlag) {
+            s_DisplayName = FormatDisplayName(s_CommonName, s_Id);
+        }
+
+        m_Ids.push_back(s_RepositoryId);
+        m_Titles.push_back(s_Title);
+        m_CommonNames.push_back(s_CommonName);
+        m_Names.push_back(s_Name);
+        m_DisplayNames.push_back(std::move(s_DisplayName));
+        m_CategoryIds.push_back(s_Flags & c_ItemFlag ? InternCategory(s_InventoryCategoryIcon) : 0);
+        m_Flags.push_back(s_Flags);
+        m_AmmoConfigs.push_back(s_AmmoConfig);
+
+        m_IdToIndex.emplace(s_RepositoryId, s_Index);
+        m_IdToIndex.emplace(s_RepositoryKey, s_Index);
+
+        if (s_Flags & c_ItemFlag) {
+            m_Items.push_back(s_Index);
+
+            if (s_Flags & c_WeaponFlag) {
+                m_Weapons.push_back(s_Index);
+            }
+        }
+
+        if (s_Flags & c_OutfitFlag) {
+            m_Outfits.push_back(s_Index);
+        }
+    }
+
+    // Case fold the display names once instead of on every comparison.
+    std::vector<std::string> s_SortKeys(m_DisplayNames.size());
+
+    for (size_t i = 0; i < m_DisplayNames.size(); ++i) {
+        s_SortKeys[i].resize(m_DisplayNames[i].size());
+
+        std::ranges::transform(
+            m_DisplayNames[i], s_SortKeys[i].begin(), [](const unsigned char c) { return std::tolower(c); }
+        );
+    }
+
+    const auto s_SortByDisplayName = [&](std::vector<uint32_t>& p_Indices) {
+        std::ranges::sort(
+            p_Indices, [&](const uint32_t a, const uint32_t b) {
+                return s_SortKeys[a] < s_SortKeys[b];
+            }
+        );
+    };
+
+    s_SortByDisplayName(m_Items);
+    s_SortByDisplayName(m_Weapons);
+    s_SortByDisplayName(m_Outfits);
+
+    // Items are already sorted, so distributing them keeps every category sorted too.
+    m_CategoryItems.resize(m_CategoryNames.size());
+
+    for (const uint32_t s_Index : m_Items) {
+        m_CategoryItems[m_CategoryIds[s_Index]].push_back(s_Index);
+    }
+
+    m_IsLoaded = true;
+}
+
+void RepositoryIndex::Clear() {
+    m_IsLoaded = false;
+
+    m_Ids.clear();
+    m_Titles.clear();
+    m_CommonNames.clear();
+    m_Names.clear();
+    m_DisplayNames.clear();
+    m_CategoryIds.clear();
+    m_Flags.clear();
+    m_AmmoConfigs.clear();
+    m_IdToIndex.clear();
+    m_Items.clear();
+    m_Weapons.clear();
+    m_Outfits.clear();
+    m_CategoryNames.clear();
+    m_CategoryItems.clear();
+}
+
+uint16_t RepositoryIndex::InternCategory(std::string_view p_InventoryCategoryIcon) {
+    if (p_InventoryCategoryIcon == "INVALID_CATEGORY_ICON") {
+        p_InventoryCategoryIcon = "other";
+    }
+    else if (p_InventoryCategoryIcon == "questitem") {
+        p_InventoryCategoryIcon = "questItem";
+    }
+
+    std::string s_Category(p_InventoryCategoryIcon);
+
+    if (!s_Category.empty()) {
+        s_Category[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(s_Category[0])));
+    }
+
+    // There are only a handful of categories, so a linear search is fine.
+    const auto s_It = std::ranges::find(m_CategoryNames, s_Category);
+
+    if (s_It != m_CategoryNames.end()) {
+        return static_cast<uint16_t>(s_It - m_CategoryNames.begin());
+    }
+
+    m_CategoryNames.push_back(std::move(s_Category));
+
+    return static_cast<uint16_t>(m_CategoryNames.size() - 1);
+}
@@ -0,0 +1,215 @@
+#include "ResourceChunkIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+
+#include <Logging.h>
+
+#include "Util/HashingUtils.h"
+
+ResourceChunkIndex::~ResourceChunkIndex() {
+    Close();
+}
+
+std::vector<ResourceChunkIndex::PackageFile> ResourceChunkIndex::GetPackageFiles(
+    const std::filesystem::path& p_RuntimeDirectory
+) {
+    std::vector<PackageFile> s_PackageFiles;
+    std::error_code s_ErrorCode;
+
+    for (const auto& s_DirectoryEntry : std::filesystem::directory_iterator(p_RuntimeDirectory, s_ErrorCode)) {
+        if (!s_DirectoryEntry.is_regular_file(s_ErrorCode)) {
+            continue;
+        }
+
+        // Package definitions and all rpkg files (base and patches) affect which chunk a resource ends up in.
+        std::string s_FileName = s_DirectoryEntry.path().filename().string();
+        std::ranges::transform(s_FileName, s_FileName.begin(), [](const unsigned char c) { return std::tolower(c); });
+
+        const auto s_LastWriteTime = s_DirectoryEntry.last_write_time(s_ErrorCode);
+
+        s_PackageFiles.push_back(
+            PackageFile {
+                .m_NameHash = Util::HashingUtils::FNV1a(s_FileName.c_str()),
+                .m_Reserved = 0,
+                .m_Size = s_DirectoryEntry.file_size(s_ErrorCode),
+                .m_LastWriteTime = static_cast<uint64_t>(s_LastWriteTime.time_since_epoch().count()),
+            }
+        );
+    }
+
+    std::ranges::sort(
+        s_PackageFiles, [](const PackageFile& a, const PackageFile& b) {
+            return a.m_NameHash < b.m_NameHash;
+        }
+    );
+
+    return s_PackageFiles;
+}
+
+bool ResourceChunkIndex::Open(const std::filesystem::path& p_Path, std::span<const PackageFile> p_PackageFiles) {
+    Close();
+
+    m_File = CreateFileW(
+        p_Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+    );
+
+    if (m_File == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER s_FileSize;
+
+    if (!GetFileSizeEx(m_File, &s_FileSize) || s_FileSize.QuadPart < static_cast<LONGLONG>(sizeof(Header))) {
+        Close();
+        return false;
+    }
+
+    m_Mapping = CreateFileMappingW(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (!m_Mapping) {
+        Close();
+        return false;
+    }
+
+    m_MappedView = MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (!m_MappedView) {
+        Close();
+        return false;
+    }
+
+    const auto* s_Data = static_cast<const uint8_t*>(m_MappedView);
+    const auto* s_Header = reinterpret_cast<const Header*>(s_Data);
+
+    if (s_Header->m_Magic != c_Magic || s_Header->m_Version != c_Version) {
+        Close();
+        return false;
+    }
+
+    const uint64_t s_ExpectedSize = sizeof(Header) +
+        static_cast<uint64_t>(s_Header->m_PackageCount) * sizeof(PackageFile) +
+        s_Header->m_EntryCount * sizeof(Entry);
+
+    if (static_cast<uint64_t>(s_FileSize.QuadPart) != s_ExpectedSize) {
+        Close();
+        return false;
+    }
+
+    const std::span<const PackageFile> s_PackageFiles(
+        reinterpret_cast<const PackageFile*>(s_Data + sizeof(Header)), s_Header->m_PackageCount
+    );
+
+    if (!std::ranges::equal(s_PackageFiles, p_PackageFiles)) {
+        Close();
+        return false;
+    }
+
+    m_Entries = std::span<const Entry>(
+        reinterpret_cast<const Entry*>(s_Data + sizeof(Header) + s_PackageFiles.size_bytes()),
+        static_cast<size_t>(s_Header->m_EntryCount)
+    );
+
+    m_PackageFiles.assign(s_PackageFiles.begin(), s_PackageFiles.end());
+    m_IsLoaded = true;
+
+    return true;
+}
+
+void ResourceChunkIndex::Assign(std::span<const PackageFile> p_PackageFiles, std::vector<Entry>&& p_Entries) {
+    Close();
+
+    m_PackageFiles.assign(p_PackageFiles.begin(), p_PackageFiles.end());
+    m_OwnedEntries = std::move(p_Entries);
+
+    // The chunk map builder already emits entries sorted by resource ID, so this is usually just a linear check.
+    if (!std::ranges::is_sorted(m_OwnedEntries, {}, &Entry::m_ResourceId)) {
+        std::ranges::stable_sort(m_OwnedEntries, {}, &Entry::m_ResourceId);
+    }
+
+    m_Entries = m_OwnedEntries;
+    m_IsLoaded = true;
+}
+
+bool ResourceChunkIndex::Save(const std::filesystem::path& p_Path) const {
+    if (!m_IsLoaded) {
+        return false;
+    }
+
+    std::filesystem::path s_TemporaryPath = p_Path;
+    s_TemporaryPath += ".tmp";
+
+    {
+        std::ofstream s_Stream(s_TemporaryPath, std::ios::binary | std::ios::trunc);
+
+        if (!s_Stream) {
+            return false;
+        }
+
+        const Header s_Header {
+            .m_Magic = c_Magic,
+            .m_Version = c_Version,
+            .m_PackageCount = static_cast<uint32_t>(m_PackageFiles.size()),
+            .m_Reserved = 0,
+            .m_EntryCount = m_Entries.size(),
+        };
+
+        s_Stream.write(reinterpret_cast<const char*>(&s_Header), sizeof(s_Header));
+        s_Stream.write(
+            reinterpret_cast<const char*>(m_PackageFiles.data()),
+            static_cast<std::streamsize>(m_PackageFiles.size() * sizeof(PackageFile))
+        );
+        s_Stream.write(
+            reinterpret_cast<const char*>(m_Entries.data()), static_cast<std::streamsize>(m_Entries.size_bytes())
+        );
+
+        if (!s_Stream) {
+            return false;
+        }
+    }
+
+    std::error_code s_ErrorCode;
+    std::filesystem::rename(s_TemporaryPath, p_Path, s_ErrorCode);
+
+    if (s_ErrorCode) {
+        Logger::Debug("Could not move resource chunk index into place: {}", s_ErrorCode.message());
+        std::filesystem::remove(s_TemporaryPath, s_ErrorCode);
+        return false;
+    }
+
+    return true;
+}
+
+void ResourceChunkIndex::Close() {
+    if (m_MappedView) {
+        UnmapViewOfFile(m_MappedView);
+        m_MappedView = nullptr;
+    }
+
+    if (m_Mapping) {
+        CloseHandle(m_Mapping);
+        m_Mapping = nullptr;
+    }
+
+    if (m_File != INVALID_HANDLE_VALUE) {
+        CloseHandle(m_File);
+        m_File = INVALID_HANDLE_VALUE;
+    }
+
+    m_PackageFiles.clear();
+    m_OwnedEntries.clear();
+    m_Entries = {};
+    m_IsLoaded = false;
+}
+
+std::span<const ResourceChunkIndex::Entry> ResourceChunkIndex::Find(const uint64_t p_ResourceId) const {
+    const auto s_First = std::ranges::lower_bound(m_Entries, p_ResourceId, {}, &Entry::m_ResourceId);
+    auto s_Last = s_First;
+
+    while (s_Last != m_Entries.end() && s_Last->m_ResourceId == p_ResourceId) {
+        ++s_Last;
+    }
+
+    return {s_First, s_Last};
+}
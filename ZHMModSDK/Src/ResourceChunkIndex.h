@@ -0,0 +1,115 @@
+#pragma once
+
+#include <Windows.h>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+/**
+ * A persistent index from runtime resource IDs to the chunks that contain them.
+ *
+ * Building the index requires parsing every resource package of the game, so it's saved to disk together with a
+ * fingerprint (name, size and last write time) of the files in the runtime directory. As long as the fingerprint
+ * still matches, later launches memory-map the file and look resources up with a binary search instead.
+ *
+ * The file consists of a header, followed by the package fingerprints sorted by name hash, followed by the
+ * entries sorted by resource ID. Entries with the same resource ID keep the order they were built in.
+ */
+class ResourceChunkIndex {
+public:
+    struct PackageFile {
+        uint32_t m_NameHash;
+        uint32_t m_Reserved;
+        uint64_t m_Size;
+        uint64_t m_LastWriteTime;
+
+        bool operator==(const PackageFile&) const = default;
+    };
+
+    struct Entry {
+        uint64_t m_ResourceId;
+        uint32_t m_ChunkIndex;
+        uint32_t m_Reserved;
+    };
+
+    ResourceChunkIndex() = default;
+    ~ResourceChunkIndex();
+
+    ResourceChunkIndex(const ResourceChunkIndex&) = delete;
+    ResourceChunkIndex& operator=(const ResourceChunkIndex&) = delete;
+
+    /**
+     * Fingerprint the files in a runtime directory. The result is sorted by name hash.
+     * @param p_RuntimeDirectory The directory containing the resource packages of the game.
+     * @return The fingerprints, or an empty list if the directory doesn't exist.
+     */
+    static std::vector<PackageFile> GetPackageFiles(const std::filesystem::path& p_RuntimeDirectory);
+
+    /**
+     * Memory-map an index file that was previously written with Save.
+     * @param p_Path The path of the index file.
+     * @param p_PackageFiles The current fingerprint of the runtime directory.
+     * @return False if the file doesn't exist, is invalid, or was built from different packages.
+     */
+    bool Open(const std::filesystem::path& p_Path, std::span<const PackageFile> p_PackageFiles);
+
+    /**
+     * Replace the contents of the index with freshly built entries.
+     * @param p_PackageFiles The fingerprint of the runtime directory the entries were built from.
+     * @param p_Entries The entries. They're sorted by resource ID (stable) if they aren't already.
+     */
+    void Assign(std::span<const PackageFile> p_PackageFiles, std::vector<Entry>&& p_Entries);
+
+    /**
+     * Write the index to disk so it can be opened on the next launch.
+     * The file is written to a temporary path first and then moved into place.
+     * @param p_Path The path of the index file.
+     * @return True if the file was written successfully.
+     */
+    bool Save(const std::filesystem::path& p_Path) const;
+
+    void Close();
+
+    /**
+     * Find the entries of a resource.
+     * @param p_ResourceId The runtime resource ID to look up.
+     * @return The entries, in the order of the partitions they were found in. Empty if the resource is unknown.
+     */
+    std::span<const Entry> Find(uint64_t p_ResourceId) const;
+
+    bool IsLoaded() const {
+        return m_IsLoaded;
+    }
+
+    bool IsMapped() const {
+        return m_MappedView != nullptr;
+    }
+
+    size_t GetEntryCount() const {
+        return m_Entries.size();
+    }
+
+private:
+    struct Header {
+        uint32_t m_Magic;
+        uint32_t m_Version;
+        uint32_t m_PackageCount;
+        uint32_t m_Reserved;
+        uint64_t m_EntryCount;
+    };
+
+    // "RCIX" when read as bytes.
+    static constexpr uint32_t c_Magic = 0x58494352;
+    static constexpr uint32_t c_Version = 1;
+
+private:
+    HANDLE m_File = INVALID_HANDLE_VALUE;
+    HANDLE m_Mapping = nullptr;
+    const void* m_MappedView = nullptr;
+
+    std::vector<PackageFile> m_PackageFiles;
+    std::vector<Entry> m_OwnedEntries;
+    std::span<const Entry> m_Entries;
+    bool m_IsLoaded = false;
+};
@@ -3,27 +3,67 @@
 #include <Globals.h>
 #include <Functions.h>
 #include <Logging.h>
+#include <Events.h>
 #include <zhmmodsdk_rs.h>
 #include <Glacier/ZModule.h>
 #include <Glacier/ZResource.h>
 #include <Util/StringUtils.h>
 #include <ResourceLib_HM3.h>
-#include <simdjson.h>
+#include <algorithm>
 #include <filesystem>
 #include <Util/ResourceUtils.h>
 
-static void WaitForResources() {
+#include "ResourceChunkIndex.h"
+
+static void WaitForResources(const std::function<void(uint32_t)>& p_OnProgress = nullptr) {
+    if (Globals::ResourceManager->DoneLoading()) {
+        return;
+    }
+
+    Logger::Debug("Waiting for resources to load (left: {})!", Globals::ResourceManager->m_nNumProcessing);
+
     while (!Globals::ResourceManager->DoneLoading()) {
-        Logger::Debug("Waiting for resources to load (left: {})!", Globals::ResourceManager->m_nNumProcessing);
+        if (p_OnProgress) {
+            p_OnProgress(static_cast<uint32_t>(Globals::ResourceManager->m_nNumProcessing));
+        }
+
         Globals::ResourceManager->Update(true);
     }
 }
 
+/**
+ * Get the BIN1 data of a converted factory or blueprint. The Rust library writes most of them directly, and only
+ * hands over RT JSON for those with property types it can't write, which ResourceLib then generates the resource from.
+ * Like the resources loaded from it, the returned memory is never freed.
+ */
+static ResourceMem* GetConvertedResourceMem(
+    const char* p_ResourceType, const char* p_Json, const uint8_t* p_Bin1, size_t p_Bin1Size
+) {
+    if (p_Bin1Size == 0) {
+        return HM3_GetGeneratorForResource(p_ResourceType)->FromJsonStringToResourceMem(p_Json, strlen(p_Json), false);
+    }
+
+    // The data is copied since the converted data is freed once the entity is loaded.
+    void* s_Data = (*Globals::MemoryManager)->m_pNormalAllocator->AllocateAligned(p_Bin1Size, 16);
+    memcpy(s_Data, p_Bin1, p_Bin1Size);
+
+    return new ResourceMem {
+        .ResourceData = s_Data,
+        .DataSize = p_Bin1Size,
+    };
+}
+
 void ModSDK::LoadResourceChunkMap() {
-    if (m_ResourceIdToChunkMap.size() > 0) {
+    std::scoped_lock s_Lock(m_ResourceChunkIndexMutex);
+
+    if (m_ResourceChunkIndex && m_ResourceChunkIndex->IsLoaded()) {
         return;
     }
 
+    if (!m_ResourceChunkIndex) {
+        m_ResourceChunkIndex = std::make_shared<ResourceChunkIndex>();
+    }
+
     // Load resid -> chunk map.
     char s_ExePathStr[MAX_PATH];
     auto s_PathSize = GetModuleFileNameA(nullptr, s_ExePathStr, MAX_PATH);
@@ -35,8 +75,21 @@ void ModSDK::LoadResourceChunkMap() {
 
     const std::filesystem::path s_ExePath(s_ExePathStr);
     const auto s_ExeDir = s_ExePath.parent_path();
+    const auto s_IndexPath = s_ExeDir / "resource_chunk_index.bin";
+
+    // The index is reused for as long as the files in the runtime directory stay the same.
+    const auto s_RuntimeDir = s_ExeDir.parent_path() / "Runtime";
+    const auto s_PackageFiles = ResourceChunkIndex::GetPackageFiles(s_RuntimeDir);
 
-    Logger::Info("Loading resource chunk map (exe dir = {}). This might take a while...", s_ExeDir.string());
+    if (!s_PackageFiles.empty() && m_ResourceChunkIndex->Open(s_IndexPath, s_PackageFiles)) {
+        Logger::Info(
+            "Loaded cached resource chunk map with {} entries from {}.", m_ResourceChunkIndex->GetEntryCount(),
+            s_IndexPath.string()
+        );
+        return;
+    }
+
+    Logger::Info("Building resource chunk map (exe dir = {}). This might take a while...", s_ExeDir.string());
 
     const auto s_ResourceChunkMap = get_resource_chunk_map(s_ExeDir.string().c_str());
 
@@ -46,68 +99,178 @@ void ModSDK::LoadResourceChunkMap() {
     }
 
     Logger::Debug("Resource chunk map loaded with {} entries.", s_ResourceChunkMap->entries.len);
-    m_ResourceIdToChunkMap.reserve(s_ResourceChunkMap->entries.len);
+
+    std::vector<ResourceChunkIndex::Entry> s_Entries;
+    s_Entries.reserve(s_ResourceChunkMap->entries.len);
 
     for (size_t i = 0; i < s_ResourceChunkMap->entries.len; ++i) {
         const auto& s_Entry = s_ResourceChunkMap->entries.ptr[i];
-        const auto s_Rid = ZRuntimeResourceID(s_Entry.rid);
-        m_ResourceIdToChunkMap[s_Rid].push_back(s_Entry.chunk_index);
+
+        s_Entries.push_back(
+            ResourceChunkIndex::Entry {
+                .m_ResourceId = s_Entry.rid,
+                .m_ChunkIndex = s_Entry.chunk_index,
+                .m_Reserved = 0,
+            }
+        );
     }
 
     free_resource_chunk_map(s_ResourceChunkMap);
 
-    Logger::Info("Finished loading resource chunk map! Found {} entries.", m_ResourceIdToChunkMap.size());
+    m_ResourceChunkIndex->Assign(s_PackageFiles, std::move(s_Entries));
+
+    if (s_PackageFiles.empty()) {
+        Logger::Warn(
+            "Could not find runtime directory {}. Resource chunk map will not be cached.", s_RuntimeDir.string()
+        );
+    }
+    else if (!m_ResourceChunkIndex->Save(s_IndexPath)) {
+        Logger::Warn("Failed to save resource chunk map to {}.", s_IndexPath.string());
+    }
+
+    Logger::Info("Finished loading resource chunk map! Found {} entries.", m_ResourceChunkIndex->GetEntryCount());
 }
 
 bool ModSDK::IsChunkMounted(uint32_t p_ChunkIndex) {
-    std::string s_ChunkName = std::format("chunk{}.rpkg", p_ChunkIndex);
+    const auto s_MountedChunks = GetMountedChunks();
+    const size_t s_Word = p_ChunkIndex / 64;
+
+    return s_Word < s_MountedChunks->m_Chunks.size() &&
+            (s_MountedChunks->m_Chunks[s_Word] & (1ull << (p_ChunkIndex % 64))) != 0;
+}
+
+int32_t ModSDK::GetMountedChunkPatchLevel(uint32_t p_ChunkIndex) {
+    const auto s_MountedChunks = GetMountedChunks();
+
+    return p_ChunkIndex < s_MountedChunks->m_PatchLevels.size() ? s_MountedChunks->m_PatchLevels[p_ChunkIndex] : -1;
+}
+
+std::vector<uint32_t> ModSDK::GetMountedChunkIndices() {
+    return GetMountedChunks()->m_MountOrder;
+}
+
+std::shared_ptr<const ModSDK::MountedChunks> ModSDK::GetMountedChunks() {
+    const auto& s_MountedPackages = (*Globals::ResourceContainer)->m_MountedPackages;
+
+    auto s_MountedChunks = m_MountedChunks.load(std::memory_order_acquire);
+
+    if (s_MountedChunks && !m_MountedChunksDirty.load(std::memory_order_acquire) &&
+        s_MountedChunks->m_PackageCount == s_MountedPackages.size()) {
+        return s_MountedChunks;
+    }
+
+    std::scoped_lock s_Lock(m_MountedChunksMutex);
+
+    // Another thread might have rebuilt them while we were waiting.
+    s_MountedChunks = m_MountedChunks.load(std::memory_order_acquire);
+
+    if (s_MountedChunks && !m_MountedChunksDirty.load(std::memory_order_acquire) &&
+        s_MountedChunks->m_PackageCount == s_MountedPackages.size()) {
+        return s_MountedChunks;
+    }
+
+    // Cleared before reading the packages, so a mount that happens during the rebuild marks them as dirty again.
+    m_MountedChunksDirty.store(false, std::memory_order_release);
+
+    auto s_NewMountedChunks = std::make_shared<MountedChunks>();
+
+    for (const ZString& s_Package : s_MountedPackages) {
+        const auto s_ChunkIndex = Util::ResourceUtils::TryParseChunkIndexFromResourcePackagePath(s_Package);
+
+        if (!s_ChunkIndex) {
+            continue;
+        }
+
+        const auto s_PatchLevel = Util::ResourceUtils::TryParsePatchLevelFromResourcePackagePath(s_Package);
+        auto& s_Chunks = s_NewMountedChunks->m_Chunks;
+        auto& s_PatchLevels = s_NewMountedChunks->m_PatchLevels;
 
-    for (const auto& s_Package : (*Globals::ResourceContainer)->m_MountedPackages) {
-        // If the package ends with the chunk name, it's mounted.
-        if (Util::StringUtils::EndsWith(s_Package.c_str(), s_ChunkName)) {
-            return true;
+        if (*s_ChunkIndex / 64 >= s_Chunks.size()) {
+            s_Chunks.resize(*s_ChunkIndex / 64 + 1, 0);
         }
+
+        if (*s_ChunkIndex >= s_PatchLevels.size()) {
+            s_PatchLevels.resize(*s_ChunkIndex + 1, -1);
+        }
+
+        // Patches are mounted after the base package of their chunk, so the first package decides the order.
+        if (s_PatchLevels[*s_ChunkIndex] == -1) {
+            s_NewMountedChunks->m_MountOrder.push_back(*s_ChunkIndex);
+        }
+
+        s_Chunks[*s_ChunkIndex / 64] |= 1ull << (*s_ChunkIndex % 64);
+        s_PatchLevels[*s_ChunkIndex] = std::max(
+            s_PatchLevels[*s_ChunkIndex], static_cast<int32_t>(s_PatchLevel.value_or(0))
+        );
     }
 
-    return false;
+    s_NewMountedChunks->m_PackageCount = s_MountedPackages.size();
+
+    m_MountedChunks.store(s_NewMountedChunks, std::memory_order_release);
+
+    return s_NewMountedChunks;
 }
 
 void ModSDK::MountChunk(uint32_t p_ChunkIndex) {
-    std::vector<IPackageManager::SPartitionInfo*> s_ChunksToMount;
+    MountChunks({&p_ChunkIndex, 1});
+}
 
-    for (auto& s_Info : (*Globals::PackageManager)->m_aPartitionInfos) {
-        if (s_Info->m_nIndex == p_ChunkIndex) {
-            Logger::Debug("Found chunk {} info. Adding to mount queue.", s_Info->m_nIndex);
-            s_ChunksToMount.push_back(s_Info);
-        }
-    }
+void ModSDK::MountChunks(std::span<const uint32_t> p_ChunkIndices) {
+    std::unordered_set<uint32_t> s_RequestedChunks(p_ChunkIndices.begin(), p_ChunkIndices.end());
+    std::vector<IPackageManager::SPartitionInfo*> s_ChunksToMount;
+    std::unordered_set<IPackageManager::SPartitionInfo*> s_VisitedPartitions;
 
-    while (s_ChunksToMount.size() > 0) {
-        const auto s_Info = s_ChunksToMount.back();
+    // Collect every unmounted partition of the requested chunks together with their unmounted parents.
+    // Parents are added before their children, so mounting in order satisfies all dependencies.
+    std::vector<IPackageManager::SPartitionInfo*> s_Chain;
 
-        if (IsChunkMounted(s_Info->m_nIndex)) {
-            s_ChunksToMount.pop_back();
+    for (auto& s_Info : (*Globals::PackageManager)->m_aPartitionInfos) {
+        if (!s_RequestedChunks.contains(s_Info->m_nIndex)) {
             continue;
         }
 
-        if (s_Info->m_pParent) {
-            if (!IsChunkMounted(s_Info->m_pParent->m_nIndex)) {
-                Logger::Debug(
-                    "Parent chunk {} of chunk {} is not mounted. Adding to mount queue.", s_Info->m_pParent->m_nIndex,
-                    s_Info->m_nIndex
-                );
+        s_Chain.clear();
 
-                s_ChunksToMount.push_back(s_Info->m_pParent);
-                continue;
+        for (auto* s_Current = s_Info; s_Current; s_Current = s_Current->m_pParent) {
+            if (!s_VisitedPartitions.insert(s_Current).second || IsChunkMounted(s_Current->m_nIndex)) {
+                break;
             }
+
+            s_Chain.push_back(s_Current);
         }
 
+        s_ChunksToMount.insert(s_ChunksToMount.end(), s_Chain.rbegin(), s_Chain.rend());
+    }
+
+    if (s_ChunksToMount.empty()) {
+        return;
+    }
+
+    SChunkMountProgress s_Progress {
+        .m_ChunkIndex = 0,
+        .m_MountedChunkCount = 0,
+        .m_TotalChunkCount = static_cast<uint32_t>(s_ChunksToMount.size()),
+        .m_PendingResourceCount = 0,
+    };
+
+    for (const auto s_Info : s_ChunksToMount) {
         Logger::Info("Mounting chunk {}...", s_Info->m_nIndex);
         (*Globals::PackageManager)->MountResourcePackagesInPartition(s_Info, nullptr);
-        s_ChunksToMount.pop_back();
-        WaitForResources();
+        m_MountedChunksDirty.store(true, std::memory_order_release);
+
+        s_Progress.m_ChunkIndex = s_Info->m_nIndex;
+        ++s_Progress.m_MountedChunkCount;
+        Events::OnChunkMountProgress->Call(s_Progress);
     }
 
+    // The resources of all mounted partitions are loaded together instead of after every single partition.
+    WaitForResources(
+        [&](const uint32_t p_PendingResourceCount) {
+            s_Progress.m_PendingResourceCount = p_PendingResourceCount;
+            Events::OnChunkMountProgress->Call(s_Progress);
+        }
+    );
+
     Logger::Debug("All requested chunks have been mounted.");
 }
 
@@ -205,6 +368,7 @@ void ModSDK::UnmountChunk(uint32_t p_ChunkIndex, bool p_RemountChunksBelow) {
     for (size_t i = 0; i < s_ResourceContainer->m_firstPackageIndexPerMountedPartition.size(); ++i) {
         if (s_ResourceContainer->m_firstPackageIndexPerMountedPartition[i] == s_PackageId) {
             s_PackageManagerBase->UnmountPartitions(i);
+            m_MountedChunksDirty.store(true, std::memory_order_release);
             break;
         }
     }
@@ -222,27 +386,65 @@ void ModSDK::UnmountChunk(uint32_t p_ChunkIndex, bool p_RemountChunksBelow) {
     );
 }
 
-const TArray<uint32_t>& ModSDK::GetChunkIndicesForRuntimeResourceId(const ZRuntimeResourceID& id) {
-    if (m_ResourceIdToChunkMap.empty()) {
-        LoadResourceChunkMap();
+TArray<uint32_t> ModSDK::GetChunkIndicesForRuntimeResourceId(const ZRuntimeResourceID& id) {
+    LoadResourceChunkMap();
+
+    TArray<uint32_t> s_ChunkIndices;
+
+    for (const auto& s_Entry : m_ResourceChunkIndex->Find(id.GetID())) {
+        s_ChunkIndices.push_back(s_Entry.m_ChunkIndex);
+    }
+
+    return s_ChunkIndices;
+}
+
+uint64_t ModSDK::GetGameBuildFingerprint() {
+    char s_ExePathStr[MAX_PATH];
+    auto s_PathSize = GetModuleFileNameA(nullptr, s_ExePathStr, MAX_PATH);
+
+    if (s_PathSize <= 0) {
+        return 0;
     }
 
-    static const TArray<uint32_t> s_Empty;
-    auto s_Iterator = m_ResourceIdToChunkMap.find(id);
+    const std::filesystem::path s_ExePath(s_ExePathStr);
+    const auto s_RuntimeDir = s_ExePath.parent_path().parent_path() / "Runtime";
+
+    // The runtime directory is fingerprinted the same way as for the resource chunk index. The executable is
+    // added on top, since game updates don't always touch the packages.
+    auto s_Files = ResourceChunkIndex::GetPackageFiles(s_RuntimeDir);
+
+    std::error_code s_ErrorCode;
+    const auto s_ExeSize = std::filesystem::file_size(s_ExePath, s_ErrorCode);
+    const auto s_ExeLastWriteTime = std::filesystem::last_write_time(s_ExePath, s_ErrorCode);
+
+    s_Files.push_back(
+        ResourceChunkIndex::PackageFile {
+            .m_NameHash = 0,
+            .m_Reserved = 0,
+            .m_Size = s_ExeSize,
+            .m_LastWriteTime = static_cast<uint64_t>(s_ExeLastWriteTime.time_since_epoch().count()),
+        }
+    );
+
+    // FNV-1a over the fingerprints of all files.
+    uint64_t s_Fingerprint = 0xcbf29ce484222325;
+
+    const auto* s_Bytes = reinterpret_cast<const uint8_t*>(s_Files.data());
+    const size_t s_ByteCount = s_Files.size() * sizeof(ResourceChunkIndex::PackageFile);
+
+    for (size_t i = 0; i < s_ByteCount; ++i) {
+        s_Fingerprint ^= s_Bytes[i];
+        s_Fingerprint *= 0x100000001b3;
+    }
 
-    return s_Iterator != m_ResourceIdToChunkMap.end() ? s_Iterator->second : s_Empty;
+    return s_Fingerprint;
 }
 
 std::tuple<ZResourceIndex, ZRuntimeResourceID> ModSDK::LoadResourceFromBIN1(
-    ResourceMem* p_ResourceMem, std::string_view p_MetaJson, std::function<void(ZResourcePending*)> p_Install
+    ResourceMem* p_ResourceMem, const QnResourceMeta& p_Meta, std::function<void(ZResourcePending*)> p_Install
 ) {
-    // Parse meta, create resource, and register references.
-    simdjson::ondemand::parser s_Parser;
-    const auto s_Json = simdjson::padded_string(p_MetaJson);
-    simdjson::ondemand::document s_JsonMsg = s_Parser.iterate(s_Json);
-
-    const std::string s_ResIdStr {std::string_view(s_JsonMsg["hash_value"])};
-    const auto s_ResId = ZRuntimeResourceID::FromString(s_ResIdStr);
+    // Create the resource and register its references.
+    const auto s_ResId = ZRuntimeResourceID::FromString(p_Meta.hash);
 
     Logger::Debug("Loading resource {}...", s_ResId);
 
@@ -254,18 +456,14 @@ std::tuple<ZResourceIndex, ZRuntimeResourceID> ModSDK::LoadResourceFromBIN1(
     Logger::Debug("Collecting references from meta...");
 
     std::vector<std::pair<ZRuntimeResourceID, SResourceReferenceFlags>> s_References;
-    for (auto s_Ref : s_JsonMsg["hash_reference_data"]) {
-        const std::string s_Hash {std::string_view(s_Ref["hash"])};
-        const std::string s_Flag {std::string_view(s_Ref["flag"])};
+    s_References.reserve(p_Meta.references.len);
 
-        const auto s_RefId = ZRuntimeResourceID::FromString(s_Hash);
+    for (size_t i = 0; i < p_Meta.references.len; ++i) {
+        const auto& s_Ref = p_Meta.references.ptr[i];
 
-        // Parse flag as hex byte.
-        const SResourceReferenceFlags s_Flags {
-            .flags = static_cast<uint8_t>(std::stoul(s_Flag, nullptr, 16))
-        };
-
-        s_References.emplace_back(s_RefId, s_Flags);
+        s_References.emplace_back(
+            ZRuntimeResourceID::FromString(s_Ref.hash), SResourceReferenceFlags {.flags = s_Ref.flags}
+        );
     }
 
     Logger::Debug("Found {} references!", s_References.size());
@@ -275,20 +473,26 @@ std::tuple<ZResourceIndex, ZRuntimeResourceID> ModSDK::LoadResourceFromBIN1(
     }
 
     // Make sure that the chunks these references are in are loaded.
+    // References tend to share chunks, so the chunks are collected first and mounted in one go.
+    std::vector<uint32_t> s_ChunksToMount;
+
     for (const auto& [s_RefId, _] : s_References) {
-        if (!m_ResourceIdToChunkMap.contains(s_RefId)) {
+        const auto s_Entries = m_ResourceChunkIndex->Find(s_RefId.GetID());
+
+        if (s_Entries.empty()) {
             Logger::Error("Resource {} is not in any chunk!", s_RefId);
             continue;
         }
 
-        const auto s_ChunkIndex = m_ResourceIdToChunkMap[s_RefId][0];
+        const auto s_ChunkIndex = s_Entries[0].m_ChunkIndex;
 
-        if (!IsChunkMounted(s_ChunkIndex)) {
-            Logger::Debug("Reference {} is in chunk {}. Mounting...", s_RefId, s_ChunkIndex);
-            MountChunk(s_ChunkIndex);
+        if (std::ranges::find(s_ChunksToMount, s_ChunkIndex) == s_ChunksToMount.end()) {
+            s_ChunksToMount.push_back(s_ChunkIndex);
         }
     }
 
+    MountChunks(s_ChunksToMount);
+
     auto& s_ResInfo = (*Globals::ResourceContainer)->m_resources[s_Index.val];
     s_ResInfo.refCount = 99; // TODO: Fix.
     s_ResInfo.firstReferenceIndex = (*Globals::ResourceContainer)->m_references.size();
@@ -356,7 +560,7 @@ bool ModSDK::LoadQnEntity(
     TResourcePtr<ZTemplateEntityBlueprintFactory>& p_BlueprintFactoryOut,
     TResourcePtr<ZTemplateEntityFactory>& p_FactoryOut
 ) {
-    Logger::Debug("Converting QN entity JSON to RT JSON and meta...");
+    Logger::Debug("Converting QN entity JSON to RT...");
 
     const auto s_QnData = convert_qn_entity(p_Json.c_str());
 
@@ -365,25 +569,73 @@ bool ModSDK::LoadQnEntity(
         return false;
     }
 
-    Logger::Debug("Converted from QN to RT! Generating BIN1 resources from RT JSON...");
+    const bool s_Result = LoadQnConvertedData(*s_QnData, p_BlueprintFactoryOut, p_FactoryOut);
 
-    const auto s_ResourceTempMem = HM3_GetGeneratorForResource("TEMP")->FromJsonStringToResourceMem(
-        s_QnData->factory_json,
-        strlen(s_QnData->factory_json),
-        false
-    );
+    free_qn_converted_data(s_QnData);
+
+    return s_Result;
+}
+
+bool ModSDK::LoadQnEntities(
+    std::span<const ZString> p_Jsons,
+    std::span<TResourcePtr<ZTemplateEntityBlueprintFactory>> p_BlueprintFactoriesOut,
+    std::span<TResourcePtr<ZTemplateEntityFactory>> p_FactoriesOut
+) {
+    if (p_BlueprintFactoriesOut.size() != p_Jsons.size() || p_FactoriesOut.size() != p_Jsons.size()) {
+        Logger::Error("Output spans passed to LoadQnEntities must have the same size as the input.");
+        return false;
+    }
+
+    Logger::Debug("Converting {} QN entities to RT...", p_Jsons.size());
+
+    std::vector<const char*> s_Jsons;
+    s_Jsons.reserve(p_Jsons.size());
+
+    for (const ZString& s_Json : p_Jsons) {
+        s_Jsons.push_back(s_Json.c_str());
+    }
+
+    // Conversion runs on all cores. Loading the resources has to happen one at a time since it goes through the engine.
+    const auto s_QnDataList = convert_qn_entities({s_Jsons.data(), s_Jsons.size()});
+    bool s_Result = true;
 
-    const auto s_ResourceTbluMem = HM3_GetGeneratorForResource("TBLU")->FromJsonStringToResourceMem(
-        s_QnData->blueprint_json,
-        strlen(s_QnData->blueprint_json),
-        false
+    for (size_t i = 0; i < s_QnDataList.len; ++i) {
+        const auto s_QnData = s_QnDataList.ptr[i];
+
+        if (!s_QnData) {
+            Logger::Error("Failed to convert QN entity {} to RT.", i);
+            s_Result = false;
+            continue;
+        }
+
+        if (!LoadQnConvertedData(*s_QnData, p_BlueprintFactoriesOut[i], p_FactoriesOut[i])) {
+            s_Result = false;
+        }
+    }
+
+    free_qn_converted_data_list(s_QnDataList);
+
+    return s_Result;
+}
+
+bool ModSDK::LoadQnConvertedData(
+    const QnConvertedData& p_QnData,
+    TResourcePtr<ZTemplateEntityBlueprintFactory>& p_BlueprintFactoryOut,
+    TResourcePtr<ZTemplateEntityFactory>& p_FactoryOut
+) {
+    Logger::Debug(
+        "Getting BIN1 resources (TEMP {}, TBLU {})...",
+        p_QnData.factory_bin1.len > 0 ? "native" : "from JSON",
+        p_QnData.blueprint_bin1.len > 0 ? "native" : "from JSON"
     );
 
-    std::string s_FactoryMetaJson {s_QnData->factory_meta_json};
-    std::string s_BlueprintMetaJson {s_QnData->blueprint_meta_json};
+    const auto s_ResourceTempMem = GetConvertedResourceMem(
+        "TEMP", p_QnData.factory_json, p_QnData.factory_bin1.ptr, p_QnData.factory_bin1.len
+    );
 
-    // Free the QN data.
-    free_qn_converted_data(s_QnData);
+    const auto s_ResourceTbluMem = GetConvertedResourceMem(
+        "TBLU", p_QnData.blueprint_json, p_QnData.blueprint_bin1.ptr, p_QnData.blueprint_bin1.len
+    );
 
     if (!s_ResourceTbluMem || !s_ResourceTempMem) {
         Logger::Error("Failed to generate editor resources.");
@@ -394,7 +646,7 @@ bool ModSDK::LoadQnEntity(
     Logger::Debug("Creating TBLU resource...");
 
     auto [s_TbluIndex, s_TbluId] = LoadResourceFromBIN1(
-        s_ResourceTbluMem, s_BlueprintMetaJson,
+        s_ResourceTbluMem, p_QnData.blueprint_meta,
         [](ZResourcePending* r) { Functions::ZTemplateBlueprintInstaller_Install->Call(nullptr, r); }
     );
 
@@ -403,7 +655,7 @@ bool ModSDK::LoadQnEntity(
     Logger::Debug("Creating TEMP resource...");
 
     auto [s_TempIndex, s_TempId] = LoadResourceFromBIN1(
-        s_ResourceTempMem, s_FactoryMetaJson,
+        s_ResourceTempMem, p_QnData.factory_meta,
         [](ZResourcePending* r) { Functions::ZTemplateInstaller_Install->Call(nullptr, r); }
     );
 
@@ -0,0 +1,122 @@
+#include "TaskScheduler.h"
+
+#include <algorithm>
+
+#include "Logging.h"
+
+void TaskScheduler::Queue(IPluginInterface* p_Owner, MainThreadTask&& p_Task, ETaskPriority p_Priority) {
+    if (!p_Task) {
+        return;
+    }
+
+    const auto s_PriorityIndex = std::min(static_cast<size_t>(p_Priority), c_PriorityCount - 1);
+
+    std::scoped_lock s_Lock(m_Mutex);
+    m_Queues[s_PriorityIndex].push_back({p_Owner, std::move(p_Task)});
+}
+
+bool TaskScheduler::PopNextTask(QueuedTask& p_Out, ETaskPriority& p_PriorityOut) {
+    std::scoped_lock s_Lock(m_Mutex);
+
+    for (size_t i = 0; i < c_PriorityCount; ++i) {
+        auto& s_Queue = m_Queues[i];
+
+        if (s_Queue.empty()) {
+            continue;
+        }
+
+        p_Out = std::move(s_Queue.front());
+        p_PriorityOut = static_cast<ETaskPriority>(i);
+        s_Queue.pop_front();
+
+        return true;
+    }
+
+    return false;
+}
+
+void TaskScheduler::ProcessTasks() {
+    const auto s_Start = std::chrono::steady_clock::now();
+
+    const auto s_Budget = std::chrono::microseconds(m_FrameBudgetUs.load(std::memory_order_relaxed));
+
+    // Tasks that asked to be continued are only re-queued after we're done with this frame,
+    // otherwise a single long-running task could take up the whole budget by itself.
+    std::vector<std::pair<ETaskPriority, QueuedTask>> s_ContinuedTasks;
+
+    QueuedTask s_Task {};
+    ETaskPriority s_Priority;
+
+    while (PopNextTask(s_Task, s_Priority)) {
+        ETaskStatus s_Status = ETaskStatus::Done;
+
+        try {
+            s_Status = s_Task.Task();
+        }
+        catch (const std::exception& p_Exception) {
+            Logger::Error("Main thread task threw an exception: {}", p_Exception.what());
+        }
+
+        if (s_Status == ETaskStatus::Continue) {
+            s_ContinuedTasks.emplace_back(s_Priority, std::move(s_Task));
+        }
+
+        s_Task.Task.Reset();
+
+        if (std::chrono::steady_clock::now() - s_Start >= s_Budget) {
+            break;
+        }
+    }
+
+    if (s_ContinuedTasks.empty()) {
+        return;
+    }
+
+    std::scoped_lock s_Lock(m_Mutex);
+
+    // Put continued tasks back at the front of their queue, so they keep their place
+    // relative to tasks queued while they were running.
+    for (auto it = s_ContinuedTasks.rbegin(); it != s_ContinuedTasks.rend(); ++it) {
+        m_Queues[static_cast<size_t>(it->first)].push_front(std::move(it->second));
+    }
+}
+
+void TaskScheduler::RemoveTasksForOwner(IPluginInterface* p_Owner) {
+    std::scoped_lock s_Lock(m_Mutex);
+
+    for (auto& s_Queue : m_Queues) {
+        std::erase_if(
+            s_Queue, [p_Owner](const QueuedTask& p_Task) {
+                return p_Task.Owner == p_Owner;
+            }
+        );
+    }
+}
+
+void TaskScheduler::Clear() {
+    std::scoped_lock s_Lock(m_Mutex);
+
+    for (auto& s_Queue : m_Queues) {
+        s_Queue.clear();
+    }
+}
+
+void TaskScheduler::SetFrameBudget(double p_Milliseconds) {
+    m_FrameBudgetUs.store(static_cast<int64_t>(std::max(p_Milliseconds, 0.0) * 1000.0), std::memory_order_relaxed);
+}
+
+double TaskScheduler::GetFrameBudget() const {
+    return static_cast<double>(m_FrameBudgetUs.load(std::memory_order_relaxed)) / 1000.0;
+}
+
+size_t TaskScheduler::GetPendingTaskCount() {
+    std::scoped_lock s_Lock(m_Mutex);
+
+    size_t s_Count = 0;
+
+    for (const auto& s_Queue : m_Queues) {
+        s_Count += s_Queue.size();
+    }
+
+    return s_Count;
+}
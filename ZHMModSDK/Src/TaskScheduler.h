@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "MainThreadTask.h"
+
+class IPluginInterface;
+
+/**
+ * Runs tasks queued by mods (and the SDK itself) on the main thread, sharing a
+ * single per-frame time budget between everyone.
+ *
+ * Tasks are run in priority order, and FIFO within the same priority. Once the budget
+ * for the current frame has been spent, any remaining tasks are left in the queue and
+ * continue on the next frame. At least one task is always run per frame so that
+ * progress is guaranteed even with a very small budget.
+ */
+class TaskScheduler {
+public:
+    static constexpr double c_DefaultFrameBudgetMs = 2.0;
+
+public:
+    void Queue(IPluginInterface* p_Owner, MainThreadTask&& p_Task, ETaskPriority p_Priority);
+
+    /**
+     * Run queued tasks until the frame budget is exhausted. Must be called on the main thread.
+     */
+    void ProcessTasks();
+
+    /**
+     * Drop all pending tasks owned by the given plugin. Called before a mod is unloaded so
+     * we never invoke code from a module that is no longer loaded.
+     */
+    void RemoveTasksForOwner(IPluginInterface* p_Owner);
+
+    void Clear();
+
+    void SetFrameBudget(double p_Milliseconds);
+    double GetFrameBudget() const;
+    size_t GetPendingTaskCount();
+
+private:
+    struct QueuedTask {
+        IPluginInterface* Owner;
+        MainThreadTask Task;
+    };
+
+    static constexpr size_t c_PriorityCount = static_cast<size_t>(ETaskPriority::Low) + 1;
+
+    bool PopNextTask(QueuedTask& p_Out, ETaskPriority& p_PriorityOut);
+
+private:
+    std::mutex m_Mutex;
+    std::array<std::deque<QueuedTask>, c_PriorityCount> m_Queues;
+    std::atomic<int64_t> m_FrameBudgetUs = static_cast<int64_t>(c_DefaultFrameBudgetMs * 1000.0);
+};